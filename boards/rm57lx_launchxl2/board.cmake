@@ -5,4 +5,10 @@ board_runner_args(openocd "--config=${BOARD_DIR}/support/rm57lx.cfg")
 board_runner_args(openocd "--use-elf")
 board_runner_args(openocd "--verify")
 
+set(SUPPORTED_EMU_PLATFORMS renode)
+set(RENODE_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/support/rm57lx_launchxl2.resc)
+set(RENODE_UART sysbus.sci1)
+set_ifndef(BOARD_SIM_RUNNER renode)
+
 include(${ZEPHYR_BASE}/boards/common/openocd.board.cmake)
+include(${ZEPHYR_BASE}/boards/common/renode.board.cmake)
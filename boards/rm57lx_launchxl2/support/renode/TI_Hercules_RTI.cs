@@ -0,0 +1,181 @@
+//
+// Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+//
+// Real Time Interrupt module of the TI Hercules RM57Lx.
+//
+// Both free running counters advance at RTICLK / (CPUCx + 1). Each compare runs
+// a timer that shadows its counter, so COMPx matches fire on time and are
+// reloaded from UDCPx. Compare x drives output x, wired to VIM requests 2-5.
+// Up counters read as zero, capture and the digital watchdog are not modelled.
+//
+using System.Collections.Generic;
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Logging;
+using Antmicro.Renode.Peripherals.Bus;
+
+namespace Antmicro.Renode.Peripherals.Timers
+{
+    public class TI_Hercules_RTI : IDoubleWordPeripheral, IKnownSize, INumberedGPIOOutput
+    {
+        public TI_Hercules_RTI(IMachine machine, long frequency)
+        {
+            registers = new uint[Size / 4];
+            var connections = new Dictionary<int, IGPIO>();
+
+            for(var c = 0; c < Counters; c++)
+            {
+                counters[c] = new ComparingTimer(machine.ClockSource, frequency, this,
+                                                 $"counter{c}", limit: uint.MaxValue,
+                                                 enabled: false);
+            }
+            for(var k = 0; k < Compares; k++)
+            {
+                var compare = k;
+
+                compares[k] = new ComparingTimer(machine.ClockSource, frequency, this,
+                                                 $"compare{k}", limit: uint.MaxValue,
+                                                 enabled: false, eventEnabled: true);
+                compares[k].CompareReached += () => OnCompare(compare);
+                connections[k] = new GPIO();
+            }
+            Connections = connections;
+            Reset();
+        }
+
+        public void Reset()
+        {
+            System.Array.Clear(registers, 0, registers.Length);
+            intEnable = 0;
+            intFlag = 0;
+            foreach(var timer in counters)
+            {
+                timer.Reset();
+            }
+            Resync();
+        }
+
+        public uint ReadDoubleWord(long offset)
+        {
+            switch(offset)
+            {
+            case Frc0:
+            case Frc1:
+                return (uint)counters[CounterOf(offset)].Value;
+            case Uc0:
+            case Uc1:
+                return 0;
+            case SetIntEna:
+            case ClearIntEna:
+                return intEnable;
+            case IntFlag:
+                return intFlag;
+            default:
+                return registers[offset / 4];
+            }
+        }
+
+        public void WriteDoubleWord(long offset, uint value)
+        {
+            switch(offset)
+            {
+            case Frc0:
+            case Frc1:
+                counters[CounterOf(offset)].Value = value;
+                break;
+            case Cpuc0:
+            case Cpuc1:
+                registers[offset / 4] = value;
+                // CPUCx = 0 divides by 2^32
+                counters[CounterOf(offset)].Divider = (value == 0) ? uint.MaxValue : value + 1;
+                break;
+            case SetIntEna:
+                intEnable |= value;
+                break;
+            case ClearIntEna:
+                intEnable &= ~value;
+                break;
+            case IntFlag:
+                intFlag &= ~value;
+                break;
+            default:
+                registers[offset / 4] = value;
+                break;
+            }
+            if(offset == GCtrl)
+            {
+                for(var c = 0; c < Counters; c++)
+                {
+                    counters[c].Enabled = (value & (1u << c)) != 0;
+                }
+            }
+            Resync();
+        }
+
+        public long Size => 0xC0;
+
+        public IReadOnlyDictionary<int, IGPIO> Connections { get; }
+
+        private static int CounterOf(long offset)
+        {
+            return (int)((offset - Frc0) / CounterStride);
+        }
+
+        private void OnCompare(int k)
+        {
+            var udcp = registers[(Comp0 + 8 * k + 4) / 4];
+
+            intFlag |= 1u << k;
+            registers[(Comp0 + 8 * k) / 4] += udcp;
+            compares[k].Compare = registers[(Comp0 + 8 * k) / 4];
+            Update();
+        }
+
+        // Keep every compare timer aligned with the counter selected in COMPCTRL
+        private void Resync()
+        {
+            for(var k = 0; k < Compares; k++)
+            {
+                var counter = counters[(registers[CompCtrl / 4] >> (4 * k)) & 1];
+
+                compares[k].Enabled = false;
+                compares[k].Divider = counter.Divider;
+                compares[k].Value = counter.Value;
+                compares[k].Compare = registers[(Comp0 + 8 * k) / 4];
+                compares[k].Enabled = counter.Enabled;
+            }
+            Update();
+        }
+
+        private void Update()
+        {
+            for(var k = 0; k < Compares; k++)
+            {
+                Connections[k].Set((intFlag & intEnable & (1u << k)) != 0);
+            }
+        }
+
+        private readonly uint[] registers;
+        private readonly ComparingTimer[] counters = new ComparingTimer[Counters];
+        private readonly ComparingTimer[] compares = new ComparingTimer[Compares];
+        private uint intEnable;
+        private uint intFlag;
+
+        private const int Counters = 2;
+        private const int Compares = 4;
+        private const long CounterStride = 0x20;
+
+        private const long GCtrl = 0x00;
+        private const long CompCtrl = 0x0C;
+        private const long Frc0 = 0x10;
+        private const long Uc0 = 0x14;
+        private const long Cpuc0 = 0x18;
+        private const long Frc1 = 0x30;
+        private const long Uc1 = 0x34;
+        private const long Cpuc1 = 0x38;
+        private const long Comp0 = 0x50;
+        private const long SetIntEna = 0x80;
+        private const long ClearIntEna = 0x84;
+        private const long IntFlag = 0x88;
+    }
+}
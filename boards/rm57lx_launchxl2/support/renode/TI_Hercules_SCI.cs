@@ -0,0 +1,197 @@
+//
+// Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+//
+// SCI/LIN UART of the TI Hercules RM57Lx, in SCI mode.
+//
+// Transmission is instantaneous, so TXRDY and TX EMPTY are always set. The
+// receive buffer is a FIFO (the hardware holds one character). INTVECT0
+// reports the receive and transmit interrupts, errors and DMA are not
+// modelled.
+//
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Peripherals.Bus;
+
+namespace Antmicro.Renode.Peripherals.UART
+{
+    public class TI_Hercules_SCI : UARTBase, IDoubleWordPeripheral, IKnownSize
+    {
+        public TI_Hercules_SCI(IMachine machine, long frequency) : base(machine)
+        {
+            this.frequency = frequency;
+            IRQ = new GPIO();
+            Reset();
+        }
+
+        public override void Reset()
+        {
+            base.Reset();
+            gcr1 = 0;
+            intEnable = 0;
+            brs = 0;
+            format = 0;
+            Update();
+        }
+
+        public uint ReadDoubleWord(long offset)
+        {
+            switch(offset)
+            {
+            case Gcr1:
+                return gcr1;
+            case SetInt:
+            case ClearInt:
+                return intEnable;
+            case Flr:
+                return Flags();
+            case IntVect0:
+                return Vector();
+            case Format:
+                return format;
+            case Brs:
+                return brs;
+            case Rd:
+                byte c;
+                var value = TryGetCharacter(out c) ? c : 0u;
+                Update();
+                return value;
+            default:
+                return 0;
+            }
+        }
+
+        public void WriteDoubleWord(long offset, uint value)
+        {
+            switch(offset)
+            {
+            case Gcr0:
+                if((value & 1) == 0)
+                {
+                    Reset();
+                }
+                break;
+            case Gcr1:
+                gcr1 = value;
+                break;
+            case SetInt:
+                intEnable |= value;
+                break;
+            case ClearInt:
+                intEnable &= ~value;
+                break;
+            case Format:
+                format = value;
+                break;
+            case Brs:
+                brs = value;
+                break;
+            case Td:
+                if((gcr1 & TxEna) != 0)
+                {
+                    TransmitCharacter((byte)value);
+                }
+                break;
+            }
+            Update();
+        }
+
+        public long Size => 0x40;
+
+        public GPIO IRQ { get; }
+
+        public override Bits StopBits => (gcr1 & Stop) != 0 ? Bits.Two : Bits.One;
+
+        public override Parity ParityBit
+        {
+            get
+            {
+                if((gcr1 & ParityEna) == 0)
+                {
+                    return Parity.None;
+                }
+                return (gcr1 & ParityEven) != 0 ? Parity.Even : Parity.Odd;
+            }
+        }
+
+        // Asynchronous timing mode: VCLK / (16 * (P + 1 + M / 16))
+        public override uint BaudRate
+        {
+            get
+            {
+                var divider = 16 * ((brs & 0xFFFFFF) + 1) + ((brs >> 24) & 0xF);
+                return (uint)(frequency / divider);
+            }
+        }
+
+        protected override void CharWritten()
+        {
+            Update();
+        }
+
+        protected override void QueueEmptied()
+        {
+            Update();
+        }
+
+        private uint Flags()
+        {
+            var flr = TxRdy | TxEmpty | Idle;
+
+            if(Count > 0)
+            {
+                flr |= RxRdy;
+            }
+            return flr;
+        }
+
+        private uint Vector()
+        {
+            var active = Flags() & intEnable;
+
+            if((active & RxRdy) != 0)
+            {
+                return VectRx;
+            }
+            if((active & TxRdy) != 0)
+            {
+                return VectTx;
+            }
+            return 0;
+        }
+
+        private void Update()
+        {
+            IRQ.Set(Vector() != 0);
+        }
+
+        private readonly long frequency;
+        private uint gcr1;
+        private uint intEnable;
+        private uint brs;
+        private uint format;
+
+        private const uint ParityEna = 1u << 2;
+        private const uint ParityEven = 1u << 3;
+        private const uint Stop = 1u << 4;
+        private const uint TxEna = 1u << 25;
+
+        private const uint Idle = 1u << 2;
+        private const uint TxRdy = 1u << 8;
+        private const uint RxRdy = 1u << 9;
+        private const uint TxEmpty = 1u << 11;
+
+        private const uint VectRx = 11;
+        private const uint VectTx = 12;
+
+        private const long Gcr0 = 0x00;
+        private const long Gcr1 = 0x04;
+        private const long SetInt = 0x0C;
+        private const long ClearInt = 0x10;
+        private const long Flr = 0x1C;
+        private const long IntVect0 = 0x20;
+        private const long Format = 0x28;
+        private const long Brs = 0x2C;
+        private const long Rd = 0x34;
+        private const long Td = 0x38;
+    }
+}
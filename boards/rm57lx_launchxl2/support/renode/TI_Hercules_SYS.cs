@@ -0,0 +1,106 @@
+//
+// Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+//
+// Primary system control registers (SYS1) of the TI Hercules RM57Lx.
+//
+// Clock sources are valid as soon as they are enabled and memory
+// initialization completes immediately. Status registers are write-1-to-clear
+// and the reset cause reads as power-on reset. Everything else is plain storage.
+//
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Peripherals.Bus;
+
+namespace Antmicro.Renode.Peripherals.Miscellaneous
+{
+    public class TI_Hercules_SYS : IDoubleWordPeripheral, IKnownSize
+    {
+        public TI_Hercules_SYS(uint deviceId = 0x8044AD05)
+        {
+            this.deviceId = deviceId;
+            registers = new uint[Size / 4];
+            Reset();
+        }
+
+        public void Reset()
+        {
+            System.Array.Clear(registers, 0, registers.Length);
+            registers[CsDis / 4] = CsDisReset;
+            registers[ClkCntl / 4] = ClkCntlReset;
+            registers[SysEsr / 4] = PowerOnReset;
+        }
+
+        public uint ReadDoubleWord(long offset)
+        {
+            switch(offset)
+            {
+            case CsDisSet:
+            case CsDisClr:
+                return registers[CsDis / 4];
+            case CdDisSet:
+            case CdDisClr:
+                return registers[CdDis / 4];
+            case CsvStat:
+                return ~registers[CsDis / 4] & SourceMask;
+            case MstcgStat:
+                return 0;
+            case DevId:
+                return deviceId;
+            default:
+                return registers[offset / 4];
+            }
+        }
+
+        public void WriteDoubleWord(long offset, uint value)
+        {
+            switch(offset)
+            {
+            case CsDisSet:
+                registers[CsDis / 4] |= value;
+                break;
+            case CsDisClr:
+                registers[CsDis / 4] &= ~value;
+                break;
+            case CdDisSet:
+                registers[CdDis / 4] |= value;
+                break;
+            case CdDisClr:
+                registers[CdDis / 4] &= ~value;
+                break;
+            case SysEsr:
+            case GblStat:
+                registers[offset / 4] &= ~value;
+                break;
+            case CsvStat:
+            case DevId:
+                break;
+            default:
+                registers[offset / 4] = value;
+                break;
+            }
+        }
+
+        public long Size => 0x100;
+
+        private readonly uint[] registers;
+        private readonly uint deviceId;
+
+        private const uint CsDisReset = 0xCE;
+        private const uint ClkCntlReset = 0x01010000;
+        private const uint PowerOnReset = 0x8000;
+        private const uint SourceMask = 0xFB;
+
+        private const long CsDis = 0x30;
+        private const long CsDisSet = 0x34;
+        private const long CsDisClr = 0x38;
+        private const long CdDis = 0x3C;
+        private const long CdDisSet = 0x40;
+        private const long CdDisClr = 0x44;
+        private const long CsvStat = 0x54;
+        private const long MstcgStat = 0x68;
+        private const long ClkCntl = 0xD0;
+        private const long SysEsr = 0xE4;
+        private const long GblStat = 0xEC;
+        private const long DevId = 0xF0;
+    }
+}
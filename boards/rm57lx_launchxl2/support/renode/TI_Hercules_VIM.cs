@@ -0,0 +1,188 @@
+//
+// Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+// SPDX-License-Identifier: Apache-2.0
+//
+// Vectored Interrupt Manager of the TI Hercules RM57Lx.
+//
+// Requests are level inputs numbered like the VIM request lines. CHANCTRL maps
+// requests onto channels, the lowest pending channel has the highest priority.
+// Channels flagged in FIRQPR drive the FIQ output, all others the IRQ output.
+// Zephyr reads IRQINDEX/FIQINDEX, the VIC port is not modelled.
+//
+using System.Collections.Generic;
+using Antmicro.Renode.Core;
+using Antmicro.Renode.Logging;
+using Antmicro.Renode.Peripherals.Bus;
+
+namespace Antmicro.Renode.Peripherals.IRQControllers
+{
+    public class TI_Hercules_VIM : IDoubleWordPeripheral, IKnownSize, IIRQController
+    {
+        public TI_Hercules_VIM()
+        {
+            IRQ = new GPIO();
+            FIQ = new GPIO();
+            registers = new uint[Size / 4];
+            Reset();
+        }
+
+        public void Reset()
+        {
+            System.Array.Clear(registers, 0, registers.Length);
+            System.Array.Clear(requests, 0, requests.Length);
+            System.Array.Clear(mask, 0, mask.Length);
+            for(var i = 0; i < Words; i++)
+            {
+                wake[i] = uint.MaxValue;
+            }
+            firq[0] = FiqOnly;
+            firq[1] = firq[2] = firq[3] = 0;
+            // Channel n serves request n out of reset
+            for(var ch = 0; ch < Channels; ch++)
+            {
+                channelRequest[ch] = ch;
+            }
+            Update();
+        }
+
+        public void OnGPIO(int number, bool value)
+        {
+            if(number < 0 || number >= Channels)
+            {
+                this.Log(LogLevel.Warning, "Request {0} out of range", number);
+                return;
+            }
+            requests[number] = value;
+            Update();
+        }
+
+        public uint ReadDoubleWord(long offset)
+        {
+            var word = (int)((offset & 0xF) >> 2);
+
+            switch(offset & ~0xFL)
+            {
+            case IrqIndex:
+                return Index(offset == FiqIndex);
+            case FirqPr:
+                return firq[word];
+            case IntReq:
+                return Pending(word);
+            case ReqMaskSet:
+            case ReqMaskClr:
+                return mask[word];
+            case WakeMaskSet:
+            case WakeMaskClr:
+                return wake[word];
+            default:
+                return registers[offset / 4];
+            }
+        }
+
+        public void WriteDoubleWord(long offset, uint value)
+        {
+            var word = (int)((offset & 0xF) >> 2);
+
+            switch(offset & ~0xFL)
+            {
+            case IrqIndex:
+                // Read only
+                return;
+            case FirqPr:
+                firq[word] = (word == 0) ? (value | FiqOnly) : value;
+                break;
+            case IntReq:
+                // Requests are levels, they stay pending until the peripheral drops them
+                break;
+            case ReqMaskSet:
+                mask[word] |= value;
+                break;
+            case ReqMaskClr:
+                mask[word] &= ~value;
+                break;
+            case WakeMaskSet:
+                wake[word] |= value;
+                break;
+            case WakeMaskClr:
+                wake[word] &= ~value;
+                break;
+            default:
+                registers[offset / 4] = value;
+                if(offset >= ChanCtrl && offset < ChanCtrl + Channels)
+                {
+                    // Four channels per word, the lowest channel in the top byte
+                    var first = (int)(offset - ChanCtrl);
+                    for(var i = 0; i < 4; i++)
+                    {
+                        channelRequest[first + i] = (int)((value >> (24 - 8 * i)) & 0x7F);
+                    }
+                }
+                break;
+            }
+            Update();
+        }
+
+        public long Size => 0x200;
+
+        public GPIO IRQ { get; }
+        public GPIO FIQ { get; }
+
+        private uint Pending(int word)
+        {
+            var pending = 0u;
+
+            for(var bit = 0; bit < 32; bit++)
+            {
+                if(requests[channelRequest[word * 32 + bit]])
+                {
+                    pending |= 1u << bit;
+                }
+            }
+            return pending;
+        }
+
+        private uint Index(bool fiq)
+        {
+            for(var word = 0; word < Words; word++)
+            {
+                var active = Pending(word) & mask[word] & (fiq ? firq[word] : ~firq[word]);
+
+                for(var bit = 0; bit < 32; bit++)
+                {
+                    if((active & (1u << bit)) != 0)
+                    {
+                        return (uint)(word * 32 + bit + 1);
+                    }
+                }
+            }
+            return 0;
+        }
+
+        private void Update()
+        {
+            IRQ.Set(Index(false) != 0);
+            FIQ.Set(Index(true) != 0);
+        }
+
+        private readonly uint[] registers;
+        private readonly bool[] requests = new bool[Channels];
+        private readonly int[] channelRequest = new int[Channels];
+        private readonly uint[] mask = new uint[Words];
+        private readonly uint[] wake = new uint[Words];
+        private readonly uint[] firq = new uint[Words];
+
+        private const int Channels = 128;
+        private const int Words = Channels / 32;
+        private const uint FiqOnly = 0x3;
+
+        private const long IrqIndex = 0x100;
+        private const long FiqIndex = 0x104;
+        private const long FirqPr = 0x110;
+        private const long IntReq = 0x120;
+        private const long ReqMaskSet = 0x130;
+        private const long ReqMaskClr = 0x140;
+        private const long WakeMaskSet = 0x150;
+        private const long WakeMaskClr = 0x160;
+        private const long ChanCtrl = 0x180;
+    }
+}
@@ -0,0 +1,690 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_mibadc
+
+#include <soc.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/drivers/adc/ti_hercules_mibadc.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/dt-bindings/timer/ti-hercules-rti-timer.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(adc_ti_hercules_mibadc, CONFIG_ADC_LOG_LEVEL);
+
+#define ADC_CONTEXT_USES_KERNEL_TIMER
+#include "adc_context.h"
+
+#define ADC_GROUPS     3U
+#define ADC_RESOLUTION 12U
+/* ADCLK may not exceed 30 MHz */
+#define ADC_CLK_MAX_HZ 30000000U
+
+/* Result RAM split in words: event group, group 1, group 2 */
+#define ADC_FIFO_EVENT 16U
+#define ADC_FIFO_G1    32U
+#define ADC_FIFO_G2    16U
+/* 64 result words */
+#define ADC_BNDEND_64  2U
+
+#define ADC_OPMODECR_ADC_EN BIT(0)
+#define ADC_OPMODECR_12BIT  BIT(31)
+
+#define ADC_MODECR_CONT    BIT(1)
+#define ADC_MODECR_HW_TRIG BIT(3)
+#define ADC_MODECR_CHID    BIT(5)
+
+#define ADC_SRC_EDG_SEL BIT(3)
+#define ADC_SRC_MASK    GENMASK(2, 0)
+
+#define ADC_INT_THR BIT(0)
+#define ADC_INT_OVR BIT(1)
+#define ADC_INT_END BIT(3)
+
+#define ADC_DMACR_DMA_EN BIT(0)
+
+#define ADC_SAMP_MIN  2U
+#define ADC_SAMP_MASK 0xFFFU
+
+#define ADC_BUF_EMPTY BIT(31)
+
+#define RTI_NODE DT_NODELABEL(rti)
+
+#define DEV_CFG(dev)  ((const struct adc_ti_hercules_mibadc_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct adc_ti_hercules_mibadc_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_mibadc_regs *)DEV_CFG(dev)->base)
+
+struct hercules_mibadc_regs {
+	uint32_t RSTCR;            /* 0x000 */
+	uint32_t OPMODECR;         /* 0x004 */
+	uint32_t CLOCKCR;          /* 0x008 */
+	uint32_t CALCR;            /* 0x00C */
+	uint32_t GxMODECR[3];      /* 0x010 */
+	uint32_t GxSRC[3];         /* 0x01C */
+	uint32_t GxINTENA[3];      /* 0x028 */
+	uint32_t GxINTFLG[3];      /* 0x034 */
+	uint32_t GxINTCR[3];       /* 0x040 */
+	uint32_t GxDMACR[3];       /* 0x04C */
+	uint32_t BNDCR;            /* 0x058 */
+	uint32_t BNDEND;           /* 0x05C */
+	uint32_t GxSAMP[3];        /* 0x060 */
+	uint32_t GxSR[3];          /* 0x06C */
+	uint32_t GxSEL[3];         /* 0x078 */
+	uint32_t CALR;             /* 0x084 */
+	uint32_t SMSTATE;          /* 0x088 */
+	uint32_t LASTCONV;         /* 0x08C */
+	struct {
+		uint32_t BUF[8];
+	} GxBUF[3];                /* 0x090 */
+	uint32_t GxEMUBUFFER[3];   /* 0x0F0 */
+	uint32_t EVTDIR;           /* 0x0FC */
+	uint32_t EVTOUT;           /* 0x100 */
+	uint32_t EVTIN;            /* 0x104 */
+	uint32_t EVTSET;           /* 0x108 */
+	uint32_t EVTCLR;           /* 0x10C */
+	uint32_t EVTPDR;           /* 0x110 */
+	uint32_t EVTDIS;           /* 0x114 */
+	uint32_t EVTPSEL;          /* 0x118 */
+	uint32_t GxSAMPDISEN[3];   /* 0x11C */
+	uint32_t MAGINTCR[6];      /* 0x128 */
+	uint32_t RESERVED1[6];     /* 0x140 */
+	uint32_t MAGTHRINTENASET;  /* 0x158 */
+	uint32_t MAGTHRINTENACLR;  /* 0x15C */
+	uint32_t MAGTHRINTFLG;     /* 0x160 */
+	uint32_t MAGTHRINTOFFSET;  /* 0x164 */
+	uint32_t GxFIFORESETCR[3]; /* 0x168 */
+	uint32_t GxRAMADDR[3];     /* 0x174 */
+	uint32_t PARCR;            /* 0x180 */
+	uint32_t PARADDR;          /* 0x184 */
+	uint32_t PWRUPDLYCTRL;     /* 0x188 */
+};
+
+#ifdef CONFIG_DMA_TI_HERCULES
+struct adc_ti_hercules_mibadc_dma {
+	const struct device *dev;
+	uint32_t channel;
+	uint32_t slot;
+};
+#endif
+
+struct adc_ti_hercules_mibadc_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	uint8_t channels;
+	void (*irq_config_func)(const struct device *dev);
+#ifdef CONFIG_DMA_TI_HERCULES
+	struct adc_ti_hercules_mibadc_dma dma[ADC_GROUPS];
+#endif
+};
+
+struct adc_ti_hercules_mibadc_stream {
+	const struct device *dev;
+	struct ti_hercules_mibadc_stream_cfg cfg;
+	enum ti_hercules_mibadc_group group;
+	/* Offset of the block being filled */
+	size_t pos;
+	bool active;
+};
+
+struct adc_ti_hercules_mibadc_data {
+	struct adc_context ctx;
+	const struct device *dev;
+	struct k_spinlock lock;
+	uint32_t adclk;
+	uint32_t configured;
+	uint16_t acq[32];
+	uint16_t *buffer;
+	uint16_t *repeat_buffer;
+	struct adc_ti_hercules_mibadc_stream streams[ADC_GROUPS];
+};
+
+static const uint8_t adc_fifo_depth[ADC_GROUPS] = {ADC_FIFO_EVENT, ADC_FIFO_G1, ADC_FIFO_G2};
+
+/*
+ * Blocks are stamped when their interrupt (or DMA completion) is serviced, so
+ * the stamp trails the last conversion of the block by the interrupt latency.
+ */
+static inline uint32_t adc_timestamp(void)
+{
+	return ((volatile struct hercules_rti_regs *)DT_REG_ADDR(RTI_NODE))->CNT[0].FRCx;
+}
+
+/* The sample window is shared by a group, so the slowest channel sets it. */
+static uint32_t adc_group_samp(struct adc_ti_hercules_mibadc_data *data, uint32_t channels)
+{
+	uint32_t samp = 0;
+
+	while (channels != 0U) {
+		uint32_t ch = find_lsb_set(channels) - 1U;
+
+		samp = MAX(samp, data->acq[ch]);
+		channels &= ~BIT(ch);
+	}
+	return samp;
+}
+
+static int adc_ti_hercules_mibadc_channel_setup(const struct device *dev,
+						const struct adc_channel_cfg *channel_cfg)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	uint32_t value = ADC_ACQ_TIME_VALUE(channel_cfg->acquisition_time);
+	uint64_t ticks;
+
+	if (channel_cfg->channel_id >= DEV_CFG(dev)->channels) {
+		return -EINVAL;
+	}
+	if (channel_cfg->gain != ADC_GAIN_1 || channel_cfg->reference != ADC_REF_EXTERNAL0 ||
+	    channel_cfg->differential) {
+		return -ENOTSUP;
+	}
+
+	switch (ADC_ACQ_TIME_UNIT(channel_cfg->acquisition_time)) {
+	case ADC_ACQ_TIME_TICKS:
+		ticks = value;
+		break;
+	case ADC_ACQ_TIME_MICROSECONDS:
+		ticks = DIV_ROUND_UP((uint64_t)value * data->adclk, USEC_PER_SEC);
+		break;
+	case ADC_ACQ_TIME_NANOSECONDS:
+		ticks = DIV_ROUND_UP((uint64_t)value * data->adclk, NSEC_PER_SEC);
+		break;
+	default:
+		return -EINVAL;
+	}
+	/* The sample window is GxSAMP + 2 ADCLK cycles */
+	ticks = MAX(ticks, ADC_SAMP_MIN);
+	if (ticks - ADC_SAMP_MIN > ADC_SAMP_MASK) {
+		return -EINVAL;
+	}
+
+	data->acq[channel_cfg->channel_id] = ticks - ADC_SAMP_MIN;
+	data->configured |= BIT(channel_cfg->channel_id);
+	return 0;
+}
+
+static void adc_context_start_sampling(struct adc_context *ctx)
+{
+	struct adc_ti_hercules_mibadc_data *data =
+		CONTAINER_OF(ctx, struct adc_ti_hercules_mibadc_data, ctx);
+
+	data->repeat_buffer = data->buffer;
+	/* Selecting channels starts a software triggered group 1 conversion */
+	DEV_REGS(data->dev)->GxSEL[TI_HERCULES_MIBADC_GROUP_1] = ctx->sequence.channels;
+}
+
+static void adc_context_update_buffer_pointer(struct adc_context *ctx, bool repeat_sampling)
+{
+	struct adc_ti_hercules_mibadc_data *data =
+		CONTAINER_OF(ctx, struct adc_ti_hercules_mibadc_data, ctx);
+
+	if (repeat_sampling) {
+		data->buffer = data->repeat_buffer;
+	}
+}
+
+static int adc_ti_hercules_mibadc_start_read(const struct device *dev,
+					     const struct adc_sequence *sequence)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	uint32_t count = POPCOUNT(sequence->channels);
+	size_t needed = count * sizeof(uint16_t);
+
+	if (sequence->resolution != ADC_RESOLUTION) {
+		return -EINVAL;
+	}
+	if (sequence->oversampling != 0U) {
+		return -ENOTSUP;
+	}
+	if (count == 0U || count > ADC_FIFO_G1 || (sequence->channels & ~data->configured) != 0U) {
+		return -EINVAL;
+	}
+	if (sequence->options != NULL) {
+		needed *= 1U + sequence->options->extra_samplings;
+	}
+	if (sequence->buffer_size < needed) {
+		return -ENOMEM;
+	}
+
+	DEV_REGS(dev)->GxSAMP[TI_HERCULES_MIBADC_GROUP_1] =
+		adc_group_samp(data, sequence->channels);
+	data->buffer = sequence->buffer;
+	adc_context_start_read(&data->ctx, sequence);
+
+	return adc_context_wait_for_completion(&data->ctx);
+}
+
+static int adc_ti_hercules_mibadc_read(const struct device *dev,
+				       const struct adc_sequence *sequence)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	int ret;
+
+	adc_context_lock(&data->ctx, false, NULL);
+	ret = adc_ti_hercules_mibadc_start_read(dev, sequence);
+	adc_context_release(&data->ctx, ret);
+
+	return ret;
+}
+
+#ifdef CONFIG_ADC_ASYNC
+static int adc_ti_hercules_mibadc_read_async(const struct device *dev,
+					     const struct adc_sequence *sequence,
+					     struct k_poll_signal *async)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	int ret;
+
+	adc_context_lock(&data->ctx, true, async);
+	ret = adc_ti_hercules_mibadc_start_read(dev, sequence);
+	adc_context_release(&data->ctx, ret);
+
+	return ret;
+}
+#endif
+
+static void adc_ti_hercules_mibadc_g1_isr(const struct device *dev)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibadc_regs *regs = DEV_REGS(dev);
+	uint32_t count;
+
+	if ((regs->GxINTFLG[TI_HERCULES_MIBADC_GROUP_1] & ADC_INT_END) == 0U) {
+		return;
+	}
+	regs->GxINTFLG[TI_HERCULES_MIBADC_GROUP_1] = ADC_INT_END;
+
+	/* Results come out of the FIFO in ascending channel order */
+	count = POPCOUNT(data->ctx.sequence.channels);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t word = regs->GxBUF[TI_HERCULES_MIBADC_GROUP_1].BUF[0];
+
+		if ((word & ADC_BUF_EMPTY) != 0U) {
+			/* The group ended without converting every channel */
+			regs->GxFIFORESETCR[TI_HERCULES_MIBADC_GROUP_1] = 1;
+			if (data->ctx.options.interval_us != 0U) {
+				adc_context_disable_timer(&data->ctx);
+			}
+			adc_context_complete(&data->ctx, -EIO);
+			return;
+		}
+		data->buffer[i] = word & 0xFFFU;
+	}
+	data->buffer += count;
+
+	adc_context_on_sampling_done(&data->ctx, dev);
+}
+
+static void adc_ti_hercules_mibadc_stream_isr(const struct device *dev,
+					      enum ti_hercules_mibadc_group group)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibadc_regs *regs = DEV_REGS(dev);
+	struct adc_ti_hercules_mibadc_stream *stream = &data->streams[group];
+	uint32_t flags = regs->GxINTFLG[group];
+	uint32_t *dst = NULL;
+	size_t count = 0;
+	k_spinlock_key_t key;
+
+	/* END is set after every conversion sequence, acknowledge it so it does not stay set */
+	if ((flags & ADC_INT_END) != 0U) {
+		regs->GxINTFLG[group] = ADC_INT_END;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (!stream->active) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	if ((flags & ADC_INT_OVR) != 0U) {
+		/* Flushing the FIFO also clears the overrun flag */
+		regs->GxFIFORESETCR[group] = 1;
+	} else if ((flags & ADC_INT_THR) != 0U) {
+		dst = &stream->cfg.buffer[stream->pos];
+
+		/* Reading results back raises the threshold counter again */
+		while (count < stream->cfg.block) {
+			uint32_t word = regs->GxBUF[group].BUF[0];
+
+			if ((word & ADC_BUF_EMPTY) != 0U) {
+				break;
+			}
+			dst[count++] = word;
+		}
+		regs->GxINTFLG[group] = ADC_INT_THR;
+		if (count == stream->cfg.block) {
+			stream->pos = (stream->pos + count) % stream->cfg.buffer_len;
+		} else {
+			/* Never hand out a partial block, report it as lost */
+			regs->GxFIFORESETCR[group] = 1;
+			dst = NULL;
+			count = 0;
+		}
+	} else {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+	k_spin_unlock(&data->lock, key);
+
+	stream->cfg.callback(dev, group, dst, count, adc_timestamp(), stream->cfg.user_data);
+}
+
+static void adc_ti_hercules_mibadc_event_isr(const struct device *dev)
+{
+	adc_ti_hercules_mibadc_stream_isr(dev, TI_HERCULES_MIBADC_GROUP_EVENT);
+}
+
+static void adc_ti_hercules_mibadc_g2_isr(const struct device *dev)
+{
+	adc_ti_hercules_mibadc_stream_isr(dev, TI_HERCULES_MIBADC_GROUP_2);
+}
+
+#ifdef CONFIG_DMA_TI_HERCULES
+static void adc_ti_hercules_mibadc_dma_done(const struct device *dma_dev, void *user_data,
+					    uint32_t channel, int status)
+{
+	struct adc_ti_hercules_mibadc_stream *stream = user_data;
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(stream->dev);
+	size_t len = stream->cfg.buffer_len;
+	size_t block = stream->cfg.block;
+	k_spinlock_key_t key;
+	uint32_t *done;
+
+	/* Serialised against ti_hercules_mibadc_stream_stop() */
+	key = k_spin_lock(&data->lock);
+	if (!stream->active) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	/*
+	 * The channel has already auto-initiated into the next block, queue the
+	 * one after it so the DMA never waits on the CPU.
+	 */
+	done = &stream->cfg.buffer[stream->pos];
+	stream->pos = (stream->pos + block) % len;
+	(void)dma_reload(dma_dev, channel,
+			 (uint32_t)&DEV_REGS(stream->dev)->GxBUF[stream->group].BUF[0],
+			 (uint32_t)&stream->cfg.buffer[(stream->pos + block) % len],
+			 block * sizeof(uint32_t));
+	k_spin_unlock(&data->lock, key);
+
+	sys_cache_data_invd_range(done, block * sizeof(uint32_t));
+	stream->cfg.callback(stream->dev, stream->group, done, block, adc_timestamp(),
+			     stream->cfg.user_data);
+}
+
+static int adc_ti_hercules_mibadc_stream_dma(const struct device *dev,
+					     struct adc_ti_hercules_mibadc_stream *stream)
+{
+	const struct adc_ti_hercules_mibadc_dma *dma = &DEV_CFG(dev)->dma[stream->group];
+	struct dma_block_config block = {
+		.source_address = (uint32_t)&DEV_REGS(dev)->GxBUF[stream->group].BUF[0],
+		.dest_address = (uint32_t)stream->cfg.buffer,
+		.block_size = stream->cfg.block * sizeof(uint32_t),
+		.source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE,
+		.dest_addr_adj = DMA_ADDR_ADJ_INCREMENT,
+	};
+	struct dma_config dma_cfg = {
+		.dma_slot = dma->slot,
+		.channel_direction = PERIPHERAL_TO_MEMORY,
+		.cyclic = 1,
+		.source_data_size = sizeof(uint32_t),
+		.dest_data_size = sizeof(uint32_t),
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &block,
+		.dma_callback = adc_ti_hercules_mibadc_dma_done,
+		.user_data = stream,
+	};
+	int ret;
+
+	sys_cache_data_invd_range(stream->cfg.buffer, stream->cfg.buffer_len * sizeof(uint32_t));
+	ret = dma_config(dma->dev, dma->channel, &dma_cfg);
+	if (ret == 0) {
+		ret = dma_start(dma->dev, dma->channel);
+	}
+	if (ret == 0) {
+		/* Second block, loaded when the first one completes */
+		ret = dma_reload(dma->dev, dma->channel, block.source_address,
+				 (uint32_t)&stream->cfg.buffer[stream->cfg.block],
+				 block.block_size);
+	}
+	return ret;
+}
+#endif
+
+static bool adc_ti_hercules_mibadc_has_dma(const struct device *dev,
+					   enum ti_hercules_mibadc_group group)
+{
+#ifdef CONFIG_DMA_TI_HERCULES
+	return DEV_CFG(dev)->dma[group].dev != NULL;
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(group);
+	return false;
+#endif
+}
+
+int ti_hercules_mibadc_stream_start(const struct device *dev, enum ti_hercules_mibadc_group group,
+				    const struct ti_hercules_mibadc_stream_cfg *cfg)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibadc_regs *regs = DEV_REGS(dev);
+	struct adc_ti_hercules_mibadc_stream *stream;
+	bool use_dma = adc_ti_hercules_mibadc_has_dma(dev, group);
+	uint32_t mode = ADC_MODECR_CHID;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (group == TI_HERCULES_MIBADC_GROUP_1 || group >= ADC_GROUPS) {
+		return -EINVAL;
+	}
+	if (cfg->channels == 0U || (cfg->channels & ~data->configured) != 0U ||
+	    cfg->callback == NULL || cfg->block == 0U || cfg->buffer_len % cfg->block != 0U ||
+	    cfg->buffer_len / cfg->block < 2U) {
+		return -EINVAL;
+	}
+	if (!use_dma && cfg->block > adc_fifo_depth[group]) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+	stream = &data->streams[group];
+	if (stream->active) {
+		k_spin_unlock(&data->lock, key);
+		return -EBUSY;
+	}
+	stream->dev = dev;
+	stream->group = group;
+	stream->cfg = *cfg;
+	stream->pos = 0;
+	stream->active = true;
+
+	/* The event group is always hardware triggered */
+	if (group != TI_HERCULES_MIBADC_GROUP_EVENT) {
+		mode |= ADC_MODECR_HW_TRIG;
+	}
+	if (cfg->continuous) {
+		mode |= ADC_MODECR_CONT;
+	}
+	regs->GxSEL[group] = 0;
+	regs->GxMODECR[group] = mode;
+	regs->GxSRC[group] =
+		(cfg->trigger & ADC_SRC_MASK) | (cfg->rising_edge ? ADC_SRC_EDG_SEL : 0U);
+	regs->GxSAMP[group] = adc_group_samp(data, cfg->channels);
+	regs->GxFIFORESETCR[group] = 1;
+	regs->GxINTFLG[group] = ADC_INT_THR | ADC_INT_END;
+
+	if (use_dma) {
+#ifdef CONFIG_DMA_TI_HERCULES
+		ret = adc_ti_hercules_mibadc_stream_dma(dev, stream);
+#endif
+		regs->GxDMACR[group] = ADC_DMACR_DMA_EN;
+		regs->GxINTENA[group] = ADC_INT_OVR;
+	} else {
+		regs->GxINTCR[group] = cfg->block;
+		regs->GxINTENA[group] = ADC_INT_THR | ADC_INT_OVR;
+	}
+
+	if (ret == 0) {
+		/* Arms the group, conversions start on the next trigger */
+		regs->GxSEL[group] = cfg->channels;
+	} else {
+		regs->GxDMACR[group] = 0;
+		regs->GxINTENA[group] = 0;
+		stream->active = false;
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+int ti_hercules_mibadc_stream_stop(const struct device *dev, enum ti_hercules_mibadc_group group)
+{
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibadc_regs *regs = DEV_REGS(dev);
+	k_spinlock_key_t key;
+
+	if (group >= ADC_GROUPS) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (!data->streams[group].active) {
+		k_spin_unlock(&data->lock, key);
+		return -EINVAL;
+	}
+	data->streams[group].active = false;
+	regs->GxSEL[group] = 0;
+	regs->GxINTENA[group] = 0;
+	regs->GxDMACR[group] = 0;
+#ifdef CONFIG_DMA_TI_HERCULES
+	if (adc_ti_hercules_mibadc_has_dma(dev, group)) {
+		(void)dma_stop(DEV_CFG(dev)->dma[group].dev, DEV_CFG(dev)->dma[group].channel);
+	}
+#endif
+	regs->GxFIFORESETCR[group] = 1;
+	k_spin_unlock(&data->lock, key);
+
+	return 0;
+}
+
+static int adc_ti_hercules_mibadc_init(const struct device *dev)
+{
+	const struct adc_ti_hercules_mibadc_config *cfg = DEV_CFG(dev);
+	struct adc_ti_hercules_mibadc_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibadc_regs *regs = DEV_REGS(dev);
+	uint32_t rate, div;
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &rate);
+	if (ret != 0) {
+		return ret;
+	}
+#ifdef CONFIG_DMA_TI_HERCULES
+	for (size_t i = 0; i < ADC_GROUPS; i++) {
+		if (cfg->dma[i].dev != NULL && !device_is_ready(cfg->dma[i].dev)) {
+			return -ENODEV;
+		}
+	}
+#endif
+
+	data->dev = dev;
+	div = DIV_ROUND_UP(rate, ADC_CLK_MAX_HZ);
+	data->adclk = rate / div;
+
+	regs->RSTCR = 1;
+	regs->RSTCR = 0;
+	regs->OPMODECR = ADC_OPMODECR_12BIT;
+	regs->CLOCKCR = div - 1U;
+
+	/* Boundaries count pairs of result words */
+	regs->BNDCR = ((ADC_FIFO_EVENT / 2U) << 16) | ((ADC_FIFO_EVENT + ADC_FIFO_G1) / 2U);
+	regs->BNDEND = (regs->BNDEND & ~GENMASK(2, 0)) | ADC_BNDEND_64;
+
+	for (size_t i = 0; i < ADC_GROUPS; i++) {
+		regs->GxSEL[i] = 0;
+		regs->GxMODECR[i] = 0;
+		regs->GxINTENA[i] = 0;
+		regs->GxDMACR[i] = 0;
+		regs->GxFIFORESETCR[i] = 1;
+	}
+	regs->GxINTENA[TI_HERCULES_MIBADC_GROUP_1] = ADC_INT_END;
+	regs->OPMODECR |= ADC_OPMODECR_ADC_EN;
+
+	cfg->irq_config_func(dev);
+	adc_context_unlock_unconditionally(&data->ctx);
+
+	return 0;
+}
+
+static DEVICE_API(adc, adc_ti_hercules_mibadc_api) = {
+	.channel_setup = adc_ti_hercules_mibadc_channel_setup,
+	.read = adc_ti_hercules_mibadc_read,
+#ifdef CONFIG_ADC_ASYNC
+	.read_async = adc_ti_hercules_mibadc_read_async,
+#endif
+};
+
+#ifdef CONFIG_DMA_TI_HERCULES
+#define ADC_TI_HERCULES_MIBADC_DMA(n, name)                                                        \
+	COND_CODE_1(DT_INST_DMAS_HAS_NAME(n, name),                                                \
+		({                                                                                 \
+			.dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(n, name)),                  \
+			.channel = DT_INST_DMAS_CELL_BY_NAME(n, name, channel),                    \
+			.slot = DT_INST_DMAS_CELL_BY_NAME(n, name, slot),                          \
+		}),                                                                                \
+		({0}))
+#define ADC_TI_HERCULES_MIBADC_DMAS(n)                                                             \
+	.dma = {ADC_TI_HERCULES_MIBADC_DMA(n, event), {0}, ADC_TI_HERCULES_MIBADC_DMA(n, group2)},
+#else
+#define ADC_TI_HERCULES_MIBADC_DMAS(n)
+#endif
+
+#define ADC_TI_HERCULES_MIBADC_IRQ(n, name, isr)                                                   \
+	IRQ_CONNECT(DT_INST_IRQ_BY_NAME(n, name, irq), DT_INST_IRQ_BY_NAME(n, name, priority),     \
+		    isr, DEVICE_DT_INST_GET(n), DT_INST_IRQ_BY_NAME(n, name, type));               \
+	irq_enable(DT_INST_IRQ_BY_NAME(n, name, irq));
+
+#define ADC_TI_HERCULES_MIBADC_INIT(n)                                                             \
+	static void adc_ti_hercules_mibadc_irq_config_##n(const struct device *dev)                \
+	{                                                                                          \
+		ADC_TI_HERCULES_MIBADC_IRQ(n, event, adc_ti_hercules_mibadc_event_isr)             \
+		ADC_TI_HERCULES_MIBADC_IRQ(n, group1, adc_ti_hercules_mibadc_g1_isr)               \
+		ADC_TI_HERCULES_MIBADC_IRQ(n, group2, adc_ti_hercules_mibadc_g2_isr)               \
+	}                                                                                          \
+	static const struct adc_ti_hercules_mibadc_config adc_ti_hercules_mibadc_config_##n = {   \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.channels = DT_INST_PROP(n, channel_count),                                        \
+		.irq_config_func = adc_ti_hercules_mibadc_irq_config_##n,                          \
+		ADC_TI_HERCULES_MIBADC_DMAS(n)};                                                   \
+	static struct adc_ti_hercules_mibadc_data adc_ti_hercules_mibadc_data_##n = {              \
+		ADC_CONTEXT_INIT_TIMER(adc_ti_hercules_mibadc_data_##n, ctx),                      \
+		ADC_CONTEXT_INIT_LOCK(adc_ti_hercules_mibadc_data_##n, ctx),                       \
+		ADC_CONTEXT_INIT_SYNC(adc_ti_hercules_mibadc_data_##n, ctx),                       \
+	};                                                                                         \
+	DEVICE_DT_INST_DEFINE(n, adc_ti_hercules_mibadc_init, NULL,                                \
+			      &adc_ti_hercules_mibadc_data_##n,                                    \
+			      &adc_ti_hercules_mibadc_config_##n, POST_KERNEL,                     \
+			      CONFIG_ADC_INIT_PRIORITY, &adc_ti_hercules_mibadc_api);
+
+DT_INST_FOREACH_STATUS_OKAY(ADC_TI_HERCULES_MIBADC_INIT)
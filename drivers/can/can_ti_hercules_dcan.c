@@ -0,0 +1,850 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_dcan
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/can.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(can_ti_hercules_dcan, CONFIG_CAN_LOG_LEVEL);
+
+#define DCAN_MSG_OBJECTS 64U
+#define DCAN_TX_OBJECTS  CONFIG_CAN_TI_HERCULES_DCAN_TX_MAILBOXES
+#define DCAN_RX_DEPTH    CONFIG_CAN_TI_HERCULES_DCAN_RX_FIFO_DEPTH
+#define DCAN_RX_FIRST    (DCAN_TX_OBJECTS + 1U)
+#define DCAN_MAX_FILTERS ((DCAN_MSG_OBJECTS - DCAN_TX_OBJECTS) / DCAN_RX_DEPTH)
+
+BUILD_ASSERT(DCAN_MAX_FILTERS > 0, "No message objects left for receive filters");
+
+#define DCAN_CTL_INIT  BIT(0)
+#define DCAN_CTL_IE0   BIT(1)
+#define DCAN_CTL_SIE   BIT(2)
+#define DCAN_CTL_EIE   BIT(3)
+#define DCAN_CTL_DAR   BIT(5)
+#define DCAN_CTL_CCE   BIT(6)
+#define DCAN_CTL_TEST  BIT(7)
+#define DCAN_CTL_ABO   BIT(9)
+#define DCAN_CTL_SWR   BIT(15)
+
+#define DCAN_ES_LEC_MASK 0x7U
+#define DCAN_ES_EPASS    BIT(5)
+#define DCAN_ES_EWARN    BIT(6)
+#define DCAN_ES_BOFF     BIT(7)
+
+#define DCAN_ERRC_TEC(v) ((v) & 0xFFU)
+#define DCAN_ERRC_REC(v) (((v) >> 8) & 0x7FU)
+
+#define DCAN_BTR(brp, sjw, tseg1, tseg2)                                                           \
+	((((brp) & 0x3FU)) | (((sjw) & 0x3U) << 6) | (((tseg1) & 0xFU) << 8) |                     \
+	 (((tseg2) & 0x7U) << 12) | ((((brp) >> 6) & 0xFU) << 16))
+
+#define DCAN_TEST_SILENT BIT(3)
+#define DCAN_TEST_LBACK  BIT(4)
+
+#define DCAN_INT_STATUS 0x8000U
+
+#define DCAN_IFCMD_BUSY     BIT(15)
+#define DCAN_IFCMD_DATAB    BIT(16)
+#define DCAN_IFCMD_DATAA    BIT(17)
+#define DCAN_IFCMD_NEWDAT   BIT(18)
+#define DCAN_IFCMD_CLRINT   BIT(19)
+#define DCAN_IFCMD_CONTROL  BIT(20)
+#define DCAN_IFCMD_ARB      BIT(21)
+#define DCAN_IFCMD_MASK     BIT(22)
+#define DCAN_IFCMD_WR       BIT(23)
+#define DCAN_IFCMD_ALL                                                                             \
+	(DCAN_IFCMD_DATAB | DCAN_IFCMD_DATAA | DCAN_IFCMD_CONTROL | DCAN_IFCMD_ARB |               \
+	 DCAN_IFCMD_MASK)
+#define DCAN_IFCMD_INVALIDATE                                                                      \
+	(DCAN_IFCMD_WR | DCAN_IFCMD_ARB | DCAN_IFCMD_CONTROL | DCAN_IFCMD_CLRINT)
+
+#define DCAN_IFMSK_MDIR BIT(30)
+#define DCAN_IFMSK_MXTD BIT(31)
+
+#define DCAN_IFARB_DIR    BIT(29)
+#define DCAN_IFARB_XTD    BIT(30)
+#define DCAN_IFARB_MSGVAL BIT(31)
+#define DCAN_ID_STD_SHIFT 18U
+
+#define DCAN_IFMCTL_DLC(v)  ((v) & 0xFU)
+#define DCAN_IFMCTL_EOB     BIT(7)
+#define DCAN_IFMCTL_TXRQST  BIT(8)
+#define DCAN_IFMCTL_RXIE    BIT(10)
+#define DCAN_IFMCTL_TXIE    BIT(11)
+#define DCAN_IFMCTL_UMASK   BIT(12)
+#define DCAN_IFMCTL_MSGLST  BIT(14)
+#define DCAN_IFMCTL_NEWDAT  BIT(15)
+
+#define DCAN_IOC_FUNC BIT(3)
+
+struct hercules_dcan_if_regs {
+	uint32_t CMD;  /* 0x0000 */
+	uint32_t MSK;  /* 0x0004 */
+	uint32_t ARB;  /* 0x0008 */
+	uint32_t MCTL; /* 0x000C */
+	uint32_t DATA; /* 0x0010 */
+	uint32_t DATB; /* 0x0014 */
+	uint32_t rsvd[2];
+};
+
+struct hercules_dcan_regs {
+	uint32_t CTL;         /* 0x0000 */
+	uint32_t ES;          /* 0x0004 */
+	uint32_t ERRC;        /* 0x0008 */
+	uint32_t BTR;         /* 0x000C */
+	uint32_t INT;         /* 0x0010 */
+	uint32_t TEST;        /* 0x0014 */
+	uint32_t rsvd1;       /* 0x0018 */
+	uint32_t PERR;        /* 0x001C */
+	uint32_t rsvd2[24];   /* 0x0020 */
+	uint32_t ABOTR;       /* 0x0080 */
+	uint32_t TXRQX;       /* 0x0084 */
+	uint32_t TXRQ[4];     /* 0x0088 */
+	uint32_t NWDATX;      /* 0x0098 */
+	uint32_t NWDAT[4];    /* 0x009C */
+	uint32_t INTPNDX;     /* 0x00AC */
+	uint32_t INTPND[4];   /* 0x00B0 */
+	uint32_t MSGVALX;     /* 0x00C0 */
+	uint32_t MSGVAL[4];   /* 0x00C4 */
+	uint32_t rsvd3;       /* 0x00D4 */
+	uint32_t INTMUX[4];   /* 0x00D8 */
+	uint32_t rsvd4[6];    /* 0x00E8 */
+	struct hercules_dcan_if_regs IF1; /* 0x0100 */
+	struct hercules_dcan_if_regs IF2; /* 0x0120 */
+	uint32_t IF3OBS;      /* 0x0140 */
+	uint32_t IF3MSK;      /* 0x0144 */
+	uint32_t IF3ARB;      /* 0x0148 */
+	uint32_t IF3MCTL;     /* 0x014C */
+	uint32_t IF3DATA;     /* 0x0150 */
+	uint32_t IF3DATB;     /* 0x0154 */
+	uint32_t rsvd5[2];    /* 0x0158 */
+	uint32_t IF3UPD[4];   /* 0x0160 */
+	uint32_t rsvd6[28];   /* 0x0170 */
+	uint32_t TIOC;        /* 0x01E0 */
+	uint32_t RIOC;        /* 0x01E4 */
+};
+
+struct can_ti_hercules_dcan_tx {
+	can_tx_callback_t cb;
+	void *user_data;
+};
+
+struct can_ti_hercules_dcan_filter {
+	can_rx_callback_t cb;
+	void *user_data;
+	struct can_filter filter;
+};
+
+struct can_ti_hercules_dcan_config {
+	const struct can_driver_config common;
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct can_ti_hercules_dcan_data {
+	struct can_driver_data common;
+	struct k_spinlock lock;
+	enum can_state state;
+	/* TX FIFO, see can_ti_hercules_dcan_send() */
+	struct k_sem tx_sem;
+	struct can_ti_hercules_dcan_tx tx[DCAN_TX_OBJECTS];
+	/* Objects holding a frame that has neither been sent nor failed yet */
+	uint32_t tx_busy;
+	uint8_t tx_head;
+	struct can_ti_hercules_dcan_filter filters[DCAN_MAX_FILTERS];
+};
+
+#define DEV_CFG(dev)  ((const struct can_ti_hercules_dcan_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct can_ti_hercules_dcan_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_dcan_regs *)DEV_CFG(dev)->base)
+
+static inline uint32_t dcan_obj_to_filter(uint32_t obj)
+{
+	return (obj - DCAN_RX_FIRST) / DCAN_RX_DEPTH;
+}
+
+static inline uint32_t dcan_filter_to_obj(uint32_t filter_id)
+{
+	return DCAN_RX_FIRST + filter_id * DCAN_RX_DEPTH;
+}
+
+/* Start a message RAM transfer through an interface register set and wait for it. */
+static void dcan_if_transfer(volatile struct hercules_dcan_if_regs *ifr, uint32_t cmd,
+			     uint32_t obj)
+{
+	ifr->CMD = cmd | obj;
+	while ((ifr->CMD & DCAN_IFCMD_BUSY) != 0U) {
+		/* a transfer takes a few VCLK cycles */
+	}
+}
+
+static uint32_t dcan_id_to_arb(uint32_t id, bool ide)
+{
+	return ide ? (id & CAN_EXT_ID_MASK) | DCAN_IFARB_XTD
+		   : (id & CAN_STD_ID_MASK) << DCAN_ID_STD_SHIFT;
+}
+
+static void dcan_if_to_frame(uint32_t arb, uint32_t mctl, uint32_t da, uint32_t db,
+			     struct can_frame *frame)
+{
+	memset(frame, 0, sizeof(*frame));
+	if ((arb & DCAN_IFARB_XTD) != 0U) {
+		frame->id = arb & CAN_EXT_ID_MASK;
+		frame->flags |= CAN_FRAME_IDE;
+	} else {
+		frame->id = (arb >> DCAN_ID_STD_SHIFT) & CAN_STD_ID_MASK;
+	}
+	frame->dlc = MIN(mctl & 0xFU, CAN_MAX_DLC);
+	/* Little-endian message RAM: byte n of the frame is byte n of DATA/DATB */
+	frame->data_32[0] = da;
+	frame->data_32[1] = db;
+}
+
+/* Reading ES acknowledges the status interrupt, so it is only read once per event */
+static enum can_state dcan_state(volatile struct hercules_dcan_regs *regs, uint32_t es,
+				 struct can_bus_err_cnt *err_cnt)
+{
+	uint32_t errc = regs->ERRC;
+
+	if (err_cnt != NULL) {
+		err_cnt->tx_err_cnt = DCAN_ERRC_TEC(errc);
+		err_cnt->rx_err_cnt = DCAN_ERRC_REC(errc);
+	}
+	if ((es & DCAN_ES_BOFF) != 0U) {
+		return CAN_STATE_BUS_OFF;
+	}
+	if ((es & DCAN_ES_EPASS) != 0U) {
+		return CAN_STATE_ERROR_PASSIVE;
+	}
+	if ((es & DCAN_ES_EWARN) != 0U) {
+		return CAN_STATE_ERROR_WARNING;
+	}
+	return CAN_STATE_ERROR_ACTIVE;
+}
+
+static int can_ti_hercules_dcan_get_capabilities(const struct device *dev, can_mode_t *cap)
+{
+	ARG_UNUSED(dev);
+
+	*cap = CAN_MODE_NORMAL | CAN_MODE_LOOPBACK | CAN_MODE_LISTENONLY | CAN_MODE_ONE_SHOT;
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+	*cap |= CAN_MODE_MANUAL_RECOVERY;
+#endif
+	return 0;
+}
+
+static int can_ti_hercules_dcan_get_core_clock(const struct device *dev, uint32_t *rate)
+{
+	const struct can_ti_hercules_dcan_config *cfg = DEV_CFG(dev);
+
+	return clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, rate);
+}
+
+static int can_ti_hercules_dcan_get_max_filters(const struct device *dev, bool ide)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(ide);
+
+	return DCAN_MAX_FILTERS;
+}
+
+static int can_ti_hercules_dcan_set_timing(const struct device *dev,
+					   const struct can_timing *timing)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	k_spinlock_key_t key;
+
+	if (data->common.started) {
+		return -EBUSY;
+	}
+
+	key = k_spin_lock(&data->lock);
+	regs->CTL |= DCAN_CTL_INIT | DCAN_CTL_CCE;
+	regs->BTR = DCAN_BTR(timing->prescaler - 1U, timing->sjw - 1U,
+			     timing->prop_seg + timing->phase_seg1 - 1U, timing->phase_seg2 - 1U);
+	regs->CTL &= ~DCAN_CTL_CCE;
+	k_spin_unlock(&data->lock, key);
+	return 0;
+}
+
+static int can_ti_hercules_dcan_set_mode(const struct device *dev, can_mode_t mode)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	can_mode_t supported;
+	uint32_t ctl, test = 0;
+
+	can_ti_hercules_dcan_get_capabilities(dev, &supported);
+	if ((mode & ~supported) != 0U) {
+		return -ENOTSUP;
+	}
+	if (data->common.started) {
+		return -EBUSY;
+	}
+
+	ctl = regs->CTL & ~(DCAN_CTL_DAR | DCAN_CTL_TEST | DCAN_CTL_ABO);
+	if ((mode & CAN_MODE_ONE_SHOT) != 0U) {
+		ctl |= DCAN_CTL_DAR;
+	}
+	if ((mode & CAN_MODE_MANUAL_RECOVERY) == 0U) {
+		/* Rejoin the bus on its own after bus-off */
+		ctl |= DCAN_CTL_ABO;
+	}
+	if ((mode & CAN_MODE_LOOPBACK) != 0U) {
+		test |= DCAN_TEST_LBACK;
+	}
+	if ((mode & CAN_MODE_LISTENONLY) != 0U) {
+		test |= DCAN_TEST_SILENT;
+	}
+	if (test != 0U) {
+		ctl |= DCAN_CTL_TEST;
+	}
+
+	regs->CTL = ctl;
+	if (test != 0U) {
+		regs->TEST = test;
+	}
+	data->common.mode = mode;
+	return 0;
+}
+
+static int can_ti_hercules_dcan_start(const struct device *dev)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	int ret;
+
+	if (data->common.started) {
+		return -EALREADY;
+	}
+
+	if (DEV_CFG(dev)->common.phy != NULL) {
+		ret = can_transceiver_enable(DEV_CFG(dev)->common.phy, data->common.mode);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	CAN_STATS_RESET(dev);
+	data->state = CAN_STATE_ERROR_ACTIVE;
+	data->common.started = true;
+	regs->CTL &= ~(DCAN_CTL_INIT | DCAN_CTL_CCE);
+	return 0;
+}
+
+static int can_ti_hercules_dcan_stop(const struct device *dev)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	struct can_ti_hercules_dcan_tx aborted[DCAN_TX_OBJECTS];
+	k_spinlock_key_t key;
+	int ret;
+
+	if (!data->common.started) {
+		return -EALREADY;
+	}
+
+	key = k_spin_lock(&data->lock);
+	regs->CTL |= DCAN_CTL_INIT;
+
+	/* Abort everything still queued in the TX FIFO */
+	for (uint32_t i = 0; i < DCAN_TX_OBJECTS; i++) {
+		aborted[i] = data->tx[i];
+		data->tx[i].cb = NULL;
+		if ((data->tx_busy & BIT(i)) != 0U) {
+			regs->IF1.ARB = 0;
+			regs->IF1.MCTL = 0;
+			dcan_if_transfer(&regs->IF1, DCAN_IFCMD_INVALIDATE, i + 1U);
+		}
+	}
+	data->tx_head = 0;
+	data->tx_busy = 0;
+	k_sem_reset(&data->tx_sem);
+	for (uint32_t i = 0; i < DCAN_TX_OBJECTS; i++) {
+		k_sem_give(&data->tx_sem);
+	}
+	data->common.started = false;
+	k_spin_unlock(&data->lock, key);
+
+	for (uint32_t i = 0; i < DCAN_TX_OBJECTS; i++) {
+		if (aborted[i].cb != NULL) {
+			aborted[i].cb(dev, -ENETDOWN, aborted[i].user_data);
+		}
+	}
+
+	if (DEV_CFG(dev)->common.phy != NULL) {
+		ret = can_transceiver_disable(DEV_CFG(dev)->common.phy);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+	return 0;
+}
+
+/*
+ * The lowest numbered pending message object wins internal arbitration, so
+ * the TX objects are filled strictly in order and only reused once all of
+ * them have completed. This keeps frames in FIFO order while still letting
+ * the controller send up to DCAN_TX_OBJECTS frames back to back. Every
+ * object completes on its own, either sent or, in one-shot mode, failed.
+ */
+static int can_ti_hercules_dcan_send(const struct device *dev, const struct can_frame *frame,
+				     k_timeout_t timeout, can_tx_callback_t callback,
+				     void *user_data)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	uint32_t arb, slot;
+	k_spinlock_key_t key;
+
+	if (frame->dlc > CAN_MAX_DLC) {
+		return -EINVAL;
+	}
+	if ((frame->flags & ~(CAN_FRAME_IDE | CAN_FRAME_RTR)) != 0U) {
+		return -ENOTSUP;
+	}
+	if (!data->common.started) {
+		return -ENETDOWN;
+	}
+	if (data->state == CAN_STATE_BUS_OFF) {
+		return -ENETUNREACH;
+	}
+
+	if (k_sem_take(&data->tx_sem, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	arb = DCAN_IFARB_MSGVAL | dcan_id_to_arb(frame->id, (frame->flags & CAN_FRAME_IDE) != 0U);
+	/* A receive object with TxRqst set sends a remote frame */
+	if ((frame->flags & CAN_FRAME_RTR) == 0U) {
+		arb |= DCAN_IFARB_DIR;
+	}
+
+	key = k_spin_lock(&data->lock);
+	slot = data->tx_head++;
+	data->tx_busy |= BIT(slot);
+	data->tx[slot].cb = callback;
+	data->tx[slot].user_data = user_data;
+
+	regs->IF1.MSK = 0;
+	regs->IF1.ARB = arb;
+	regs->IF1.MCTL = DCAN_IFMCTL_TXIE | DCAN_IFMCTL_TXRQST | DCAN_IFMCTL_NEWDAT |
+			 DCAN_IFMCTL_EOB | DCAN_IFMCTL_DLC(frame->dlc);
+	regs->IF1.DATA = frame->data_32[0];
+	regs->IF1.DATB = frame->data_32[1];
+	dcan_if_transfer(&regs->IF1, DCAN_IFCMD_WR | DCAN_IFCMD_ALL, slot + 1U);
+	k_spin_unlock(&data->lock, key);
+	return 0;
+}
+
+static void can_ti_hercules_dcan_write_filter(const struct device *dev, uint32_t filter_id,
+					      const struct can_filter *filter, bool enable)
+{
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	bool ide = (filter->flags & CAN_FILTER_IDE) != 0U;
+	uint32_t obj = dcan_filter_to_obj(filter_id);
+
+	for (uint32_t i = 0; i < DCAN_RX_DEPTH; i++, obj++) {
+		if (!enable) {
+			regs->IF1.ARB = 0;
+			regs->IF1.MCTL = 0;
+			dcan_if_transfer(&regs->IF1, DCAN_IFCMD_INVALIDATE, obj);
+			continue;
+		}
+
+		/* MXtd makes the IDE flag part of the acceptance test, Dir is ignored */
+		regs->IF1.MSK = dcan_id_to_arb(filter->mask, ide) | DCAN_IFMSK_MXTD;
+		regs->IF1.ARB = DCAN_IFARB_MSGVAL | dcan_id_to_arb(filter->id, ide);
+		/* Consecutive objects form a receive FIFO closed by EoB */
+		regs->IF1.MCTL = DCAN_IFMCTL_UMASK | DCAN_IFMCTL_RXIE |
+				 DCAN_IFMCTL_DLC(CAN_MAX_DLC) |
+				 (i == DCAN_RX_DEPTH - 1U ? DCAN_IFMCTL_EOB : 0U);
+		dcan_if_transfer(&regs->IF1, DCAN_IFCMD_WR | DCAN_IFCMD_ALL | DCAN_IFCMD_CLRINT |
+					     DCAN_IFCMD_NEWDAT, obj);
+	}
+}
+
+static int can_ti_hercules_dcan_add_rx_filter(const struct device *dev, can_rx_callback_t cb,
+					      void *user_data, const struct can_filter *filter)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key;
+	int filter_id = -ENOSPC;
+
+	if ((filter->flags & ~CAN_FILTER_IDE) != 0U) {
+		return -ENOTSUP;
+	}
+
+	key = k_spin_lock(&data->lock);
+	for (uint32_t i = 0; i < DCAN_MAX_FILTERS; i++) {
+		if (data->filters[i].cb == NULL) {
+			filter_id = i;
+			break;
+		}
+	}
+	if (filter_id >= 0) {
+		data->filters[filter_id].cb = cb;
+		data->filters[filter_id].user_data = user_data;
+		data->filters[filter_id].filter = *filter;
+		can_ti_hercules_dcan_write_filter(dev, filter_id, filter, true);
+	}
+	k_spin_unlock(&data->lock, key);
+	return filter_id;
+}
+
+static void can_ti_hercules_dcan_remove_rx_filter(const struct device *dev, int filter_id)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key;
+
+	if (filter_id < 0 || filter_id >= DCAN_MAX_FILTERS) {
+		return;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (data->filters[filter_id].cb != NULL) {
+		can_ti_hercules_dcan_write_filter(dev, filter_id, &data->filters[filter_id].filter,
+						  false);
+		data->filters[filter_id].cb = NULL;
+	}
+	k_spin_unlock(&data->lock, key);
+}
+
+static int can_ti_hercules_dcan_get_state(const struct device *dev, enum can_state *state,
+					  struct can_bus_err_cnt *err_cnt)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	enum can_state cur = dcan_state(DEV_REGS(dev), DEV_REGS(dev)->ES, err_cnt);
+
+	if (state != NULL) {
+		*state = data->common.started ? cur : CAN_STATE_STOPPED;
+	}
+	return 0;
+}
+
+static void can_ti_hercules_dcan_set_state_change_callback(const struct device *dev,
+							   can_state_change_callback_t cb,
+							   void *user_data)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+
+	data->common.state_change_cb = cb;
+	data->common.state_change_cb_user_data = user_data;
+}
+
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+static int can_ti_hercules_dcan_recover(const struct device *dev, k_timeout_t timeout)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	if (!data->common.started) {
+		return -ENETDOWN;
+	}
+	if ((data->common.mode & CAN_MODE_MANUAL_RECOVERY) == 0U) {
+		return -ENOTSUP;
+	}
+	if ((regs->ES & DCAN_ES_BOFF) == 0U) {
+		return 0;
+	}
+
+	/* Leaving Init starts the 128 x 11 recessive bit recovery sequence */
+	regs->CTL &= ~DCAN_CTL_INIT;
+	while ((regs->ES & DCAN_ES_BOFF) != 0U) {
+		if (sys_timepoint_expired(end)) {
+			return -EAGAIN;
+		}
+		k_yield();
+	}
+	return 0;
+}
+#endif /* CONFIG_CAN_MANUAL_RECOVERY_MODE */
+
+/* Complete the frame in TX object @p slot, called from the ISR */
+static void can_ti_hercules_dcan_tx_done(const struct device *dev, uint32_t slot, int status)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	struct can_ti_hercules_dcan_tx tx;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	if ((data->tx_busy & BIT(slot)) == 0U) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	tx = data->tx[slot];
+	data->tx[slot].cb = NULL;
+	data->tx_busy &= ~BIT(slot);
+	if (data->tx_busy == 0U && data->tx_head == DCAN_TX_OBJECTS) {
+		/* FIFO drained, restart from the highest priority object */
+		data->tx_head = 0;
+		for (uint32_t i = 0; i < DCAN_TX_OBJECTS; i++) {
+			k_sem_give(&data->tx_sem);
+		}
+	}
+	k_spin_unlock(&data->lock, key);
+
+	if (tx.cb != NULL) {
+		tx.cb(dev, status, tx.user_data);
+	}
+}
+
+static void can_ti_hercules_dcan_tx_isr(const struct device *dev, uint32_t obj)
+{
+	dcan_if_transfer(&DEV_REGS(dev)->IF2, DCAN_IFCMD_CLRINT, obj);
+	can_ti_hercules_dcan_tx_done(dev, obj - 1U, 0);
+}
+
+/*
+ * With automatic retransmission disabled an object drops its TxRqst after a
+ * single attempt. One that did so without raising its TX interrupt lost
+ * arbitration or hit a bus error.
+ */
+static void can_ti_hercules_dcan_tx_failed(const struct device *dev, uint32_t es)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	uint32_t failed;
+
+	if ((data->common.mode & CAN_MODE_ONE_SHOT) == 0U) {
+		return;
+	}
+
+	failed = data->tx_busy & ~regs->TXRQ[0] & ~regs->INTPND[0];
+	for (uint32_t slot = 0; failed != 0U; slot++, failed >>= 1) {
+		if ((failed & 1U) != 0U) {
+			can_ti_hercules_dcan_tx_done(dev, slot,
+						     (es & DCAN_ES_LEC_MASK) == 0U ? -EBUSY : -EIO);
+		}
+	}
+}
+
+static void can_ti_hercules_dcan_status_isr(const struct device *dev)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	uint32_t es = regs->ES;
+	struct can_bus_err_cnt err_cnt;
+	enum can_state state = dcan_state(regs, es, &err_cnt);
+
+	switch (es & DCAN_ES_LEC_MASK) {
+	case 1:
+		CAN_STATS_STUFF_ERROR_INC(dev);
+		break;
+	case 2:
+		CAN_STATS_FORM_ERROR_INC(dev);
+		break;
+	case 3:
+		CAN_STATS_ACK_ERROR_INC(dev);
+		break;
+	case 4:
+		CAN_STATS_BIT1_ERROR_INC(dev);
+		break;
+	case 5:
+		CAN_STATS_BIT0_ERROR_INC(dev);
+		break;
+	case 6:
+		CAN_STATS_CRC_ERROR_INC(dev);
+		break;
+	default:
+		break;
+	}
+
+	can_ti_hercules_dcan_tx_failed(dev, es);
+
+	if (state != data->state) {
+		data->state = state;
+		if (data->common.state_change_cb != NULL) {
+			data->common.state_change_cb(dev, state, err_cnt,
+						     data->common.state_change_cb_user_data);
+		}
+	}
+}
+
+static void can_ti_hercules_dcan_rx_isr(const struct device *dev, uint32_t obj)
+{
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	struct can_ti_hercules_dcan_filter *flt = &data->filters[dcan_obj_to_filter(obj)];
+	struct can_frame frame;
+	uint32_t arb, mctl, da, db;
+
+	/*
+	 * Every frame is read through IF2, which also clears NewDat and IntPnd.
+	 * The controller raises the objects of a FIFO in order, so frames are
+	 * delivered in the order they were received.
+	 *
+	 * IF3 auto-update is not used: IF3 does not report which object it was
+	 * loaded from. Matching its frame to a filter would need the ID compared
+	 * against the filters in software, which is ambiguous for overlapping
+	 * filters. The interrupt already names the object, so one IF2 transfer
+	 * reads the same frame.
+	 */
+	dcan_if_transfer(&regs->IF2, DCAN_IFCMD_CLRINT | DCAN_IFCMD_NEWDAT | DCAN_IFCMD_ARB |
+				     DCAN_IFCMD_CONTROL | DCAN_IFCMD_DATAA | DCAN_IFCMD_DATAB,
+			 obj);
+	arb = regs->IF2.ARB;
+	mctl = regs->IF2.MCTL;
+	da = regs->IF2.DATA;
+	db = regs->IF2.DATB;
+
+	if ((mctl & DCAN_IFMCTL_MSGLST) != 0U) {
+		CAN_STATS_RX_OVERRUN_INC(dev);
+		regs->IF2.MCTL = mctl & ~(DCAN_IFMCTL_MSGLST | DCAN_IFMCTL_NEWDAT);
+		dcan_if_transfer(&regs->IF2, DCAN_IFCMD_WR | DCAN_IFCMD_CONTROL, obj);
+	}
+	if ((mctl & DCAN_IFMCTL_NEWDAT) != 0U && flt->cb != NULL) {
+		dcan_if_to_frame(arb, mctl, da, db, &frame);
+		flt->cb(dev, &frame, flt->user_data);
+	}
+}
+
+static void can_ti_hercules_dcan_isr(const struct device *dev)
+{
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	uint32_t id;
+
+	/* INT holds the highest priority pending source, 0 once all are served */
+	while ((id = regs->INT & 0xFFFFU) != 0U) {
+		if (id == DCAN_INT_STATUS) {
+			can_ti_hercules_dcan_status_isr(dev);
+		} else if (id <= DCAN_TX_OBJECTS) {
+			can_ti_hercules_dcan_tx_isr(dev, id);
+		} else if (id <= DCAN_MSG_OBJECTS) {
+			can_ti_hercules_dcan_rx_isr(dev, id);
+		} else {
+			break;
+		}
+	}
+}
+
+static int can_ti_hercules_dcan_init(const struct device *dev)
+{
+	const struct can_ti_hercules_dcan_config *cfg = DEV_CFG(dev);
+	struct can_ti_hercules_dcan_data *data = DEV_DATA(dev);
+	volatile struct hercules_dcan_regs *regs = DEV_REGS(dev);
+	struct can_timing timing = {0};
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	if (cfg->common.phy != NULL && !device_is_ready(cfg->common.phy)) {
+		return -ENODEV;
+	}
+
+	k_sem_init(&data->tx_sem, DCAN_TX_OBJECTS, DCAN_TX_OBJECTS);
+
+	regs->CTL = DCAN_CTL_INIT;
+	regs->CTL = DCAN_CTL_INIT | DCAN_CTL_SWR;
+	while ((regs->CTL & DCAN_CTL_SWR) != 0U) {
+		/* nop */;
+	}
+
+	/* Invalidate every message object */
+	regs->IF1.ARB = 0;
+	regs->IF1.MCTL = 0;
+	regs->IF1.MSK = 0;
+	for (uint32_t obj = 1; obj <= DCAN_MSG_OBJECTS; obj++) {
+		dcan_if_transfer(&regs->IF1, DCAN_IFCMD_WR | DCAN_IFCMD_ALL | DCAN_IFCMD_CLRINT,
+				 obj);
+	}
+
+	/* No IF3 auto-update, see can_ti_hercules_dcan_rx_isr() */
+	for (size_t i = 0; i < ARRAY_SIZE(regs->IF3UPD); i++) {
+		regs->IF3UPD[i] = 0;
+		regs->INTMUX[i] = 0;
+	}
+	regs->TIOC = DCAN_IOC_FUNC;
+	regs->RIOC = DCAN_IOC_FUNC;
+	regs->CTL = DCAN_CTL_INIT | DCAN_CTL_IE0 | DCAN_CTL_SIE | DCAN_CTL_EIE;
+
+	ret = can_calc_timing(dev, &timing, cfg->common.bitrate, cfg->common.sample_point);
+	if (ret < 0) {
+		return ret;
+	}
+	ret = can_ti_hercules_dcan_set_timing(dev, &timing);
+	if (ret != 0) {
+		return ret;
+	}
+	ret = can_ti_hercules_dcan_set_mode(dev, CAN_MODE_NORMAL);
+	if (ret != 0) {
+		return ret;
+	}
+
+	cfg->irq_config_func(dev);
+	return 0;
+}
+
+static DEVICE_API(can, can_ti_hercules_dcan_api) = {
+	.get_capabilities = can_ti_hercules_dcan_get_capabilities,
+	.start = can_ti_hercules_dcan_start,
+	.stop = can_ti_hercules_dcan_stop,
+	.set_mode = can_ti_hercules_dcan_set_mode,
+	.set_timing = can_ti_hercules_dcan_set_timing,
+	.send = can_ti_hercules_dcan_send,
+	.add_rx_filter = can_ti_hercules_dcan_add_rx_filter,
+	.remove_rx_filter = can_ti_hercules_dcan_remove_rx_filter,
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+	.recover = can_ti_hercules_dcan_recover,
+#endif
+	.get_state = can_ti_hercules_dcan_get_state,
+	.set_state_change_callback = can_ti_hercules_dcan_set_state_change_callback,
+	.get_core_clock = can_ti_hercules_dcan_get_core_clock,
+	.get_max_filters = can_ti_hercules_dcan_get_max_filters,
+	.timing_min =
+		{
+			.sjw = 1,
+			.prop_seg = 0,
+			.phase_seg1 = 2,
+			.phase_seg2 = 1,
+			.prescaler = 1,
+		},
+	.timing_max =
+		{
+			.sjw = 4,
+			.prop_seg = 0,
+			.phase_seg1 = 16,
+			.phase_seg2 = 8,
+			.prescaler = 1024,
+		},
+};
+
+#define CAN_TI_HERCULES_DCAN_INIT(n)                                                               \
+	static void can_ti_hercules_dcan_irq_config_##n(const struct device *dev)                  \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority),                         \
+			    can_ti_hercules_dcan_isr, DEVICE_DT_INST_GET(n),                       \
+			    DT_INST_IRQ(n, type));                                                 \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+	static const struct can_ti_hercules_dcan_config can_ti_hercules_dcan_config_##n = {       \
+		.common = CAN_DT_DRIVER_CONFIG_INST_GET(n, 0, 1000000),                            \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.irq_config_func = can_ti_hercules_dcan_irq_config_##n,                            \
+	};                                                                                         \
+	static struct can_ti_hercules_dcan_data can_ti_hercules_dcan_data_##n;                     \
+	CAN_DEVICE_DT_INST_DEFINE(n, can_ti_hercules_dcan_init, NULL,                              \
+				  &can_ti_hercules_dcan_data_##n,                                  \
+				  &can_ti_hercules_dcan_config_##n, POST_KERNEL,                   \
+				  CONFIG_CAN_INIT_PRIORITY, &can_ti_hercules_dcan_api);
+
+DT_INST_FOREACH_STATUS_OKAY(CAN_TI_HERCULES_DCAN_INIT)
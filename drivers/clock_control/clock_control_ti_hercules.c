@@ -7,6 +7,9 @@
 
 #include <soc.h>
 #include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/ti_hercules_boot_trace.h>
+#include <zephyr/drivers/ti_hercules_sys_regs.h>
 #include <zephyr/dt-bindings/clock/ti-hercules-clock.h>
 #include <zephyr/device.h>
 #include <zephyr/sys/sys_io.h>
@@ -50,19 +53,19 @@
 static uint32_t _errata_disable_plls(uint32_t plls)
 {
 	uint32_t timeout = 0x10, fail_code = 0;
-	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
-	volatile struct hercules_syscon_2_regs *sys_regs_2 = (void *)DT_REG_ADDR(SYS2_NODE);
-	volatile struct hercules_esm_regs *esm_regs = (void *)DT_REG_ADDR(ESM_NODE);
-	sys_regs_1->CSDISSET = plls;
-	while (((sys_regs_1->CSVSTAT & plls) != 0) && timeout-- != 0) {
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	volatile struct hercules_syscon_2_regs *sys_regs_2 = HERCULES_MMIO(DT_REG_ADDR(SYS2_NODE));
+	volatile struct hercules_esm_regs *esm_regs = HERCULES_MMIO(DT_REG_ADDR(ESM_NODE));
+	HERCULES_REG_WRITE(sys_regs_1, CSDISSET, plls);
+	while (((HERCULES_REG_READ(sys_regs_1, CSVSTAT) & plls) != 0) && timeout-- != 0) {
 		/* Clear ESM and GLBSTAT PLL slip flags */
-		sys_regs_1->GBLSTAT = FBSLIP | RFSLIP;
+		HERCULES_REG_WRITE(sys_regs_1, GBLSTAT, FBSLIP | RFSLIP);
 
 		if ((plls & BIT(CLOCK_SRC_PLL1)) == BIT(CLOCK_SRC_PLL1)) {
-			esm_regs->SR1[0] = ESM_SRx_PLLxSLIP;
+			HERCULES_REG_WRITE(esm_regs, SR1[0], ESM_SRx_PLLxSLIP);
 		}
 		if ((plls & BIT(CLOCK_SRC_PLL2)) == BIT(CLOCK_SRC_PLL2)) {
-			esm_regs->SR4[0] = ESM_SRx_PLLxSLIP;
+			HERCULES_REG_WRITE(esm_regs, SR4[0], ESM_SRx_PLLxSLIP);
 		}
 	}
 	if (timeout == 0) {
@@ -89,51 +92,49 @@ workaround function being called from the wrong place in the code.
 static uint32_t _errata_SSWF021_45_both_plls(uint32_t count)
 {
 	uint32_t fail_code = 0;
-	uint32_t retries;
+	uint32_t retries, slips = 0;
 	uint32_t clock_control_save;
-	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
-	volatile struct hercules_syscon_2_regs *sys_regs_2 = (void *)DT_REG_ADDR(SYS2_NODE);
-	volatile struct hercules_esm_regs *esm_regs = (void *)DT_REG_ADDR(ESM_NODE);
-	clock_control_save = sys_regs_1->CLKCNTL;
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	volatile struct hercules_syscon_2_regs *sys_regs_2 = HERCULES_MMIO(DT_REG_ADDR(SYS2_NODE));
+	volatile struct hercules_esm_regs *esm_regs = HERCULES_MMIO(DT_REG_ADDR(ESM_NODE));
+	clock_control_save = HERCULES_REG_READ(sys_regs_1, CLKCNTL);
 	/* First set VCLK2 = HCLK */
-	sys_regs_1->CLKCNTL = clock_control_save & (PENA | (0xf << 16));
+	HERCULES_REG_WRITE(sys_regs_1, CLKCNTL, clock_control_save & (PENA | (0xf << 16)));
 	/* Now set VCLK = HCLK and enable peripherals */
-	sys_regs_1->CLKCNTL = PENA;
+	HERCULES_REG_WRITE(sys_regs_1, CLKCNTL, PENA);
 	for (retries = 0; retries < count; retries++) {
 		fail_code = _errata_disable_plls(BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2));
 		if (fail_code != 0) {
 			break;
 		}
 		/* Clear Global Status Register */
-		sys_regs_1->GBLSTAT = FBSLIP | RFSLIP | OSCFAIL;
+		HERCULES_REG_WRITE(sys_regs_1, GBLSTAT, FBSLIP | RFSLIP | OSCFAIL);
 		/* Clear the ESM PLL slip flags */
-		esm_regs->SR1[0] = ESM_SRx_PLLxSLIP;
-		esm_regs->SR4[0] = ESM_SRx_PLLxSLIP;
+		HERCULES_REG_WRITE(esm_regs, SR1[0], ESM_SRx_PLLxSLIP);
+		HERCULES_REG_WRITE(esm_regs, SR4[0], ESM_SRx_PLLxSLIP);
 
 		/* set both PLLs to OSCIN/1*27/(2*1) */
-		sys_regs_1->PLLCTL1 = 0x20001A00;
-		sys_regs_1->PLLCTL2 = 0x3FC0723D;
-		sys_regs_2->PLLCTL3 = 0x20001A00;
-		sys_regs_1->CSDISCLR = BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2);
+		HERCULES_REG_WRITE(sys_regs_1, PLLCTL1, 0x20001A00);
+		HERCULES_REG_WRITE(sys_regs_1, PLLCTL2, 0x3FC0723D);
+		HERCULES_REG_WRITE(sys_regs_2, PLLCTL3, 0x20001A00);
+		HERCULES_REG_WRITE(sys_regs_1, CSDISCLR, BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2));
 
 		/* Check for (CLOCK_SRC_PLL1 valid or CLOCK_SRC_PLL1 slip) and (CLOCK_SRC_PLL2 valid
 		 * or CLOCK_SRC_PLL2 slip) */
-		while ((((sys_regs_1->CSVSTAT & BIT(CLOCK_SRC_PLL1)) == 0) &&
-			((esm_regs->SR1[0] & ESM_SRx_PLLxSLIP) == 0)) ||
-		       (((sys_regs_1->CSVSTAT & BIT(CLOCK_SRC_PLL2)) == 0) &&
-			((esm_regs->SR4[0] & ESM_SRx_PLLxSLIP) == 0))) {
+		while ((((HERCULES_REG_READ(sys_regs_1, CSVSTAT) & BIT(CLOCK_SRC_PLL1)) == 0) &&
+			((HERCULES_REG_READ(esm_regs, SR1[0]) & ESM_SRx_PLLxSLIP) == 0)) ||
+		       (((HERCULES_REG_READ(sys_regs_1, CSVSTAT) & BIT(CLOCK_SRC_PLL2)) == 0) &&
+			((HERCULES_REG_READ(esm_regs, SR4[0]) & ESM_SRx_PLLxSLIP) == 0))) {
 			/* Wait */
 		}
+		if (((HERCULES_REG_READ(esm_regs, SR1[0]) | HERCULES_REG_READ(esm_regs, SR4[0])) &
+		     ESM_SRx_PLLxSLIP) != 0U) {
+			slips++;
+		}
 	}
+	ti_hercules_boot_trace_pll(retries, slips, fail_code);
 	return fail_code;
 }
-struct ti_herc_periph_clk {
-	uint8_t domain;
-	uint8_t source;
-	uint8_t clock_mode;
-	uint8_t arg; /* divider argument (optional) */
-};
-
 struct ti_hercules_gcm_clock_data {
 };
 
@@ -144,14 +145,14 @@ static int ti_hercules_gcm_clock_on(const struct device *dev, clock_control_subs
 	    !IN_RANGE(periph_clk->domain, CLOCK_DOM_GCLK1, CLOCK_DOM_VCLKA4)) {
 		return -EINVAL;
 	}
-	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
 	if (IN_RANGE(periph_clk->source, CLOCK_SRC_OSCILLATOR, CLOCK_SRC_EXTCLKIN2)) {
 		/* enable clock source if not enabled */
-		sys_regs_1->CSDIS |= BIT(periph_clk->source);
+		HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(periph_clk->source), 0);
 	}
 	if (IN_RANGE(periph_clk->domain, CLOCK_DOM_GCLK1, CLOCK_DOM_VCLKA4)) {
 		/* enable clock domain if not enabled */
-		sys_regs_1->CDDIS &= ~BIT(periph_clk->domain);
+		HERCULES_REG_UPDATE(sys_regs_1, CDDIS, BIT(periph_clk->domain), 0);
 	}
 	return 0;
 }
@@ -159,17 +160,17 @@ static int ti_hercules_gcm_clock_on(const struct device *dev, clock_control_subs
 static int ti_hercules_gcm_clock_off(const struct device *dev, clock_control_subsys_t sys)
 {
 
-	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
 	struct ti_herc_periph_clk *periph_clk = (struct ti_herc_periph_clk *)sys;
 	if (!IN_RANGE(periph_clk->source, CLOCK_SRC_OSCILLATOR, CLOCK_SRC_EXTCLKIN2) &&
 	    !IN_RANGE(periph_clk->domain, CLOCK_DOM_GCLK1, CLOCK_DOM_VCLKA4)) {
 		return -EINVAL;
 	}
 	if (IN_RANGE(periph_clk->domain, CLOCK_DOM_GCLK1, CLOCK_DOM_VCLKA4)) {
-		sys_regs_1->CDDIS |= BIT(periph_clk->domain);
+		HERCULES_REG_UPDATE(sys_regs_1, CDDIS, 0, BIT(periph_clk->domain));
 	}
 	if (IN_RANGE(periph_clk->source, CLOCK_SRC_OSCILLATOR, CLOCK_SRC_EXTCLKIN2)) {
-		sys_regs_1->CSDIS |= BIT(periph_clk->source);
+		HERCULES_REG_UPDATE(sys_regs_1, CSDIS, 0, BIT(periph_clk->source));
 	}
 	return 0;
 }
@@ -177,7 +178,7 @@ static int ti_hercules_gcm_clock_off(const struct device *dev, clock_control_sub
 static enum clock_control_status ti_hercules_gcm_clock_get_status(const struct device *dev,
 								  clock_control_subsys_t sys)
 {
-	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
 	struct ti_herc_periph_clk *periph_clk = (struct ti_herc_periph_clk *)sys;
 	uint32_t csv_stat = 0;
 	uint32_t csdis_val = 0;
@@ -187,8 +188,8 @@ static enum clock_control_status ti_hercules_gcm_clock_get_status(const struct d
 	    !IN_RANGE(periph_clk->domain, CLOCK_DOM_GCLK1, CLOCK_DOM_VCLKA4)) {
 		return CLOCK_CONTROL_STATUS_UNKNOWN;
 	} else if (IN_RANGE(periph_clk->source, CLOCK_SRC_OSCILLATOR, CLOCK_SRC_EXTCLKIN2)) {
-		sys_regs_1->CSVSTAT = csv_stat;
-		sys_regs_1->CSDIS = csdis_val;
+		csv_stat = HERCULES_REG_READ(sys_regs_1, CSVSTAT);
+		csdis_val = HERCULES_REG_READ(sys_regs_1, CSDIS);
 		csv_stat = FIELD_GET(BIT(periph_clk->source), csv_stat);
 		csdis_val = FIELD_GET(BIT(periph_clk->source), csdis_val);
 		if (csdis_val) {
@@ -201,18 +202,16 @@ static enum clock_control_status ti_hercules_gcm_clock_get_status(const struct d
 			return CLOCK_CONTROL_STATUS_UNKNOWN;
 		}
 	} else {
-		sys_regs_1->CDDIS = cddis_val;
+		cddis_val = HERCULES_REG_READ(sys_regs_1, CDDIS);
 		cddis_val = FIELD_GET(BIT(periph_clk->domain), cddis_val);
 		return (cddis_val) ? CLOCK_CONTROL_STATUS_OFF : CLOCK_CONTROL_STATUS_ON;
 	}
 }
 
-static int ti_hercules_gcm_clock_get_rate(const struct device *dev, clock_control_subsys_t sys,
-					  uint32_t *rate)
+static int ti_hercules_gcm_source_rate(uint32_t source, uint32_t *rate)
 {
-	struct ti_herc_periph_clk *periph_clk = (struct ti_herc_periph_clk *)sys;
 	*rate = 0;
-	switch (periph_clk->source) {
+	switch (source) {
 #if DT_NODE_HAS_STATUS_OKAY(OSCIN_CLOCK_NODE)
 	case CLOCK_SRC_OSCILLATOR:
 		*rate = CLOCK_OSCIN_FREQ;
@@ -251,6 +250,71 @@ static int ti_hercules_gcm_clock_get_rate(const struct device *dev, clock_contro
 	return 0;
 }
 
+/* Rate of a clock domain, derived from the live GHVSRC and divider settings. */
+static int ti_hercules_gcm_domain_rate(uint32_t domain, uint32_t *rate)
+{
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	volatile struct hercules_syscon_2_regs *sys_regs_2 = HERCULES_MMIO(DT_REG_ADDR(SYS2_NODE));
+	uint32_t gclk, hclk, src;
+	int ret;
+
+	switch (domain) {
+	case CLOCK_DOM_VCLKA1:
+	case CLOCK_DOM_VCLKA2:
+		src = HERCULES_REG_READ(sys_regs_1, VCLKASRC);
+		src = (src >> (domain == CLOCK_DOM_VCLKA2 ? 8 : 0)) & 0xF;
+		/* VCLKA1/2 run from VCLK out of reset */
+		if (src == CLOCK_SRC_VCLK) {
+			return ti_hercules_gcm_domain_rate(CLOCK_DOM_VCLK, rate);
+		}
+		return ti_hercules_gcm_source_rate(src, rate);
+	default:
+		break;
+	}
+
+	ret = ti_hercules_gcm_source_rate(HERCULES_REG_READ(sys_regs_1, GHVSRC) & 0xF, &gclk);
+	if (ret != 0) {
+		return ret;
+	}
+	hclk = gclk / ((HERCULES_REG_READ(sys_regs_2, HCLKCNTL) & 0x3) + 1);
+
+	switch (domain) {
+	case CLOCK_DOM_GCLK1:
+		*rate = gclk;
+		break;
+	case CLOCK_DOM_HCLK:
+		*rate = hclk;
+		break;
+	case CLOCK_DOM_VCLK:
+		*rate = hclk / (((HERCULES_REG_READ(sys_regs_1, CLKCNTL) >> 16) & 0xF) + 1);
+		break;
+	case CLOCK_DOM_VCLK2:
+		*rate = hclk / (((HERCULES_REG_READ(sys_regs_1, CLKCNTL) >> 24) & 0xF) + 1);
+		break;
+	case CLOCK_DOM_VCLK3:
+		*rate = hclk / ((HERCULES_REG_READ(sys_regs_2, CLK2CNTRL) & 0xF) + 1);
+		break;
+	default:
+		return -EINVAL;
+	}
+	return 0;
+}
+
+static int ti_hercules_gcm_clock_get_rate(const struct device *dev, clock_control_subsys_t sys,
+					  uint32_t *rate)
+{
+	struct ti_herc_periph_clk *periph_clk = (struct ti_herc_periph_clk *)sys;
+
+	switch (periph_clk->source) {
+	case CLOCK_SRC_VCLK:
+		return ti_hercules_gcm_domain_rate(CLOCK_DOM_VCLK, rate);
+	case CLOCK_SRC_NONE:
+		return ti_hercules_gcm_domain_rate(periph_clk->domain, rate);
+	default:
+		return ti_hercules_gcm_source_rate(periph_clk->source, rate);
+	}
+}
+
 static int ti_hercules_gcm_clock_configure(const struct device *dev, clock_control_subsys_t sys,
 					   void *data)
 {
@@ -259,14 +323,14 @@ static int ti_hercules_gcm_clock_configure(const struct device *dev, clock_contr
 		.source = CLOCK_SRC_VCLK,
 	};
 	struct ti_herc_periph_clk *periph_clk = (struct ti_herc_periph_clk *)sys;
-	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
-	volatile struct hercules_syscon_2_regs *sys_regs_2 = (void *)DT_REG_ADDR(SYS2_NODE);
-	uint32_t vclk_rate, src_clk_rate;
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	volatile struct hercules_syscon_2_regs *sys_regs_2 = HERCULES_MMIO(DT_REG_ADDR(SYS2_NODE));
+	uint32_t vclk_rate, src_clk_rate, shift;
 	if (!IN_RANGE(periph_clk->source, CLOCK_SRC_OSCILLATOR, CLOCK_SRC_EXTCLKIN2)) {
 		/* Invalid source for input */
 		return -EINVAL;
 	}
-	if (!IN_RANGE(periph_clk->clock_mode, CLOCK_ON_NORMAL, CLOCK_ON_WAKEUP_GCLK1_OFF)) {
+	if (!IN_RANGE(periph_clk->clock_mode, CLOCK_ON_NORMAL, CLOCK_ON_WAKEUP)) {
 		return -EINVAL;
 	}
 	switch (periph_clk->domain) {
@@ -275,38 +339,48 @@ static int ti_hercules_gcm_clock_configure(const struct device *dev, clock_contr
 	case CLOCK_DOM_VCLK:
 	case CLOCK_DOM_VCLK2:
 	case CLOCK_DOM_VCLK3:
-		/* All the above domains use the same source for clocks */
-		sys_regs_1->GHVSRC |= (0xF & periph_clk->source) << (8 * periph_clk->clock_mode);
+		/*
+		 * All the above domains use the same source for clocks. The mode selects the
+		 * GHVSRC field: normal operation (3:0), low power with GCLK1 off (HVLPM, 19:16)
+		 * or the source used when waking up from a low power mode (GHVWAKE, 27:24).
+		 */
+		shift = (periph_clk->clock_mode == CLOCK_ON_NORMAL)
+				? 0
+				: 8 * (periph_clk->clock_mode + 1);
+		HERCULES_REG_UPDATE(sys_regs_1, GHVSRC, 0xFU << shift,
+				    (0xF & periph_clk->source) << shift);
 		break;
 	case CLOCK_DOM_VCLKA1:
-		sys_regs_1->VCLKASRC |= (0xF & periph_clk->source);
+		HERCULES_REG_UPDATE(sys_regs_1, VCLKASRC, 0, (0xF & periph_clk->source));
 		break;
 
 	case CLOCK_DOM_VCLKA2:
-		sys_regs_1->VCLKASRC |= (0xF & periph_clk->source) << 8;
+		HERCULES_REG_UPDATE(sys_regs_1, VCLKASRC, 0, (0xF & periph_clk->source) << 8);
 		break;
 	case CLOCK_DOM_VCLKA4:
-		sys_regs_2->VCLKACON1 |= (0xF & periph_clk->source) | periph_clk->arg;
+		HERCULES_REG_UPDATE(sys_regs_2, VCLKACON1, 0,
+				    (0xF & periph_clk->source) | periph_clk->arg);
 		break;
 	case CLOCK_DOM_RTICLK1:
 		if (!IN_RANGE(periph_clk->arg, RTICLK_DIV_1, RTICLK_DIV_8)) {
 			return -EINVAL;
 		}
 		if (periph_clk->source != CLOCK_SRC_VCLK) {
-			if (!clock_control_get_rate(DEVICE_DT_GET(GCM_NODE), sys, &src_clk_rate)) {
+			if (clock_control_get_rate(DEVICE_DT_GET(GCM_NODE), sys, &src_clk_rate) != 0) {
 				return -EINVAL;
 			}
-			if (!clock_control_get_rate(DEVICE_DT_GET(GCM_NODE),
-						    (clock_control_subsys_t)&vclk_sys,
-						    &vclk_rate)) {
+			if (clock_control_get_rate(DEVICE_DT_GET(GCM_NODE),
+						   (clock_control_subsys_t)&vclk_sys,
+						   &vclk_rate) != 0) {
 				return -EINVAL;
 			}
 			if (src_clk_rate < vclk_rate / (1 << periph_clk->arg)) {
 				return -EINVAL;
 			}
 		}
-		sys_regs_1->RCLKSRC = ((1 << periph_clk->arg) << 8) /* Set divider */
-				      | (0xF & periph_clk->source); /* set source */
+		HERCULES_REG_WRITE(sys_regs_1, RCLKSRC,
+				   ((1 << periph_clk->arg) << 8)  /* Set divider */
+					   | (0xF & periph_clk->source)); /* set source */
 
 		break;
 	default:
@@ -317,23 +391,29 @@ static int ti_hercules_gcm_clock_configure(const struct device *dev, clock_contr
 
 static int ti_hercules_gcm_clock_init(const struct device *dev)
 {
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	volatile struct hercules_syscon_2_regs *sys_regs_2 = HERCULES_MMIO(DT_REG_ADDR(SYS2_NODE));
+	const uint32_t plls = BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2);
+	uint32_t start = ti_hercules_boot_trace_now();
+	uint32_t stage = start;
+
 	_errata_SSWF021_45_both_plls(5);
-	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
-	volatile struct hercules_syscon_2_regs *sys_regs_2 = (void *)DT_REG_ADDR(SYS2_NODE);
+	ti_hercules_boot_trace_stage(TI_HERCULES_BOOT_STAGE_PLL_ERRATA, stage);
 
 	/* Configure PLL control registers and enable PLLs.
 	 * The PLL takes (127 + 1024 * NR) oscillator cycles to acquire lock.
 	 * This initialization sequence performs all the tasks that are not
 	 * required to be done at full application speed while the PLL locks.
 	 */
-	sys_regs_1->CSDISSET = BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2);
-	while (sys_regs_1->CSDIS & (BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2)) !=
-					   (BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2))) {
+	stage = ti_hercules_boot_trace_now();
+	HERCULES_REG_WRITE(sys_regs_1, CSDISSET, plls);
+	while ((HERCULES_REG_READ(sys_regs_1, CSDIS) & plls) != plls) {
 		/*nop*/;
 	}
+	ti_hercules_boot_trace_stage(TI_HERCULES_BOOT_STAGE_PLL_DISABLE, stage);
 
 	/* Clear Global Status Flags */
-	sys_regs_1->GBLSTAT = FBSLIP | RFSLIP | OSCFAIL;
+	HERCULES_REG_WRITE(sys_regs_1, GBLSTAT, FBSLIP | RFSLIP | OSCFAIL);
 
 #if DT_NODE_HAS_STATUS_OKAY(PLL1_NODE)
 	uint32_t pllctl1_conf = 0;
@@ -353,7 +433,7 @@ static int ti_hercules_gcm_clock_init(const struct device *dev)
 	BUILD_ASSERT(IN_RANGE(z_pllmul(PLL1_NODE), 1, 256), "NF out of range! (1 - 256)");
 	pllctl1_conf |= (z_pllmul(PLL1_NODE) - 1) << 8;
 
-	sys_regs_1->PLLCTL1 = pllctl1_conf;
+	HERCULES_REG_WRITE(sys_regs_1, PLLCTL1, pllctl1_conf);
 
 	uint32_t pllctl2_conf = 0;
 #if FMENA
@@ -367,7 +447,7 @@ static int ti_hercules_gcm_clock_init(const struct device *dev)
 #endif /* FMENA */
 	BUILD_ASSERT(IN_RANGE(z_odpll(PLL1_NODE), 1, 8), "OD out of range! (1 - 8)");
 	pllctl2_conf |= (z_odpll(PLL1_NODE) - 1) << 9;
-	sys_regs_1->PLLCTL2 = pllctl2_conf;
+	HERCULES_REG_WRITE(sys_regs_1, PLLCTL2, pllctl2_conf);
 #endif /* PLL1_NODE */
 
 #if DT_NODE_HAS_STATUS_OKAY(PLL2_NODE)
@@ -380,30 +460,32 @@ static int ti_hercules_gcm_clock_init(const struct device *dev)
 	pllctl3_conf |= (z_refclkdiv(PLL2_NODE) - 1) << 16;
 	BUILD_ASSERT(IN_RANGE(z_pllmul(PLL2_NODE), 1, 256), "NF out of range! (1 - 256)");
 	pllctl3_conf |= (z_pllmul(PLL2_NODE) - 1) << 8;
-	sys_regs_2->PLLCTL3 = pllctl3_conf;
+	HERCULES_REG_WRITE(sys_regs_2, PLLCTL3, pllctl3_conf);
 #endif /* PLL2_NODE */
 
+	/* Enable the clock sources in use, a source runs while its CSDIS bit is clear */
 #if DT_NODE_HAS_STATUS_OKAY(OSCIN_CLOCK_NODE)
-	sys_regs_1->CSDIS |= BIT(CLOCK_SRC_OSCILLATOR);
+	HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(CLOCK_SRC_OSCILLATOR), 0);
 #endif
 #if DT_NODE_HAS_STATUS_OKAY(PLL1_NODE)
-	sys_regs_1->CSDIS |= BIT(CLOCK_SRC_PLL1);
+	HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(CLOCK_SRC_PLL1), 0);
 #endif
 #if DT_NODE_HAS_STATUS_OKAY(EXT_CLKIN1_NODE)
-	sys_regs_1->CSDIS |= BIT(CLOCK_SRC_EXTCLKIN);
+	HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(CLOCK_SRC_EXTCLKIN), 0);
 #endif
 #if DT_NODE_HAS_STATUS_OKAY(LF_LPO_CLOCK_NODE)
-	sys_regs_1->CSDIS |= BIT(CLOCK_SRC_LF_LPO);
+	HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(CLOCK_SRC_LF_LPO), 0);
 #endif
 #if DT_NODE_HAS_STATUS_OKAY(HF_LPO_CLOCK_NODE)
-	sys_regs_1->CSDIS |= BIT(CLOCK_SRC_HF_LPO);
+	HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(CLOCK_SRC_HF_LPO), 0);
 #endif
 #if DT_NODE_HAS_STATUS_OKAY(PLL2_NODE)
-	sys_regs_1->CSDIS |= BIT(CLOCK_SRC_PLL2);
+	HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(CLOCK_SRC_PLL2), 0);
 #endif
 #if DT_NODE_HAS_STATUS_OKAY(EXT_CLKIN2_NODE)
-	sys_regs_1->CSDIS |= BIT(CLOCK_SRC_EXTCLKIN2);
+	HERCULES_REG_UPDATE(sys_regs_1, CSDIS, BIT(CLOCK_SRC_EXTCLKIN2), 0);
 #endif
+	ti_hercules_boot_trace_stage(TI_HERCULES_BOOT_STAGE_CLOCK_INIT, start);
 	return 0;
 }
 
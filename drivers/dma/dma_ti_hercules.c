@@ -0,0 +1,453 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_dma
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/irq.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(dma_ti_hercules, CONFIG_DMA_LOG_LEVEL);
+
+#define DMA_CHANNELS 32U
+#define DMA_REQUESTS 48U
+
+#define DMA_GCTRL_RES    BIT(0)
+#define DMA_GCTRL_DMA_EN BIT(16)
+
+/* All channels use port B, the only port wired up on this device */
+#define DMA_PAR_PORT_B 0x44444444U
+
+#define DMA_CHCTRL_CHAIN(ch) (((ch) & 0x3FU) << 16)
+#define DMA_CHCTRL_RES(sz)   (((sz) & 0x3U) << 14)
+#define DMA_CHCTRL_WES(sz)   (((sz) & 0x3U) << 12)
+#define DMA_CHCTRL_TTYPE     BIT(8)
+#define DMA_CHCTRL_ADDMR(m)  (((m) & 0x3U) << 3)
+#define DMA_CHCTRL_ADDMW(m)  (((m) & 0x3U) << 1)
+#define DMA_CHCTRL_AIM       BIT(0)
+
+#define DMA_ADDM_CONSTANT  0x0U
+#define DMA_ADDM_POST_INCR 0x1U
+
+#define DMA_ITCOUNT(frames, elements) ((((frames) & 0x1FFFU) << 16) | ((elements) & 0x1FFFU))
+#define DMA_CTCOUNT_FRAMES(v)         (((v) >> 16) & 0x1FFFU)
+#define DMA_CTCOUNT_ELEMENTS(v)       ((v) & 0x1FFFU)
+#define DMA_MAX_COUNT                 0x1FFFU
+
+struct hercules_dma_regs {
+	uint32_t GCTRL;       /* 0x0000 */
+	uint32_t PEND;        /* 0x0004 */
+	uint32_t FBREG;       /* 0x0008 */
+	uint32_t DMASTAT;     /* 0x000C */
+	uint32_t rsvd1;       /* 0x0010 */
+	uint32_t HWCHENAS;    /* 0x0014 */
+	uint32_t rsvd2;       /* 0x0018 */
+	uint32_t HWCHENAR;    /* 0x001C */
+	uint32_t rsvd3;       /* 0x0020 */
+	uint32_t SWCHENAS;    /* 0x0024 */
+	uint32_t rsvd4;       /* 0x0028 */
+	uint32_t SWCHENAR;    /* 0x002C */
+	uint32_t rsvd5;       /* 0x0030 */
+	uint32_t CHPRIOS;     /* 0x0034 */
+	uint32_t rsvd6;       /* 0x0038 */
+	uint32_t CHPRIOR;     /* 0x003C */
+	uint32_t rsvd7;       /* 0x0040 */
+	uint32_t GCHIENAS;    /* 0x0044 */
+	uint32_t rsvd8;       /* 0x0048 */
+	uint32_t GCHIENAR;    /* 0x004C */
+	uint32_t rsvd9;       /* 0x0050 */
+	uint32_t DREQASI[8];  /* 0x0054 */
+	uint32_t rsvd10[8];   /* 0x0074 */
+	uint32_t PAR[4];      /* 0x0094 */
+	uint32_t rsvd11[4];   /* 0x00A4 */
+	uint32_t FTCMAP;      /* 0x00B4 */
+	uint32_t rsvd12;      /* 0x00B8 */
+	uint32_t LFSMAP;      /* 0x00BC */
+	uint32_t rsvd13;      /* 0x00C0 */
+	uint32_t HBCMAP;      /* 0x00C4 */
+	uint32_t rsvd14;      /* 0x00C8 */
+	uint32_t BTCMAP;      /* 0x00CC */
+	uint32_t rsvd15;      /* 0x00D0 */
+	uint32_t BERMAP;      /* 0x00D4 */
+	uint32_t rsvd16;      /* 0x00D8 */
+	uint32_t FTCINTENAS;  /* 0x00DC */
+	uint32_t rsvd17;      /* 0x00E0 */
+	uint32_t FTCINTENAR;  /* 0x00E4 */
+	uint32_t rsvd18;      /* 0x00E8 */
+	uint32_t LFSINTENAS;  /* 0x00EC */
+	uint32_t rsvd19;      /* 0x00F0 */
+	uint32_t LFSINTENAR;  /* 0x00F4 */
+	uint32_t rsvd20;      /* 0x00F8 */
+	uint32_t HBCINTENAS;  /* 0x00FC */
+	uint32_t rsvd21;      /* 0x0100 */
+	uint32_t HBCINTENAR;  /* 0x0104 */
+	uint32_t rsvd22;      /* 0x0108 */
+	uint32_t BTCINTENAS;  /* 0x010C */
+	uint32_t rsvd23;      /* 0x0110 */
+	uint32_t BTCINTENAR;  /* 0x0114 */
+	uint32_t rsvd24;      /* 0x0118 */
+	uint32_t GINTFLAG;    /* 0x011C */
+	uint32_t rsvd25;      /* 0x0120 */
+	uint32_t FTCFLAG;     /* 0x0124 */
+	uint32_t rsvd26;      /* 0x0128 */
+	uint32_t LFSFLAG;     /* 0x012C */
+	uint32_t rsvd27;      /* 0x0130 */
+	uint32_t HBCFLAG;     /* 0x0134 */
+	uint32_t rsvd28;      /* 0x0138 */
+	uint32_t BTCFLAG;     /* 0x013C */
+	uint32_t rsvd29;      /* 0x0140 */
+	uint32_t BERFLAG;     /* 0x0144 */
+	uint32_t rsvd30;      /* 0x0148 */
+	uint32_t FTCAOFFSET;  /* 0x014C */
+	uint32_t LFSAOFFSET;  /* 0x0150 */
+	uint32_t HBCAOFFSET;  /* 0x0154 */
+	uint32_t BTCAOFFSET;  /* 0x0158 */
+	uint32_t BERAOFFSET;  /* 0x015C */
+	uint32_t FTCBOFFSET;  /* 0x0160 */
+	uint32_t LFSBOFFSET;  /* 0x0164 */
+	uint32_t HBCBOFFSET;  /* 0x0168 */
+	uint32_t BTCBOFFSET;  /* 0x016C */
+	uint32_t BERBOFFSET;  /* 0x0170 */
+	uint32_t rsvd31;      /* 0x0174 */
+	uint32_t PTCRL;       /* 0x0178 */
+};
+
+/* Control packet RAM: initial packets at 0x000, working packets at 0x800 */
+struct hercules_dma_pcp_ram {
+	struct {
+		uint32_t ISADDR;
+		uint32_t IDADDR;
+		uint32_t ITCOUNT;
+		uint32_t rsvd1;
+		uint32_t CHCTRL;
+		uint32_t EIOFF;
+		uint32_t FIOFF;
+		uint32_t rsvd2;
+	} PCP[DMA_CHANNELS];
+	uint32_t rsvd[256];
+	struct {
+		uint32_t CSADDR;
+		uint32_t CDADDR;
+		uint32_t CTCOUNT;
+		uint32_t rsvd;
+	} WCP[DMA_CHANNELS];
+};
+
+struct dma_ti_hercules_channel {
+	dma_callback_t cb;
+	void *user_data;
+	enum dma_channel_direction dir;
+	uint32_t frame_bytes;
+	bool hw_request;
+};
+
+struct dma_ti_hercules_config {
+	uintptr_t base;
+	uintptr_t pcp;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct dma_ti_hercules_data {
+	/* dma_context needs to be first */
+	struct dma_context ctx;
+	ATOMIC_DEFINE(channels_atomic, DMA_CHANNELS);
+	struct k_spinlock lock;
+	struct dma_ti_hercules_channel channels[DMA_CHANNELS];
+};
+
+#define DEV_CFG(dev)  ((const struct dma_ti_hercules_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct dma_ti_hercules_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_dma_regs *)DEV_CFG(dev)->base)
+#define DEV_PCP(dev)  ((volatile struct hercules_dma_pcp_ram *)DEV_CFG(dev)->pcp)
+
+static int dma_ti_hercules_size_code(uint32_t size)
+{
+	switch (size) {
+	case 1:
+		return 0;
+	case 2:
+		return 1;
+	case 4:
+		return 2;
+	case 8:
+		return 3;
+	default:
+		return -EINVAL;
+	}
+}
+
+static uint32_t dma_ti_hercules_addm(uint16_t adj)
+{
+	return (adj == DMA_ADDR_ADJ_NO_CHANGE) ? DMA_ADDM_CONSTANT : DMA_ADDM_POST_INCR;
+}
+
+static void dma_ti_hercules_set_request(volatile struct hercules_dma_regs *regs, uint32_t channel,
+					uint32_t request)
+{
+	/* Four channels per DREQASI register, channel 0 in the top byte */
+	uint32_t shift = (3U - (channel % 4U)) * 8U;
+
+	regs->DREQASI[channel / 4U] = (regs->DREQASI[channel / 4U] & ~(0x3FU << shift)) |
+				      ((request & 0x3FU) << shift);
+}
+
+static int dma_ti_hercules_config(const struct device *dev, uint32_t channel,
+				  struct dma_config *config)
+{
+	struct dma_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_dma_regs *regs = DEV_REGS(dev);
+	volatile struct hercules_dma_pcp_ram *pcp = DEV_PCP(dev);
+	struct dma_ti_hercules_channel *chan;
+	struct dma_block_config *block = config->head_block;
+	int src_size, dst_size;
+	uint32_t elements, frames, chctrl;
+	k_spinlock_key_t key;
+
+	if (channel >= DMA_CHANNELS || block == NULL) {
+		return -EINVAL;
+	}
+	if (config->block_count != 1U) {
+		/* Multi block lists are chained by the client through reload */
+		return -ENOTSUP;
+	}
+
+	src_size = dma_ti_hercules_size_code(config->source_data_size);
+	dst_size = dma_ti_hercules_size_code(config->dest_data_size);
+	if (src_size < 0 || dst_size < 0 || config->dma_slot >= DMA_REQUESTS) {
+		return -EINVAL;
+	}
+
+	chan = &data->channels[channel];
+	chan->hw_request = config->channel_direction != MEMORY_TO_MEMORY;
+	chan->dir = config->channel_direction;
+
+	/*
+	 * Peripheral transfers move one burst per request (frame transfer).
+	 * Memory copies move the whole block on a single software request.
+	 */
+	elements = MAX(config->source_burst_length, 1U);
+	chan->frame_bytes = elements * config->source_data_size;
+	if (!chan->hw_request) {
+		elements = block->block_size / config->source_data_size;
+		chan->frame_bytes = block->block_size;
+	}
+	frames = block->block_size / chan->frame_bytes;
+	if (frames == 0U || frames > DMA_MAX_COUNT || elements > DMA_MAX_COUNT) {
+		return -EINVAL;
+	}
+
+	chctrl = DMA_CHCTRL_RES(src_size) | DMA_CHCTRL_WES(dst_size) |
+		 DMA_CHCTRL_ADDMR(dma_ti_hercules_addm(block->source_addr_adj)) |
+		 DMA_CHCTRL_ADDMW(dma_ti_hercules_addm(block->dest_addr_adj));
+	if (!chan->hw_request) {
+		chctrl |= DMA_CHCTRL_TTYPE;
+	}
+	if (config->cyclic || block->source_reload_en || block->dest_reload_en) {
+		/* Restart from the initial packet at the end of every block */
+		chctrl |= DMA_CHCTRL_AIM;
+	}
+
+	key = k_spin_lock(&data->lock);
+
+	regs->HWCHENAR = BIT(channel);
+	regs->BTCINTENAR = BIT(channel);
+
+	pcp->PCP[channel].ISADDR = block->source_address;
+	pcp->PCP[channel].IDADDR = block->dest_address;
+	pcp->PCP[channel].ITCOUNT = DMA_ITCOUNT(frames, elements);
+	pcp->PCP[channel].CHCTRL = chctrl;
+	pcp->PCP[channel].EIOFF = 0;
+	pcp->PCP[channel].FIOFF = 0;
+
+	if (chan->hw_request) {
+		dma_ti_hercules_set_request(regs, channel, config->dma_slot);
+	}
+
+	chan->cb = config->dma_callback;
+	chan->user_data = config->user_data;
+	if (chan->cb != NULL) {
+		regs->BTCFLAG = BIT(channel);
+		regs->BTCINTENAS = BIT(channel);
+	}
+
+	k_spin_unlock(&data->lock, key);
+	return 0;
+}
+
+static int dma_ti_hercules_reload(const struct device *dev, uint32_t channel, uint32_t src,
+				  uint32_t dst, size_t size)
+{
+	volatile struct hercules_dma_pcp_ram *pcp = DEV_PCP(dev);
+	struct dma_ti_hercules_channel *chan;
+	uint32_t frames, elements;
+
+	if (channel >= DMA_CHANNELS) {
+		return -EINVAL;
+	}
+	chan = &DEV_DATA(dev)->channels[channel];
+	frames = size / chan->frame_bytes;
+	if (frames == 0U || frames > DMA_MAX_COUNT) {
+		return -EINVAL;
+	}
+	elements = DMA_CTCOUNT_ELEMENTS(pcp->PCP[channel].ITCOUNT);
+
+	/*
+	 * Only the initial packet is rewritten. A running auto-initiated channel
+	 * picks it up at its next block boundary without stopping, an idle one
+	 * uses it on the next start.
+	 */
+	pcp->PCP[channel].ISADDR = src;
+	pcp->PCP[channel].IDADDR = dst;
+	pcp->PCP[channel].ITCOUNT = DMA_ITCOUNT(frames, elements);
+	return 0;
+}
+
+static int dma_ti_hercules_start(const struct device *dev, uint32_t channel)
+{
+	volatile struct hercules_dma_regs *regs = DEV_REGS(dev);
+
+	if (channel >= DMA_CHANNELS) {
+		return -EINVAL;
+	}
+
+	if (DEV_DATA(dev)->channels[channel].hw_request) {
+		regs->HWCHENAS = BIT(channel);
+	} else {
+		regs->SWCHENAS = BIT(channel);
+	}
+	return 0;
+}
+
+static int dma_ti_hercules_stop(const struct device *dev, uint32_t channel)
+{
+	volatile struct hercules_dma_regs *regs = DEV_REGS(dev);
+	volatile struct hercules_dma_pcp_ram *pcp = DEV_PCP(dev);
+
+	if (channel >= DMA_CHANNELS) {
+		return -EINVAL;
+	}
+
+	regs->HWCHENAR = BIT(channel);
+	regs->SWCHENAR = BIT(channel);
+	/* Prevent an auto-initiated channel from restarting */
+	pcp->PCP[channel].CHCTRL &= ~DMA_CHCTRL_AIM;
+	return 0;
+}
+
+static int dma_ti_hercules_get_status(const struct device *dev, uint32_t channel,
+				      struct dma_status *stat)
+{
+	volatile struct hercules_dma_regs *regs = DEV_REGS(dev);
+	volatile struct hercules_dma_pcp_ram *pcp = DEV_PCP(dev);
+	struct dma_ti_hercules_channel *chan;
+	uint32_t ctcount;
+
+	if (channel >= DMA_CHANNELS) {
+		return -EINVAL;
+	}
+	chan = &DEV_DATA(dev)->channels[channel];
+
+	/* The working packet is only updated when the channel is arbitrated out */
+	ctcount = pcp->WCP[channel].CTCOUNT;
+	stat->busy = ((regs->HWCHENAS | regs->SWCHENAS | regs->PEND) & BIT(channel)) != 0U;
+	stat->dir = chan->dir;
+	stat->pending_length = stat->busy ? DMA_CTCOUNT_FRAMES(ctcount) * chan->frame_bytes : 0;
+	return 0;
+}
+
+static bool dma_ti_hercules_chan_filter(const struct device *dev, int channel, void *filter_param)
+{
+	ARG_UNUSED(dev);
+
+	/* Optionally request a specific channel */
+	if (filter_param != NULL) {
+		return channel == *(int *)filter_param;
+	}
+	return true;
+}
+
+static void dma_ti_hercules_isr(const struct device *dev)
+{
+	struct dma_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_dma_regs *regs = DEV_REGS(dev);
+	uint32_t offset;
+
+	/* BTCAOFFSET holds the 1-based pending channel and clears it on read */
+	while ((offset = regs->BTCAOFFSET & 0x3FU) != 0U) {
+		uint32_t channel = offset - 1U;
+		struct dma_ti_hercules_channel *chan = &data->channels[channel];
+
+		if (chan->cb != NULL) {
+			chan->cb(dev, chan->user_data, channel, DMA_STATUS_COMPLETE);
+		}
+	}
+}
+
+static int dma_ti_hercules_init(const struct device *dev)
+{
+	const struct dma_ti_hercules_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_dma_regs *regs = DEV_REGS(dev);
+
+	regs->GCTRL = DMA_GCTRL_RES;
+	regs->GCTRL = 0;
+
+	regs->HWCHENAR = UINT32_MAX;
+	regs->SWCHENAR = UINT32_MAX;
+	regs->GCHIENAR = UINT32_MAX;
+	regs->BTCINTENAR = UINT32_MAX;
+	for (size_t i = 0; i < ARRAY_SIZE(regs->PAR); i++) {
+		regs->PAR[i] = DMA_PAR_PORT_B;
+	}
+	/* Route every block-complete interrupt to group A (BTCAOFFSET) */
+	regs->BTCMAP = 0;
+	regs->GCHIENAS = UINT32_MAX;
+
+	cfg->irq_config_func(dev);
+
+	regs->GCTRL = DMA_GCTRL_DMA_EN;
+	return 0;
+}
+
+static DEVICE_API(dma, dma_ti_hercules_api) = {
+	.config = dma_ti_hercules_config,
+	.reload = dma_ti_hercules_reload,
+	.start = dma_ti_hercules_start,
+	.stop = dma_ti_hercules_stop,
+	.get_status = dma_ti_hercules_get_status,
+	.chan_filter = dma_ti_hercules_chan_filter,
+};
+
+#define DMA_TI_HERCULES_INIT(n)                                                                    \
+	static void dma_ti_hercules_irq_config_##n(const struct device *dev)                       \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority), dma_ti_hercules_isr,    \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ(n, type));                          \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+	static const struct dma_ti_hercules_config dma_ti_hercules_config_##n = {                 \
+		.base = DT_INST_REG_ADDR_BY_NAME(n, dma),                                          \
+		.pcp = DT_INST_REG_ADDR_BY_NAME(n, pcp),                                           \
+		.irq_config_func = dma_ti_hercules_irq_config_##n,                                 \
+	};                                                                                         \
+	static struct dma_ti_hercules_data dma_ti_hercules_data_##n = {                           \
+		.ctx =                                                                             \
+			{                                                                          \
+				.magic = DMA_MAGIC,                                                \
+				.dma_channels = DMA_CHANNELS,                                      \
+				.atomic = dma_ti_hercules_data_##n.channels_atomic,                \
+			},                                                                         \
+	};                                                                                         \
+	DEVICE_DT_INST_DEFINE(n, dma_ti_hercules_init, NULL, &dma_ti_hercules_data_##n,            \
+			      &dma_ti_hercules_config_##n, PRE_KERNEL_1,                           \
+			      CONFIG_DMA_INIT_PRIORITY, &dma_ti_hercules_api);
+
+DT_INST_FOREACH_STATUS_OKAY(DMA_TI_HERCULES_INIT)
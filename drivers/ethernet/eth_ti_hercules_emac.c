@@ -0,0 +1,693 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_emac
+
+#include <soc.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/phy.h>
+#include <zephyr/spinlock.h>
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(eth_ti_hercules_emac, CONFIG_ETHERNET_LOG_LEVEL);
+
+#define EMAC_TX_DESCS CONFIG_ETH_TI_HERCULES_TX_DESCS
+#define EMAC_RX_DESCS CONFIG_ETH_TI_HERCULES_RX_DESCS
+
+#define EMAC_TX_NEXT(i) (((i) + 1U) % EMAC_TX_DESCS)
+#define EMAC_TX_PREV(i) (((i) + EMAC_TX_DESCS - 1U) % EMAC_TX_DESCS)
+#define EMAC_RX_NEXT(i) (((i) + 1U) % EMAC_RX_DESCS)
+#define EMAC_RX_PREV(i) (((i) + EMAC_RX_DESCS - 1U) % EMAC_RX_DESCS)
+
+/* Shortest frame the MAC may put on the wire, excluding the CRC */
+#define EMAC_MIN_FRAME  60U
+/* Longest accepted frame including a VLAN tag and the CRC */
+#define EMAC_RX_MAXLEN  1522U
+#define EMAC_TX_TIMEOUT K_MSEC(100)
+
+/* CPPI buffer descriptor flags, only valid in SOP/EOP descriptors */
+#define EMAC_DESC_SOP      BIT(31)
+#define EMAC_DESC_EOP      BIT(30)
+#define EMAC_DESC_OWNER    BIT(29)
+#define EMAC_DESC_EOQ      BIT(28)
+#define EMAC_DESC_RX_ERR   (GENMASK(25, 22) | GENMASK(20, 17))
+#define EMAC_DESC_LEN_MASK 0xFFFFU
+
+#define EMAC_MACCONTROL_FULLDUPLEX BIT(0)
+#define EMAC_MACCONTROL_GMIIEN     BIT(5)
+#define EMAC_MACCONTROL_RMIISPEED  BIT(15)
+
+#define EMAC_RXMBP_MULTEN  BIT(5)
+#define EMAC_RXMBP_BROADEN BIT(13)
+#define EMAC_RXMBP_CAFEN   BIT(21)
+
+#define EMAC_MACADDRLO_MATCHFILT BIT(19)
+#define EMAC_MACADDRLO_VALID     BIT(20)
+
+#define EMAC_EOI_RX 1U
+#define EMAC_EOI_TX 2U
+
+#define EMAC_CTRL_C0RXPACEEN BIT(16)
+#define EMAC_CTRL_C0TXPACEEN BIT(17)
+#define EMAC_CTRL_PRESCALE   GENMASK(11, 0)
+/* The pacing prescaler counts VBUSP cycles per 4 us */
+#define EMAC_PACING_TICK_HZ  250000U
+#define EMAC_PACING_MIN      2U
+
+#define EMAC_RX_PACING CONFIG_ETH_TI_HERCULES_RX_IRQ_PER_MS
+#define EMAC_TX_PACING CONFIG_ETH_TI_HERCULES_TX_IRQ_PER_MS
+
+#define DEV_CFG(dev)  ((const struct eth_ti_hercules_emac_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct eth_ti_hercules_emac_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_emac_regs *)HERCULES_MMIO(DEV_CFG(dev)->base))
+#define DEV_CTRL(dev) ((volatile struct hercules_emac_ctrl_regs *)HERCULES_MMIO(DEV_CFG(dev)->ctrl))
+
+/* The transmit ring sits at the start of CPPI RAM, the receive ring follows it */
+#define EMAC_TX_RING(dev) ((volatile struct emac_desc *)HERCULES_MMIO(DEV_CFG(dev)->cppi))
+#define EMAC_RX_RING(dev) (EMAC_TX_RING(dev) + EMAC_TX_DESCS)
+
+/* Address of a descriptor as seen by the EMAC */
+#define EMAC_DESC_ADDR(dev, desc)                                                                  \
+	((uint32_t)(DEV_CFG(dev)->cppi + ((uintptr_t)(desc) - (uintptr_t)EMAC_TX_RING(dev))))
+
+struct hercules_emac_regs {
+	uint32_t TXREVID;           /* 0x000 */
+	uint32_t TXCONTROL;         /* 0x004 */
+	uint32_t TXTEARDOWN;        /* 0x008 */
+	uint32_t RESERVED1;         /* 0x00C */
+	uint32_t RXREVID;           /* 0x010 */
+	uint32_t RXCONTROL;         /* 0x014 */
+	uint32_t RXTEARDOWN;        /* 0x018 */
+	uint32_t RESERVED2[25];     /* 0x01C */
+	uint32_t TXINTSTATRAW;      /* 0x080 */
+	uint32_t TXINTSTATMASKED;   /* 0x084 */
+	uint32_t TXINTMASKSET;      /* 0x088 */
+	uint32_t TXINTMASKCLEAR;    /* 0x08C */
+	uint32_t MACINVECTOR;       /* 0x090 */
+	uint32_t MACEOIVECTOR;      /* 0x094 */
+	uint32_t RESERVED3[2];      /* 0x098 */
+	uint32_t RXINTSTATRAW;      /* 0x0A0 */
+	uint32_t RXINTSTATMASKED;   /* 0x0A4 */
+	uint32_t RXINTMASKSET;      /* 0x0A8 */
+	uint32_t RXINTMASKCLEAR;    /* 0x0AC */
+	uint32_t MACINTSTATRAW;     /* 0x0B0 */
+	uint32_t MACINTSTATMASKED;  /* 0x0B4 */
+	uint32_t MACINTMASKSET;     /* 0x0B8 */
+	uint32_t MACINTMASKCLEAR;   /* 0x0BC */
+	uint32_t RESERVED4[16];     /* 0x0C0 */
+	uint32_t RXMBPENABLE;       /* 0x100 */
+	uint32_t RXUNICASTSET;      /* 0x104 */
+	uint32_t RXUNICASTCLEAR;    /* 0x108 */
+	uint32_t RXMAXLEN;          /* 0x10C */
+	uint32_t RXBUFFEROFFSET;    /* 0x110 */
+	uint32_t RXFILTERLOWTHRESH; /* 0x114 */
+	uint32_t RESERVED5[2];      /* 0x118 */
+	uint32_t RXFLOWTHRESH[8];   /* 0x120 */
+	uint32_t RXFREEBUFFER[8];   /* 0x140 */
+	uint32_t MACCONTROL;        /* 0x160 */
+	uint32_t MACSTATUS;         /* 0x164 */
+	uint32_t EMCONTROL;         /* 0x168 */
+	uint32_t FIFOCONTROL;       /* 0x16C */
+	uint32_t MACCONFIG;         /* 0x170 */
+	uint32_t SOFTRESET;         /* 0x174 */
+	uint32_t RESERVED6[22];     /* 0x178 */
+	uint32_t MACSRCADDRLO;      /* 0x1D0 */
+	uint32_t MACSRCADDRHI;      /* 0x1D4 */
+	uint32_t MACHASH1;          /* 0x1D8 */
+	uint32_t MACHASH2;          /* 0x1DC */
+	uint32_t BOFFTEST;          /* 0x1E0 */
+	uint32_t TPACETEST;         /* 0x1E4 */
+	uint32_t RXPAUSE;           /* 0x1E8 */
+	uint32_t TXPAUSE;           /* 0x1EC */
+	uint32_t RESERVED7[4];      /* 0x1F0 */
+	uint32_t STATS[36];         /* 0x200 */
+	uint32_t RESERVED8[156];    /* 0x290 */
+	uint32_t MACADDRLO;         /* 0x500 */
+	uint32_t MACADDRHI;         /* 0x504 */
+	uint32_t MACINDEX;          /* 0x508 */
+	uint32_t RESERVED9[61];     /* 0x50C */
+	uint32_t TXHDP[8];          /* 0x600 */
+	uint32_t RXHDP[8];          /* 0x620 */
+	uint32_t TXCP[8];           /* 0x640 */
+	uint32_t RXCP[8];           /* 0x660 */
+};
+
+struct hercules_emac_ctrl_regs {
+	uint32_t REVID;          /* 0x00 */
+	uint32_t SOFTRESET;      /* 0x04 */
+	uint32_t RESERVED1;      /* 0x08 */
+	uint32_t INTCONTROL;     /* 0x0C */
+	uint32_t C0RXTHRESHEN;   /* 0x10 */
+	uint32_t C0RXEN;         /* 0x14 */
+	uint32_t C0TXEN;         /* 0x18 */
+	uint32_t C0MISCEN;       /* 0x1C */
+	uint32_t RESERVED2[8];   /* 0x20 */
+	uint32_t C0RXTHRESHSTAT; /* 0x40 */
+	uint32_t C0RXSTAT;       /* 0x44 */
+	uint32_t C0TXSTAT;       /* 0x48 */
+	uint32_t C0MISCSTAT;     /* 0x4C */
+	uint32_t RESERVED3[8];   /* 0x50 */
+	uint32_t C0RXIMAX;       /* 0x70 */
+	uint32_t C0TXIMAX;       /* 0x74 */
+};
+
+/* CPPI 3.0 buffer descriptor as laid out in CPPI RAM */
+struct emac_desc {
+	uint32_t next;
+	uint32_t buf;
+	uint32_t off_len;
+	uint32_t flags_len;
+};
+
+struct eth_ti_hercules_emac_config {
+	uintptr_t base;
+	uintptr_t ctrl;
+	uintptr_t cppi;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	const struct device *phy_dev;
+	bool random_mac;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct eth_ti_hercules_emac_data {
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+	struct k_spinlock lock;
+	/* Transmit ring state, guarded by lock */
+	struct net_pkt *tx_pkts[EMAC_TX_DESCS];
+	uint32_t tx_head;
+	uint32_t tx_tail;
+	uint32_t tx_free;
+	struct k_sem tx_sem;
+	/* Receive ring state, only touched by the receive thread */
+	struct net_buf *rx_bufs[EMAC_RX_DESCS];
+	uint32_t rx_head;
+	struct k_sem rx_sem;
+	struct k_thread rx_thread;
+
+	K_KERNEL_STACK_MEMBER(rx_stack, CONFIG_ETH_TI_HERCULES_RX_THREAD_STACK_SIZE);
+};
+
+/* Padding for runt frames, sent as an extra descriptor so the payload is never copied */
+static uint8_t emac_tx_pad[EMAC_MIN_FRAME];
+
+static void emac_set_mac(volatile struct hercules_emac_regs *regs, const uint8_t *mac)
+{
+	HERCULES_REG_WRITE(regs, MACSRCADDRHI,
+			   mac[3] | (mac[2] << 8) | (mac[1] << 16) | ((uint32_t)mac[0] << 24));
+	HERCULES_REG_WRITE(regs, MACSRCADDRLO, mac[5] | (mac[4] << 8));
+	HERCULES_REG_WRITE(regs, MACINDEX, 0);
+	HERCULES_REG_WRITE(regs, MACADDRHI,
+			   mac[0] | (mac[1] << 8) | (mac[2] << 16) | ((uint32_t)mac[3] << 24));
+	HERCULES_REG_WRITE(regs, MACADDRLO,
+			   mac[4] | (mac[5] << 8) | EMAC_MACADDRLO_MATCHFILT |
+				   EMAC_MACADDRLO_VALID);
+}
+
+static void emac_set_link(volatile struct hercules_emac_regs *regs, bool full_duplex, bool fast)
+{
+	uint32_t ctl = EMAC_MACCONTROL_GMIIEN;
+
+	if (full_duplex) {
+		ctl |= EMAC_MACCONTROL_FULLDUPLEX;
+	}
+	if (fast) {
+		ctl |= EMAC_MACCONTROL_RMIISPEED;
+	}
+	HERCULES_REG_WRITE(regs, MACCONTROL, ctl);
+}
+
+static int eth_ti_hercules_emac_send(const struct device *dev, struct net_pkt *pkt)
+{
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+	volatile struct hercules_emac_regs *regs = DEV_REGS(dev);
+	volatile struct emac_desc *ring = EMAC_TX_RING(dev);
+	volatile struct emac_desc *desc = NULL;
+	size_t len = net_pkt_get_len(pkt);
+	uint32_t pad = len < EMAC_MIN_FRAME ? EMAC_MIN_FRAME - len : 0U;
+	uint32_t needed = pad != 0U ? 1U : 0U;
+	uint32_t first, idx;
+	bool idle;
+	k_spinlock_key_t key;
+
+	for (struct net_buf *frag = pkt->buffer; frag != NULL; frag = frag->frags) {
+		if (frag->len != 0U) {
+			needed++;
+		}
+	}
+	if (len == 0U || needed > EMAC_TX_DESCS) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+	while (data->tx_free < needed) {
+		k_spin_unlock(&data->lock, key);
+		if (k_sem_take(&data->tx_sem, EMAC_TX_TIMEOUT) != 0) {
+			return -EIO;
+		}
+		key = k_spin_lock(&data->lock);
+	}
+
+	/*
+	 * One descriptor per fragment: the EMAC gathers the frame straight out of the
+	 * net_buf chain, which stays referenced until the completion interrupt.
+	 */
+	first = data->tx_head;
+	idx = first;
+	for (struct net_buf *frag = pkt->buffer; frag != NULL; frag = frag->frags) {
+		if (frag->len == 0U) {
+			continue;
+		}
+		sys_cache_data_flush_range(frag->data, frag->len);
+		if (desc != NULL) {
+			desc->next = EMAC_DESC_ADDR(dev, &ring[idx]);
+		}
+		desc = &ring[idx];
+		desc->next = 0;
+		desc->buf = (uint32_t)(uintptr_t)frag->data;
+		desc->off_len = frag->len;
+		desc->flags_len = 0;
+		idx = EMAC_TX_NEXT(idx);
+	}
+	if (pad != 0U) {
+		desc->next = EMAC_DESC_ADDR(dev, &ring[idx]);
+		desc = &ring[idx];
+		desc->next = 0;
+		desc->buf = (uint32_t)(uintptr_t)emac_tx_pad;
+		desc->off_len = pad;
+		desc->flags_len = 0;
+		idx = EMAC_TX_NEXT(idx);
+	}
+	desc->flags_len = EMAC_DESC_EOP;
+	ring[first].flags_len |= EMAC_DESC_SOP | EMAC_DESC_OWNER | (len + pad);
+
+	data->tx_pkts[EMAC_TX_PREV(idx)] = net_pkt_ref(pkt);
+	idle = data->tx_free == EMAC_TX_DESCS;
+	data->tx_free -= needed;
+	data->tx_head = idx;
+
+	/*
+	 * Append to the queue in flight. Should the EMAC have stopped on the old tail
+	 * before seeing the link, the completion interrupt restarts it from there.
+	 */
+	if (idle) {
+		HERCULES_REG_WRITE(regs, TXHDP[0], EMAC_DESC_ADDR(dev, &ring[first]));
+	} else {
+		ring[EMAC_TX_PREV(first)].next = EMAC_DESC_ADDR(dev, &ring[first]);
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return 0;
+}
+
+static void eth_ti_hercules_emac_tx_isr(const struct device *dev)
+{
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+	volatile struct hercules_emac_regs *regs = DEV_REGS(dev);
+	volatile struct emac_desc *ring = EMAC_TX_RING(dev);
+	volatile struct emac_desc *last = NULL;
+	uint32_t restart = 0U;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	/* The EMAC releases a frame by clearing OWNER in its SOP descriptor */
+	while (data->tx_free < EMAC_TX_DESCS &&
+	       (ring[data->tx_tail].flags_len & EMAC_DESC_OWNER) == 0U) {
+		uint32_t idx = data->tx_tail;
+		uint32_t flags;
+
+		do {
+			last = &ring[idx];
+			flags = last->flags_len;
+			data->tx_free++;
+			idx = EMAC_TX_NEXT(idx);
+		} while ((flags & EMAC_DESC_EOP) == 0U);
+
+		net_pkt_unref(data->tx_pkts[EMAC_TX_PREV(idx)]);
+		data->tx_pkts[EMAC_TX_PREV(idx)] = NULL;
+		data->tx_tail = idx;
+		restart = (flags & EMAC_DESC_EOQ) != 0U ? last->next : 0U;
+	}
+
+	if (last != NULL) {
+		HERCULES_REG_WRITE(regs, TXCP[0], EMAC_DESC_ADDR(dev, last));
+		if (restart != 0U) {
+			HERCULES_REG_WRITE(regs, TXHDP[0], restart);
+		}
+		k_sem_give(&data->tx_sem);
+	}
+	HERCULES_REG_WRITE(regs, MACEOIVECTOR, EMAC_EOI_TX);
+	k_spin_unlock(&data->lock, key);
+}
+
+/* Hand a receive descriptor back to the EMAC by appending it to the queue tail. */
+static void emac_rx_requeue(const struct device *dev, uint32_t idx)
+{
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+	volatile struct emac_desc *ring = EMAC_RX_RING(dev);
+	struct net_buf *buf = data->rx_bufs[idx];
+
+	sys_cache_data_invd_range(buf->data, net_buf_tailroom(buf));
+	ring[idx].next = 0;
+	ring[idx].buf = (uint32_t)(uintptr_t)buf->data;
+	ring[idx].off_len = net_buf_tailroom(buf);
+	ring[idx].flags_len = EMAC_DESC_OWNER;
+	ring[EMAC_RX_PREV(idx)].next = EMAC_DESC_ADDR(dev, &ring[idx]);
+}
+
+/*
+ * Move a filled buffer into the packet and give the descriptor a fresh one. When
+ * no replacement is available the old buffer is recycled and the frame dropped.
+ */
+static struct net_pkt *emac_rx_take(struct eth_ti_hercules_emac_data *data, uint32_t idx,
+				    struct net_pkt *pkt, uint32_t len)
+{
+	struct net_buf *buf = data->rx_bufs[idx];
+	struct net_buf *fresh;
+
+	if (pkt == NULL) {
+		return NULL;
+	}
+	fresh = net_pkt_get_reserve_rx_data(EMAC_RX_MAXLEN, K_NO_WAIT);
+	if (fresh == NULL) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	sys_cache_data_invd_range(buf->data, len);
+	net_buf_add(buf, len);
+	net_pkt_frag_add(pkt, buf);
+	data->rx_bufs[idx] = fresh;
+	return pkt;
+}
+
+static void eth_ti_hercules_emac_rx(const struct device *dev)
+{
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+	volatile struct hercules_emac_regs *regs = DEV_REGS(dev);
+	volatile struct emac_desc *ring = EMAC_RX_RING(dev);
+	volatile struct emac_desc *last = NULL;
+	uint32_t restart = 0U;
+
+	while ((ring[data->rx_head].flags_len & EMAC_DESC_OWNER) == 0U) {
+		uint32_t idx = data->rx_head;
+		uint32_t flags = ring[idx].flags_len;
+		struct net_pkt *pkt = NULL;
+
+		if ((flags & EMAC_DESC_RX_ERR) == 0U) {
+			pkt = net_pkt_rx_alloc_on_iface(data->iface, K_NO_WAIT);
+		}
+
+		do {
+			flags = ring[idx].flags_len;
+			pkt = emac_rx_take(data, idx, pkt, ring[idx].off_len & EMAC_DESC_LEN_MASK);
+			/*
+			 * The queue only ever ends on the descriptor requeued last, so
+			 * everything after it has been handed back already.
+			 */
+			if ((flags & EMAC_DESC_EOQ) != 0U) {
+				restart = EMAC_DESC_ADDR(dev, &ring[EMAC_RX_NEXT(idx)]);
+			}
+			emac_rx_requeue(dev, idx);
+			last = &ring[idx];
+			idx = EMAC_RX_NEXT(idx);
+		} while ((flags & EMAC_DESC_EOP) == 0U);
+		data->rx_head = idx;
+
+		if (pkt == NULL) {
+			eth_stats_update_errors_rx(data->iface);
+		} else if (net_recv_data(data->iface, pkt) < 0) {
+			net_pkt_unref(pkt);
+		}
+	}
+
+	if (last != NULL) {
+		HERCULES_REG_WRITE(regs, RXCP[0], EMAC_DESC_ADDR(dev, last));
+		if (restart != 0U) {
+			HERCULES_REG_WRITE(regs, RXHDP[0], restart);
+		}
+	}
+}
+
+static void eth_ti_hercules_emac_rx_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&data->rx_sem, K_FOREVER);
+		eth_ti_hercules_emac_rx(dev);
+		HERCULES_REG_WRITE(DEV_REGS(dev), MACEOIVECTOR, EMAC_EOI_RX);
+		HERCULES_REG_WRITE(DEV_CTRL(dev), C0RXEN, BIT(0));
+	}
+}
+
+static void eth_ti_hercules_emac_rx_isr(const struct device *dev)
+{
+	/* Mask the pulse until the thread has drained the ring */
+	HERCULES_REG_WRITE(DEV_CTRL(dev), C0RXEN, 0);
+	k_sem_give(&DEV_DATA(dev)->rx_sem);
+}
+
+static void eth_ti_hercules_emac_phy_cb(const struct device *phy, struct phy_link_state *state,
+					void *user_data)
+{
+	const struct device *dev = user_data;
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+
+	ARG_UNUSED(phy);
+
+	if (state->is_up) {
+		emac_set_link(DEV_REGS(dev), PHY_LINK_IS_FULL_DUPLEX(state->speed),
+			      PHY_LINK_IS_SPEED_100M(state->speed));
+		net_eth_carrier_on(data->iface);
+	} else {
+		net_eth_carrier_off(data->iface);
+	}
+}
+
+static void eth_ti_hercules_emac_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	const struct eth_ti_hercules_emac_config *cfg = DEV_CFG(dev);
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+	volatile struct hercules_emac_regs *regs = DEV_REGS(dev);
+	volatile struct emac_desc *ring = EMAC_RX_RING(dev);
+
+	if (data->iface == NULL) {
+		data->iface = iface;
+	}
+	ethernet_init(iface);
+	net_if_set_link_addr(iface, data->mac_addr, sizeof(data->mac_addr), NET_LINK_ETHERNET);
+
+	for (uint32_t i = 0; i < EMAC_RX_DESCS; i++) {
+		if (data->rx_bufs[i] == NULL) {
+			data->rx_bufs[i] = net_pkt_get_reserve_rx_data(EMAC_RX_MAXLEN, K_FOREVER);
+		}
+		emac_rx_requeue(dev, i);
+	}
+	data->rx_head = 0;
+
+	HERCULES_REG_WRITE(regs, RXHDP[0], EMAC_DESC_ADDR(dev, &ring[0]));
+	HERCULES_REG_WRITE(regs, RXCONTROL, 1);
+	HERCULES_REG_WRITE(regs, TXCONTROL, 1);
+
+	net_if_carrier_off(iface);
+	if (cfg->phy_dev != NULL) {
+		emac_set_link(regs, false, false);
+		phy_link_callback_set(cfg->phy_dev, eth_ti_hercules_emac_phy_cb, (void *)dev);
+	} else {
+		emac_set_link(regs, true, true);
+		net_eth_carrier_on(iface);
+	}
+}
+
+static enum ethernet_hw_caps eth_ti_hercules_emac_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return ETHERNET_LINK_10BASE | ETHERNET_LINK_100BASE |
+	       COND_CODE_1(CONFIG_NET_PROMISCUOUS_MODE, (ETHERNET_PROMISC_MODE), (0));
+}
+
+static int eth_ti_hercules_emac_set_config(const struct device *dev, enum ethernet_config_type type,
+					   const struct ethernet_config *config)
+{
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+	volatile struct hercules_emac_regs *regs = DEV_REGS(dev);
+
+	switch (type) {
+	case ETHERNET_CONFIG_TYPE_MAC_ADDRESS:
+		memcpy(data->mac_addr, config->mac_address.addr, sizeof(data->mac_addr));
+		emac_set_mac(regs, data->mac_addr);
+		net_if_set_link_addr(data->iface, data->mac_addr, sizeof(data->mac_addr),
+				     NET_LINK_ETHERNET);
+		return 0;
+#ifdef CONFIG_NET_PROMISCUOUS_MODE
+	case ETHERNET_CONFIG_TYPE_PROMISC_MODE:
+		if (config->promisc_mode) {
+			HERCULES_REG_UPDATE(regs, RXMBPENABLE, 0, EMAC_RXMBP_CAFEN);
+		} else {
+			HERCULES_REG_UPDATE(regs, RXMBPENABLE, EMAC_RXMBP_CAFEN, 0);
+		}
+		return 0;
+#endif
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static const struct device *eth_ti_hercules_emac_get_phy(const struct device *dev)
+{
+	return DEV_CFG(dev)->phy_dev;
+}
+
+static int eth_ti_hercules_emac_init(const struct device *dev)
+{
+	const struct eth_ti_hercules_emac_config *cfg = DEV_CFG(dev);
+	struct eth_ti_hercules_emac_data *data = DEV_DATA(dev);
+	volatile struct hercules_emac_regs *regs = DEV_REGS(dev);
+	volatile struct hercules_emac_ctrl_regs *ctrl = DEV_CTRL(dev);
+	uint32_t rate;
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	if (cfg->phy_dev != NULL && !device_is_ready(cfg->phy_dev)) {
+		return -ENODEV;
+	}
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &rate);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (cfg->random_mac) {
+		gen_random_mac(data->mac_addr, 0x00, 0x12, 0x37);
+	}
+
+	k_sem_init(&data->tx_sem, 0, 1);
+	k_sem_init(&data->rx_sem, 0, 1);
+	data->tx_free = EMAC_TX_DESCS;
+	sys_cache_data_flush_range(emac_tx_pad, sizeof(emac_tx_pad));
+
+	HERCULES_REG_WRITE(ctrl, SOFTRESET, 1);
+	while ((HERCULES_REG_READ(ctrl, SOFTRESET) & 1U) != 0U) {
+		/* nop */;
+	}
+	HERCULES_REG_WRITE(regs, SOFTRESET, 1);
+	while ((HERCULES_REG_READ(regs, SOFTRESET) & 1U) != 0U) {
+		/* nop */;
+	}
+
+	HERCULES_REG_WRITE(regs, MACCONTROL, 0);
+	HERCULES_REG_WRITE(regs, TXCONTROL, 0);
+	HERCULES_REG_WRITE(regs, RXCONTROL, 0);
+	for (size_t i = 0; i < ARRAY_SIZE(regs->TXHDP); i++) {
+		HERCULES_REG_WRITE(regs, TXHDP[i], 0);
+		HERCULES_REG_WRITE(regs, RXHDP[i], 0);
+		HERCULES_REG_WRITE(regs, TXCP[i], 0);
+		HERCULES_REG_WRITE(regs, RXCP[i], 0);
+	}
+
+	emac_set_mac(regs, data->mac_addr);
+	/* Accept every multicast group, the stack filters what it did not join */
+	HERCULES_REG_WRITE(regs, MACHASH1, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, MACHASH2, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, RXMBPENABLE, EMAC_RXMBP_MULTEN | EMAC_RXMBP_BROADEN);
+	HERCULES_REG_WRITE(regs, RXUNICASTCLEAR, 0xFF);
+	HERCULES_REG_WRITE(regs, RXUNICASTSET, BIT(0));
+	HERCULES_REG_WRITE(regs, RXMAXLEN, EMAC_RX_MAXLEN);
+	HERCULES_REG_WRITE(regs, RXBUFFEROFFSET, 0);
+
+	/* Interrupt pacing caps the pulse rate, batching completions per interrupt */
+	if (EMAC_RX_PACING > 0 || EMAC_TX_PACING > 0) {
+		HERCULES_REG_WRITE(ctrl, INTCONTROL,
+				   (rate / EMAC_PACING_TICK_HZ) & EMAC_CTRL_PRESCALE);
+	}
+	if (EMAC_RX_PACING > 0) {
+		HERCULES_REG_WRITE(ctrl, C0RXIMAX, MAX(EMAC_RX_PACING, EMAC_PACING_MIN));
+		HERCULES_REG_UPDATE(ctrl, INTCONTROL, 0, EMAC_CTRL_C0RXPACEEN);
+	}
+	if (EMAC_TX_PACING > 0) {
+		HERCULES_REG_WRITE(ctrl, C0TXIMAX, MAX(EMAC_TX_PACING, EMAC_PACING_MIN));
+		HERCULES_REG_UPDATE(ctrl, INTCONTROL, 0, EMAC_CTRL_C0TXPACEEN);
+	}
+
+	HERCULES_REG_WRITE(regs, TXINTMASKSET, BIT(0));
+	HERCULES_REG_WRITE(regs, RXINTMASKSET, BIT(0));
+	HERCULES_REG_WRITE(ctrl, C0TXEN, BIT(0));
+	HERCULES_REG_WRITE(ctrl, C0RXEN, BIT(0));
+
+	k_thread_create(&data->rx_thread, data->rx_stack, K_KERNEL_STACK_SIZEOF(data->rx_stack),
+			eth_ti_hercules_emac_rx_thread, (void *)dev, NULL, NULL,
+			K_PRIO_COOP(CONFIG_ETH_TI_HERCULES_RX_THREAD_PRIO), 0, K_NO_WAIT);
+	k_thread_name_set(&data->rx_thread, "emac_rx");
+
+	cfg->irq_config_func(dev);
+	return 0;
+}
+
+static const struct ethernet_api eth_ti_hercules_emac_api = {
+	.iface_api.init = eth_ti_hercules_emac_iface_init,
+	.get_capabilities = eth_ti_hercules_emac_get_capabilities,
+	.set_config = eth_ti_hercules_emac_set_config,
+	.get_phy = eth_ti_hercules_emac_get_phy,
+	.send = eth_ti_hercules_emac_send,
+};
+
+#define EMAC_PHY_DEV(n)                                                                            \
+	COND_CODE_1(DT_INST_NODE_HAS_PROP(n, phy_handle),                                          \
+		    (DEVICE_DT_GET(DT_INST_PHANDLE(n, phy_handle))), (NULL))
+
+#define ETH_TI_HERCULES_EMAC_INIT(n)                                                               \
+	BUILD_ASSERT((EMAC_TX_DESCS + EMAC_RX_DESCS) * sizeof(struct emac_desc) <=                 \
+			     DT_INST_REG_SIZE_BY_NAME(n, cppi),                                    \
+		     "Descriptor rings do not fit in CPPI RAM");                                   \
+	static void eth_ti_hercules_emac_irq_config_##n(const struct device *dev)                  \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(n, tx, irq), DT_INST_IRQ_BY_NAME(n, tx, priority), \
+			    eth_ti_hercules_emac_tx_isr, DEVICE_DT_INST_GET(n),                    \
+			    DT_INST_IRQ_BY_NAME(n, tx, type));                                     \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(n, rx, irq), DT_INST_IRQ_BY_NAME(n, rx, priority), \
+			    eth_ti_hercules_emac_rx_isr, DEVICE_DT_INST_GET(n),                    \
+			    DT_INST_IRQ_BY_NAME(n, rx, type));                                     \
+		irq_enable(DT_INST_IRQ_BY_NAME(n, tx, irq));                                       \
+		irq_enable(DT_INST_IRQ_BY_NAME(n, rx, irq));                                       \
+	}                                                                                          \
+	static const struct eth_ti_hercules_emac_config eth_ti_hercules_emac_config_##n = {       \
+		.base = DT_INST_REG_ADDR_BY_NAME(n, emac),                                         \
+		.ctrl = DT_INST_REG_ADDR_BY_NAME(n, ctrl),                                         \
+		.cppi = DT_INST_REG_ADDR_BY_NAME(n, cppi),                                         \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.phy_dev = EMAC_PHY_DEV(n),                                                        \
+		.random_mac = DT_INST_PROP(n, zephyr_random_mac_address),                          \
+		.irq_config_func = eth_ti_hercules_emac_irq_config_##n,                            \
+	};                                                                                         \
+	static struct eth_ti_hercules_emac_data eth_ti_hercules_emac_data_##n = {                  \
+		.mac_addr = DT_INST_PROP_OR(n, local_mac_address, {0}),                            \
+	};                                                                                         \
+	ETH_NET_DEVICE_DT_INST_DEFINE(n, eth_ti_hercules_emac_init, NULL,                          \
+				      &eth_ti_hercules_emac_data_##n,                              \
+				      &eth_ti_hercules_emac_config_##n, CONFIG_ETH_INIT_PRIORITY,  \
+				      &eth_ti_hercules_emac_api, NET_ETH_MTU);
+
+DT_INST_FOREACH_STATUS_OKAY(ETH_TI_HERCULES_EMAC_INIT)
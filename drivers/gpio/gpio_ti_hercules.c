@@ -4,3 +4,380 @@
  */
 
 #define DT_DRV_COMPAT ti_hercules_gio
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/gpio/gpio_utils.h>
+#include <zephyr/irq.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <stddef.h>
+
+#define GIO_NODE DT_NODELABEL(gio)
+
+/* Only GIOA and GIOB can raise interrupts, 8 pins each. */
+#define GIO_INT_BANKS         2U
+#define GIO_INT_PINS_PER_BANK 8U
+
+#define GIO_RESET BIT(0)
+
+struct hercules_gio_regs {
+	uint32_t GCR0;    /* 0x0000 */
+	uint32_t rsvd1;   /* 0x0004 */
+	uint32_t INTDET;  /* 0x0008 */
+	uint32_t POL;     /* 0x000C */
+	uint32_t ENASET;  /* 0x0010 */
+	uint32_t ENACLR;  /* 0x0014 */
+	uint32_t LVLSET;  /* 0x0018 */
+	uint32_t LVLCLR;  /* 0x001C */
+	uint32_t FLG;     /* 0x0020 */
+	uint32_t OFF1;    /* 0x0024 INTOFFA */
+	uint32_t OFF2;    /* 0x0028 INTOFFB */
+	uint32_t EMU1;    /* 0x002C */
+	uint32_t EMU2;    /* 0x0030 */
+};
+
+/* Layout shared by the GIO ports and the GIO function of other modules. */
+struct hercules_gio_port_regs {
+	uint32_t DIR;    /* 0x0000 */
+	uint32_t DIN;    /* 0x0004 */
+	uint32_t DOUT;   /* 0x0008 */
+	uint32_t DSET;   /* 0x000C */
+	uint32_t DCLR;   /* 0x0010 */
+	uint32_t PDR;    /* 0x0014 */
+	uint32_t PULDIS; /* 0x0018 */
+	uint32_t PSL;    /* 0x001C */
+};
+
+struct gpio_ti_hercules_config {
+	/* gpio_driver_config needs to be first */
+	struct gpio_driver_config common;
+	uintptr_t base;
+	int8_t int_bank;
+	uint8_t low_prio_pins;
+};
+
+struct gpio_ti_hercules_data {
+	/* gpio_driver_data needs to be first */
+	struct gpio_driver_data common;
+	sys_slist_t callbacks;
+	struct k_spinlock lock;
+	/* Pins with emulated level interrupts and their active level. */
+	uint8_t level_pins;
+	uint8_t level_high;
+#if DT_NODE_HAS_STATUS_OKAY(GIO_NODE)
+	/* Fires level pins that were already active when they got enabled */
+	struct k_work level_work;
+	const struct device *dev;
+#endif
+};
+
+#define DEV_CFG(dev)  ((const struct gpio_ti_hercules_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct gpio_ti_hercules_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_gio_port_regs *)DEV_CFG(dev)->base)
+
+static int gpio_ti_hercules_pin_configure(const struct device *dev, gpio_pin_t pin,
+					  gpio_flags_t flags)
+{
+	volatile struct hercules_gio_port_regs *regs = DEV_REGS(dev);
+	struct gpio_ti_hercules_data *data = DEV_DATA(dev);
+	uint32_t mask = BIT(pin);
+	k_spinlock_key_t key;
+
+	if ((flags & GPIO_SINGLE_ENDED) != 0 && (flags & GPIO_LINE_OPEN_DRAIN) == 0) {
+		/* Open source outputs are not supported by the pad logic */
+		return -ENOTSUP;
+	}
+
+	key = k_spin_lock(&data->lock);
+
+	if ((flags & (GPIO_PULL_UP | GPIO_PULL_DOWN)) == 0) {
+		regs->PULDIS |= mask;
+	} else {
+		if ((flags & GPIO_PULL_UP) != 0) {
+			regs->PSL |= mask;
+		} else {
+			regs->PSL &= ~mask;
+		}
+		regs->PULDIS &= ~mask;
+	}
+
+	if ((flags & GPIO_OUTPUT) != 0) {
+		if ((flags & GPIO_SINGLE_ENDED) != 0) {
+			regs->PDR |= mask;
+		} else {
+			regs->PDR &= ~mask;
+		}
+		/* Latch the initial level before turning the driver on */
+		if ((flags & GPIO_OUTPUT_INIT_HIGH) != 0) {
+			regs->DSET = mask;
+		} else if ((flags & GPIO_OUTPUT_INIT_LOW) != 0) {
+			regs->DCLR = mask;
+		}
+		regs->DIR |= mask;
+	} else {
+		/* DIN always reflects the pad, inputs only need the driver off */
+		regs->DIR &= ~mask;
+	}
+
+	k_spin_unlock(&data->lock, key);
+	return 0;
+}
+
+static int gpio_ti_hercules_port_get_raw(const struct device *dev, gpio_port_value_t *value)
+{
+	*value = DEV_REGS(dev)->DIN;
+	return 0;
+}
+
+static int gpio_ti_hercules_port_set_masked_raw(const struct device *dev, gpio_port_pins_t mask,
+						gpio_port_value_t value)
+{
+	volatile struct hercules_gio_port_regs *regs = DEV_REGS(dev);
+
+	/* Two single writes, no read-modify-write of DOUT required */
+	regs->DSET = value & mask;
+	regs->DCLR = ~value & mask;
+	return 0;
+}
+
+static int gpio_ti_hercules_port_set_bits_raw(const struct device *dev, gpio_port_pins_t pins)
+{
+	DEV_REGS(dev)->DSET = pins;
+	return 0;
+}
+
+static int gpio_ti_hercules_port_clear_bits_raw(const struct device *dev, gpio_port_pins_t pins)
+{
+	DEV_REGS(dev)->DCLR = pins;
+	return 0;
+}
+
+static int gpio_ti_hercules_port_toggle_bits(const struct device *dev, gpio_port_pins_t pins)
+{
+	volatile struct hercules_gio_port_regs *regs = DEV_REGS(dev);
+	uint32_t dout = regs->DOUT;
+
+	regs->DSET = ~dout & pins;
+	regs->DCLR = dout & pins;
+	return 0;
+}
+
+#if DT_NODE_HAS_STATUS_OKAY(GIO_NODE)
+
+/* Serializes the interrupt registers shared between GIOA and GIOB */
+static struct k_spinlock gio_lock;
+
+static int gpio_ti_hercules_pin_interrupt_configure(const struct device *dev, gpio_pin_t pin,
+						    enum gpio_int_mode mode,
+						    enum gpio_int_trig trig)
+{
+	const struct gpio_ti_hercules_config *cfg = DEV_CFG(dev);
+	struct gpio_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_gio_regs *gio = (void *)DT_REG_ADDR(GIO_NODE);
+	uint32_t mask;
+	k_spinlock_key_t key;
+
+	if (cfg->int_bank < 0 || pin >= GIO_INT_PINS_PER_BANK) {
+		return -ENOTSUP;
+	}
+
+	mask = BIT(pin + (cfg->int_bank * GIO_INT_PINS_PER_BANK));
+
+	key = k_spin_lock(&gio_lock);
+
+	gio->ENACLR = mask;
+	data->level_pins &= ~BIT(pin);
+
+	if (mode == GPIO_INT_MODE_DISABLED) {
+		k_spin_unlock(&gio_lock, key);
+		return 0;
+	}
+
+	if (trig == GPIO_INT_TRIG_BOTH) {
+		if (mode == GPIO_INT_MODE_LEVEL) {
+			k_spin_unlock(&gio_lock, key);
+			return -ENOTSUP;
+		}
+		gio->INTDET |= mask;
+	} else {
+		gio->INTDET &= ~mask;
+		if (trig == GPIO_INT_TRIG_HIGH) {
+			gio->POL |= mask;
+		} else {
+			gio->POL &= ~mask;
+		}
+	}
+
+	/*
+	 * GIO only detects edges. Level interrupts are armed on the edge into
+	 * the active level and disabled once they fired, so a callback that
+	 * defers its work does not keep the ISR busy. Enabling the interrupt
+	 * again fires it right away if the pin is still at the active level.
+	 */
+	if (mode == GPIO_INT_MODE_LEVEL) {
+		data->level_pins |= BIT(pin);
+		WRITE_BIT(data->level_high, pin, trig == GPIO_INT_TRIG_HIGH);
+	}
+
+	if ((cfg->low_prio_pins & BIT(pin)) != 0) {
+		gio->LVLCLR = mask;
+	} else {
+		gio->LVLSET = mask;
+	}
+
+	/* Drop any edge latched while the pin was reconfigured */
+	gio->FLG = mask;
+	gio->ENASET = mask;
+
+	if (mode == GPIO_INT_MODE_LEVEL && (gio->FLG & mask) == 0U &&
+	    ((DEV_REGS(dev)->DIN >> pin) & 1U) == ((data->level_high >> pin) & 1U)) {
+		data->dev = dev;
+		k_work_submit(&data->level_work);
+	}
+
+	k_spin_unlock(&gio_lock, key);
+	return 0;
+}
+
+static void gpio_ti_hercules_level_work(struct k_work *work)
+{
+	struct gpio_ti_hercules_data *data =
+		CONTAINER_OF(work, struct gpio_ti_hercules_data, level_work);
+	const struct device *dev = data->dev;
+	const struct gpio_ti_hercules_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_gio_regs *gio = (void *)DT_REG_ADDR(GIO_NODE);
+	uint32_t shift = cfg->int_bank * GIO_INT_PINS_PER_BANK;
+	k_spinlock_key_t key;
+	uint32_t active;
+
+	key = k_spin_lock(&gio_lock);
+	active = ~(DEV_REGS(dev)->DIN ^ data->level_high) & data->level_pins &
+		 (gio->ENASET >> shift) & BIT_MASK(GIO_INT_PINS_PER_BANK);
+	gio->ENACLR = active << shift;
+	k_spin_unlock(&gio_lock, key);
+
+	if (active != 0U) {
+		gpio_fire_callbacks(&data->callbacks, dev, active);
+	}
+}
+
+static int gpio_ti_hercules_manage_callback(const struct device *dev,
+					    struct gpio_callback *callback, bool set)
+{
+	return gpio_manage_callback(&DEV_DATA(dev)->callbacks, callback, set);
+}
+
+static uint32_t gpio_ti_hercules_get_pending_int(const struct device *dev)
+{
+	const struct gpio_ti_hercules_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_gio_regs *gio = (void *)DT_REG_ADDR(GIO_NODE);
+
+	if (cfg->int_bank < 0) {
+		return 0;
+	}
+	return (gio->FLG >> (cfg->int_bank * GIO_INT_PINS_PER_BANK)) & BIT_MASK(8);
+}
+
+#endif /* DT_NODE_HAS_STATUS_OKAY(GIO_NODE) */
+
+static DEVICE_API(gpio, gpio_ti_hercules_api) = {
+	.pin_configure = gpio_ti_hercules_pin_configure,
+	.port_get_raw = gpio_ti_hercules_port_get_raw,
+	.port_set_masked_raw = gpio_ti_hercules_port_set_masked_raw,
+	.port_set_bits_raw = gpio_ti_hercules_port_set_bits_raw,
+	.port_clear_bits_raw = gpio_ti_hercules_port_clear_bits_raw,
+	.port_toggle_bits = gpio_ti_hercules_port_toggle_bits,
+#if DT_NODE_HAS_STATUS_OKAY(GIO_NODE)
+	.pin_interrupt_configure = gpio_ti_hercules_pin_interrupt_configure,
+	.manage_callback = gpio_ti_hercules_manage_callback,
+	.get_pending_int = gpio_ti_hercules_get_pending_int,
+#endif
+};
+
+#define GPIO_TI_HERCULES_INIT(n)                                                                   \
+	static const struct gpio_ti_hercules_config gpio_ti_hercules_config_##n = {               \
+		.common = {.port_pin_mask = GPIO_PORT_PIN_MASK_FROM_DT_INST(n)},                   \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.int_bank = DT_INST_PROP_OR(n, interrupt_bank, -1),                                \
+		.low_prio_pins = DT_INST_PROP(n, low_priority_pins),                               \
+	};                                                                                         \
+	static struct gpio_ti_hercules_data gpio_ti_hercules_data_##n = {                          \
+		IF_ENABLED(DT_NODE_HAS_STATUS_OKAY(GIO_NODE),                                      \
+			   (.level_work = Z_WORK_INITIALIZER(gpio_ti_hercules_level_work),))       \
+	};                                                                                         \
+	DEVICE_DT_INST_DEFINE(n, NULL, NULL, &gpio_ti_hercules_data_##n,                           \
+			      &gpio_ti_hercules_config_##n, PRE_KERNEL_1,                          \
+			      CONFIG_GPIO_INIT_PRIORITY, &gpio_ti_hercules_api);
+
+DT_INST_FOREACH_STATUS_OKAY(GPIO_TI_HERCULES_INIT)
+
+#if DT_NODE_HAS_STATUS_OKAY(GIO_NODE)
+
+#define GIO_INT_PORT_ENTRY(n)                                                                      \
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(n, interrupt_bank),                                       \
+		   ([DT_INST_PROP(n, interrupt_bank)] = DEVICE_DT_INST_GET(n),))
+
+static const struct device *const gio_int_ports[GIO_INT_BANKS] = {
+	DT_INST_FOREACH_STATUS_OKAY(GIO_INT_PORT_ENTRY)};
+
+#define GIO_OFFSET_REG(reg)                                                                        \
+	((const void *)(DT_REG_ADDR(GIO_NODE) + offsetof(struct hercules_gio_regs, reg)))
+
+static void gpio_ti_hercules_isr(const void *arg)
+{
+	volatile uint32_t *offset_reg = (volatile uint32_t *)arg;
+	volatile struct hercules_gio_regs *gio = (void *)DT_REG_ADDR(GIO_NODE);
+	uint32_t offset;
+
+	/*
+	 * INTOFFx holds the 1-based number of the highest priority pending pin
+	 * and clears that pin's flag on read, so one load decodes each event.
+	 */
+	while ((offset = *offset_reg) != 0U) {
+		uint32_t bank = (offset - 1U) / GIO_INT_PINS_PER_BANK;
+		uint32_t pin = (offset - 1U) % GIO_INT_PINS_PER_BANK;
+		const struct device *dev = gio_int_ports[bank];
+		struct gpio_ti_hercules_data *data;
+
+		if (dev == NULL) {
+			continue;
+		}
+		data = DEV_DATA(dev);
+
+		/* Level pins are one shot, the callback may enable them again */
+		if ((data->level_pins & BIT(pin)) != 0U) {
+			gio->ENACLR = BIT(offset - 1U);
+		}
+		gpio_fire_callbacks(&data->callbacks, dev, BIT(pin));
+	}
+}
+
+static int gpio_ti_hercules_module_init(void)
+{
+	volatile struct hercules_gio_regs *gio = (void *)DT_REG_ADDR(GIO_NODE);
+
+	/* Release the module from reset with every pin interrupt disabled */
+	gio->GCR0 = GIO_RESET;
+	gio->ENACLR = UINT32_MAX;
+	gio->LVLCLR = UINT32_MAX;
+	gio->FLG = UINT32_MAX;
+
+	IRQ_CONNECT(DT_IRQ_BY_NAME(GIO_NODE, high, irq), DT_IRQ_BY_NAME(GIO_NODE, high, priority),
+		    gpio_ti_hercules_isr, GIO_OFFSET_REG(OFF1),
+		    DT_IRQ_BY_NAME(GIO_NODE, high, type));
+	IRQ_CONNECT(DT_IRQ_BY_NAME(GIO_NODE, low, irq), DT_IRQ_BY_NAME(GIO_NODE, low, priority),
+		    gpio_ti_hercules_isr, GIO_OFFSET_REG(OFF2),
+		    DT_IRQ_BY_NAME(GIO_NODE, low, type));
+	irq_enable(DT_IRQ_BY_NAME(GIO_NODE, high, irq));
+	irq_enable(DT_IRQ_BY_NAME(GIO_NODE, low, irq));
+	return 0;
+}
+
+SYS_INIT(gpio_ti_hercules_module_init, PRE_KERNEL_1, CONFIG_GPIO_INIT_PRIORITY);
+
+#endif /* DT_NODE_HAS_STATUS_OKAY(GIO_NODE) */
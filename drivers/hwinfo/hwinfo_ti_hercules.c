@@ -4,11 +4,14 @@
  */
 
 #include <zephyr/drivers/hwinfo.h>
+#include <zephyr/drivers/ti_hercules_sys_regs.h>
 #include <string.h>
 #include <soc.h>
 
-#define SYS_EXCEPTION (*(volatile uint32_t *)0xffffffe4U)
-#define DEVICE_ID_REV (*(volatile uint32_t *)0xfffffff0U)
+#define SYS1_REGS                                                                                  \
+	((volatile struct hercules_syscon_1_regs *)HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE)))
+#define SYS_EXCEPTION HERCULES_REG_READ(SYS1_REGS, SYSESR)
+#define DEVICE_ID_REV HERCULES_REG_READ(SYS1_REGS, DEVID)
 
 enum rm57lx_reset_bits {
 	POWERON_RESET = 0x8000U,
@@ -60,7 +63,7 @@ int z_impl_hwinfo_get_reset_cause(uint32_t *cause)
 
 int z_impl_hwinfo_clear_reset_cause(void)
 {
-	SYS_EXCEPTION = (uint32_t)UINT32_MAX;
+	HERCULES_REG_WRITE(SYS1_REGS, SYSESR, (uint32_t)UINT32_MAX);
 	return 0;
 }
 
@@ -0,0 +1,678 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * I2C controller driver. Consecutive messages of the same direction that are
+ * not separated by a restart are merged into one segment, which the I2C runs
+ * as a single counted burst with an automatic stop. Segment bytes are moved
+ * by the ISR, or by the DMA controller for single message segments when "tx"
+ * and "rx" dmas are given, in which case the CPU only sees the end of the
+ * segment.
+ */
+
+#define DT_DRV_COMPAT ti_hercules_i2c
+
+#include <soc.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(i2c_ti_hercules, CONFIG_I2C_LOG_LEVEL);
+
+#define I2C_MDR_NACKMOD BIT(15)
+#define I2C_MDR_FREE    BIT(14)
+#define I2C_MDR_STT     BIT(13)
+#define I2C_MDR_STP     BIT(11)
+#define I2C_MDR_MST     BIT(10)
+#define I2C_MDR_TRX     BIT(9)
+#define I2C_MDR_XA      BIT(8)
+#define I2C_MDR_IRS     BIT(5)
+
+#define I2C_STR_BB     BIT(12)
+#define I2C_INT_SCD    BIT(5)
+#define I2C_INT_XRDY   BIT(4)
+#define I2C_INT_RRDY   BIT(3)
+#define I2C_INT_ARDY   BIT(2)
+#define I2C_INT_NACK   BIT(1)
+#define I2C_INT_AL     BIT(0)
+#define I2C_INT_ALL    GENMASK(6, 0)
+
+/* ICIVR interrupt codes */
+#define I2C_IV_AL   1U
+#define I2C_IV_NACK 2U
+#define I2C_IV_ARDY 3U
+#define I2C_IV_RRDY 4U
+#define I2C_IV_XRDY 5U
+#define I2C_IV_SCD  6U
+
+#define I2C_DMAC_TXDMAEN BIT(1)
+#define I2C_DMAC_RXDMAEN BIT(0)
+
+/* GIO function of the I2C pins */
+#define I2C_PFNC_GIO BIT(0)
+#define I2C_PIN_SCL  BIT(0)
+#define I2C_PIN_SDA  BIT(1)
+
+/* The module clock VCLK / (IPSC + 1) must stay within 6.7 MHz and 13.3 MHz */
+#define I2C_MODULE_CLK_MAX 13300000U
+#define I2C_MAX_COUNT      0xFFFFU
+#define I2C_RECOVER_CLOCKS 9U
+/* How long another controller may keep the bus, the SMBus clock low timeout */
+#define I2C_BUSY_WAIT_US   (25U * USEC_PER_MSEC)
+
+#define DEV_CFG(dev)  ((const struct i2c_ti_hercules_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct i2c_ti_hercules_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_i2c_regs *)DEV_CFG(dev)->base)
+
+struct hercules_i2c_regs {
+	uint32_t ICOAR;    /* 0x00 */
+	uint32_t ICIMR;    /* 0x04 */
+	uint32_t ICSTR;    /* 0x08 */
+	uint32_t ICCKL;    /* 0x0C */
+	uint32_t ICCKH;    /* 0x10 */
+	uint32_t ICCNT;    /* 0x14 */
+	uint32_t ICDRR;    /* 0x18 */
+	uint32_t ICSAR;    /* 0x1C */
+	uint32_t ICDXR;    /* 0x20 */
+	uint32_t ICMDR;    /* 0x24 */
+	uint32_t ICIVR;    /* 0x28 */
+	uint32_t ICEMDR;   /* 0x2C */
+	uint32_t ICPSC;    /* 0x30 */
+	uint32_t ICPID1;   /* 0x34 */
+	uint32_t ICPID2;   /* 0x38 */
+	uint32_t ICDMAC;   /* 0x3C */
+	uint32_t rsvd1[2]; /* 0x40 */
+	uint32_t ICPFNC;   /* 0x48 */
+	uint32_t ICPDIR;   /* 0x4C */
+	uint32_t ICDIN;    /* 0x50 */
+	uint32_t ICDOUT;   /* 0x54 */
+	uint32_t ICDSET;   /* 0x58 */
+	uint32_t ICDCLR;   /* 0x5C */
+	uint32_t ICPDR;    /* 0x60 */
+	uint32_t ICPDIS;   /* 0x64 */
+	uint32_t ICPSEL;   /* 0x68 */
+	uint32_t ICPSRS;   /* 0x6C */
+};
+
+#ifdef CONFIG_DMA_TI_HERCULES
+struct i2c_ti_hercules_dma {
+	const struct device *dev;
+	uint32_t channel;
+	uint32_t slot;
+};
+#endif
+
+struct i2c_ti_hercules_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	uint32_t bitrate;
+	void (*irq_config_func)(const struct device *dev);
+#ifdef CONFIG_DMA_TI_HERCULES
+	struct i2c_ti_hercules_dma dma_tx;
+	struct i2c_ti_hercules_dma dma_rx;
+#endif
+};
+
+struct i2c_ti_hercules_data {
+	struct k_sem lock;
+	struct k_sem done;
+	uint32_t dev_config;
+	uint32_t psc;
+	uint32_t clkl;
+	uint32_t clkh;
+	uint32_t half_period_us;
+	/* The last segment ended without a stop, the next one starts with a restart */
+	bool bus_held;
+	/* Current segment: messages msg to last, msg at byte pos */
+	struct i2c_msg *msg;
+	struct i2c_msg *last;
+	uint32_t pos;
+	/* Parts left before the segment is done: the bus and the DMA channel */
+	uint8_t pending;
+	bool dma;
+	bool arb_lost;
+	int status;
+};
+
+static int i2c_ti_hercules_timing(const struct device *dev, uint32_t dev_config)
+{
+	const struct i2c_ti_hercules_config *cfg = DEV_CFG(dev);
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	uint32_t vclk, psc, module_clk, d, total, low, high, bitrate;
+	int ret;
+
+	switch (I2C_SPEED_GET(dev_config)) {
+	case I2C_SPEED_STANDARD:
+		bitrate = I2C_BITRATE_STANDARD;
+		break;
+	case I2C_SPEED_FAST:
+		bitrate = I2C_BITRATE_FAST;
+		break;
+	default:
+		/* The module is specified up to 400 kHz */
+		return -ENOTSUP;
+	}
+
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &vclk);
+	if (ret != 0) {
+		return ret;
+	}
+
+	psc = DIV_ROUND_UP(vclk, I2C_MODULE_CLK_MAX) - 1U;
+	if (psc > 0xFFU) {
+		return -EINVAL;
+	}
+	module_clk = vclk / (psc + 1U);
+	/* Every SCL phase is stretched by d module clocks */
+	d = psc == 0U ? 7U : (psc == 1U ? 6U : 5U);
+
+	/*
+	 * Round the period up so SCL never runs faster than requested. Fast
+	 * modes need a longer low than high phase, split the period 2:1.
+	 */
+	total = DIV_ROUND_UP(module_clk, bitrate);
+	low = bitrate > I2C_BITRATE_STANDARD ? DIV_ROUND_UP(2U * total, 3U)
+					     : DIV_ROUND_UP(total, 2U);
+	high = total - low;
+
+	data->psc = psc;
+	data->clkl = MAX(low, d) - d;
+	data->clkh = MAX(high, d) - d;
+	data->half_period_us = DIV_ROUND_UP(USEC_PER_SEC / 2U, bitrate);
+	return 0;
+}
+
+/* Reset the module and program the bus timing, leaves it idle as a controller */
+static void i2c_ti_hercules_setup(const struct device *dev)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_i2c_regs *regs = DEV_REGS(dev);
+
+	regs->ICMDR = 0U;
+	regs->ICPFNC = 0U;
+	regs->ICDMAC = 0U;
+	regs->ICIMR = 0U;
+	regs->ICPSC = data->psc;
+	regs->ICCKL = data->clkl;
+	regs->ICCKH = data->clkh;
+	regs->ICMDR = I2C_MDR_IRS | I2C_MDR_FREE;
+	regs->ICSTR = I2C_INT_ALL;
+	data->bus_held = false;
+}
+
+/*
+ * Free a bus held by a target that lost track of the clock: with the pins in
+ * GIO mode, clock SCL until the target releases SDA, then send a stop.
+ */
+static int i2c_ti_hercules_recover(const struct device *dev)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_i2c_regs *regs = DEV_REGS(dev);
+	uint32_t wait = data->half_period_us;
+	int ret = 0;
+
+	regs->ICMDR = 0U;
+	regs->ICPDR = I2C_PIN_SCL | I2C_PIN_SDA;
+	regs->ICDSET = I2C_PIN_SCL | I2C_PIN_SDA;
+	regs->ICPDIR = I2C_PIN_SCL | I2C_PIN_SDA;
+	regs->ICPFNC = I2C_PFNC_GIO;
+
+	for (uint32_t i = 0; i < I2C_RECOVER_CLOCKS && (regs->ICDIN & I2C_PIN_SDA) == 0U; i++) {
+		regs->ICDCLR = I2C_PIN_SCL;
+		k_busy_wait(wait);
+		regs->ICDSET = I2C_PIN_SCL;
+		k_busy_wait(wait);
+	}
+
+	regs->ICDCLR = I2C_PIN_SCL;
+	k_busy_wait(wait);
+	regs->ICDCLR = I2C_PIN_SDA;
+	k_busy_wait(wait);
+	regs->ICDSET = I2C_PIN_SCL;
+	k_busy_wait(wait);
+	regs->ICDSET = I2C_PIN_SDA;
+	k_busy_wait(wait);
+
+	if ((regs->ICDIN & (I2C_PIN_SCL | I2C_PIN_SDA)) != (I2C_PIN_SCL | I2C_PIN_SDA)) {
+		LOG_ERR("Bus still held after recovery");
+		ret = -EBUSY;
+	}
+
+	regs->ICPDIR = 0U;
+	regs->ICPDR = 0U;
+	i2c_ti_hercules_setup(dev);
+	return ret;
+}
+
+/* No transfer on the bus and both lines released, ICDIN follows the pins in either function */
+static bool i2c_ti_hercules_bus_idle(volatile struct hercules_i2c_regs *regs)
+{
+	return (regs->ICSTR & I2C_STR_BB) == 0U &&
+	       (regs->ICDIN & (I2C_PIN_SCL | I2C_PIN_SDA)) == (I2C_PIN_SCL | I2C_PIN_SDA);
+}
+
+/*
+ * Give another controller time to finish. A line still low after that is
+ * held by a target that lost track of the clock and the bus is recovered,
+ * a bus that is merely busy is left alone.
+ */
+static int i2c_ti_hercules_wait_idle(const struct device *dev)
+{
+	volatile struct hercules_i2c_regs *regs = DEV_REGS(dev);
+
+	if (WAIT_FOR(i2c_ti_hercules_bus_idle(regs), I2C_BUSY_WAIT_US, k_msleep(1))) {
+		return 0;
+	}
+	if ((regs->ICDIN & (I2C_PIN_SCL | I2C_PIN_SDA)) != (I2C_PIN_SCL | I2C_PIN_SDA)) {
+		LOG_WRN("Bus held low, recovering");
+		return i2c_ti_hercules_recover(dev);
+	}
+	LOG_WRN("Bus busy");
+	return -EBUSY;
+}
+
+static void i2c_ti_hercules_part_done(const struct device *dev)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	unsigned int key = irq_lock();
+
+	if (data->pending > 0U && --data->pending == 0U) {
+		DEV_REGS(dev)->ICIMR = 0U;
+		DEV_REGS(dev)->ICDMAC = 0U;
+		k_sem_give(&data->done);
+	}
+	irq_unlock(key);
+}
+
+/* Pointer to the next byte of the segment, NULL once all bytes are moved */
+static uint8_t *i2c_ti_hercules_next_byte(struct i2c_ti_hercules_data *data)
+{
+	while (data->pos == data->msg->len) {
+		if (data->msg == data->last) {
+			return NULL;
+		}
+		data->msg++;
+		data->pos = 0U;
+	}
+	return &data->msg->buf[data->pos++];
+}
+
+static void i2c_ti_hercules_isr(const struct device *dev)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_i2c_regs *regs = DEV_REGS(dev);
+	uint32_t code;
+	uint8_t *byte;
+
+	/* Reading ICIVR returns the highest priority pending event and clears it */
+	while ((code = regs->ICIVR & 0x7U) != 0U) {
+		switch (code) {
+		case I2C_IV_AL:
+			/* The controller fell back to target mode, the bus is someone else's */
+			data->status = -EIO;
+			data->arb_lost = true;
+			data->pending = 1U;
+			i2c_ti_hercules_part_done(dev);
+			break;
+		case I2C_IV_NACK:
+			data->status = -EIO;
+			regs->ICMDR |= I2C_MDR_STP;
+			break;
+		case I2C_IV_ARDY:
+			/* Count reached without a stop, the controller holds SCL low */
+			if (data->status == 0) {
+				i2c_ti_hercules_part_done(dev);
+			}
+			break;
+		case I2C_IV_RRDY:
+			byte = i2c_ti_hercules_next_byte(data);
+			if (byte != NULL) {
+				*byte = (uint8_t)regs->ICDRR;
+			} else {
+				(void)regs->ICDRR;
+			}
+			break;
+		case I2C_IV_XRDY:
+			byte = i2c_ti_hercules_next_byte(data);
+			if (byte != NULL) {
+				regs->ICDXR = *byte;
+			} else {
+				regs->ICIMR &= ~I2C_INT_XRDY;
+			}
+			break;
+		case I2C_IV_SCD:
+			if (data->status != 0 && data->dma) {
+				/* The DMA channel will not see its last request */
+				data->pending = 1U;
+			}
+			i2c_ti_hercules_part_done(dev);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+#ifdef CONFIG_DMA_TI_HERCULES
+static void i2c_ti_hercules_dma_done(const struct device *dma_dev, void *user_data,
+				     uint32_t channel, int status)
+{
+	const struct device *dev = user_data;
+
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(channel);
+
+	if (status < 0) {
+		DEV_DATA(dev)->status = -EIO;
+	}
+	i2c_ti_hercules_part_done(dev);
+}
+
+static int i2c_ti_hercules_start_dma(const struct device *dev, bool read)
+{
+	const struct i2c_ti_hercules_config *cfg = DEV_CFG(dev);
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_i2c_regs *regs = DEV_REGS(dev);
+	const struct i2c_ti_hercules_dma *dma = read ? &cfg->dma_rx : &cfg->dma_tx;
+	struct dma_block_config block = {
+		.source_address = read ? (uint32_t)&regs->ICDRR : (uint32_t)data->msg->buf,
+		.dest_address = read ? (uint32_t)data->msg->buf : (uint32_t)&regs->ICDXR,
+		.block_size = data->msg->len,
+		.source_addr_adj = read ? DMA_ADDR_ADJ_NO_CHANGE : DMA_ADDR_ADJ_INCREMENT,
+		.dest_addr_adj = read ? DMA_ADDR_ADJ_INCREMENT : DMA_ADDR_ADJ_NO_CHANGE,
+	};
+	struct dma_config dma_cfg = {
+		.dma_slot = dma->slot,
+		.channel_direction = read ? PERIPHERAL_TO_MEMORY : MEMORY_TO_PERIPHERAL,
+		.source_data_size = 1,
+		.dest_data_size = 1,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &block,
+		.dma_callback = i2c_ti_hercules_dma_done,
+		.user_data = (void *)dev,
+	};
+	int ret;
+
+	if (read) {
+		/* No dirty line may be written back over what the DMA stores */
+		sys_cache_data_invd_range(data->msg->buf, data->msg->len);
+	} else {
+		sys_cache_data_flush_range(data->msg->buf, data->msg->len);
+	}
+
+	ret = dma_config(dma->dev, dma->channel, &dma_cfg);
+	if (ret != 0) {
+		return ret;
+	}
+	ret = dma_start(dma->dev, dma->channel);
+	if (ret != 0) {
+		return ret;
+	}
+	regs->ICDMAC = read ? I2C_DMAC_RXDMAEN : I2C_DMAC_TXDMAEN;
+	return 0;
+}
+
+static void i2c_ti_hercules_stop_dma(const struct device *dev, bool read)
+{
+	const struct i2c_ti_hercules_config *cfg = DEV_CFG(dev);
+	const struct i2c_ti_hercules_dma *dma = read ? &cfg->dma_rx : &cfg->dma_tx;
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+
+	DEV_REGS(dev)->ICDMAC = 0U;
+	(void)dma_stop(dma->dev, dma->channel);
+	if (read) {
+		/* Drop lines the CPU fetched while the DMA was storing */
+		sys_cache_data_invd_range(data->msg->buf, data->msg->len);
+	}
+}
+#endif /* CONFIG_DMA_TI_HERCULES */
+
+/* Run msgs[0..count-1] as one burst, they share the direction */
+static int i2c_ti_hercules_segment(const struct device *dev, struct i2c_msg *msgs,
+				   uint8_t count, uint16_t addr, uint32_t len)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_i2c_regs *regs = DEV_REGS(dev);
+	struct i2c_msg *last = &msgs[count - 1U];
+	bool read = (msgs[0].flags & I2C_MSG_RW_MASK) == I2C_MSG_READ;
+	bool stop = (last->flags & I2C_MSG_STOP) != 0U;
+	uint32_t mdr = I2C_MDR_IRS | I2C_MDR_FREE | I2C_MDR_MST | I2C_MDR_STT;
+	/* After a NACK the segment still ends with the stop it forces */
+	uint32_t imr = I2C_INT_AL | I2C_INT_NACK | I2C_INT_SCD | (stop ? 0U : I2C_INT_ARDY);
+	/* Twice the time on the wire, plus scheduling slack */
+	k_timeout_t timeout =
+		K_USEC(2U * (len + 1U) * 9U * data->half_period_us * 2U + 10U * USEC_PER_MSEC);
+	int ret;
+
+	data->msg = msgs;
+	data->last = last;
+	data->pos = 0U;
+	data->status = 0;
+	data->pending = 1U;
+	data->dma = false;
+	data->arb_lost = false;
+	k_sem_reset(&data->done);
+
+	if (!read) {
+		mdr |= I2C_MDR_TRX;
+	}
+	if (stop) {
+		mdr |= I2C_MDR_STP;
+	}
+	if ((msgs[0].flags & I2C_MSG_ADDR_10_BITS) != 0U) {
+		mdr |= I2C_MDR_XA;
+	}
+
+#ifdef CONFIG_DMA_TI_HERCULES
+	if (count == 1U && (read ? DEV_CFG(dev)->dma_rx.dev : DEV_CFG(dev)->dma_tx.dev) != NULL &&
+	    i2c_ti_hercules_start_dma(dev, read) == 0) {
+		data->dma = true;
+		data->pending = 2U;
+	}
+#endif
+	if (!data->dma) {
+		imr |= read ? I2C_INT_RRDY : I2C_INT_XRDY;
+	}
+
+	regs->ICSTR = I2C_INT_ALL;
+	regs->ICSAR = addr;
+	regs->ICCNT = len;
+	regs->ICIMR = imr;
+	regs->ICMDR = mdr;
+
+	ret = k_sem_take(&data->done, timeout);
+
+#ifdef CONFIG_DMA_TI_HERCULES
+	if (data->dma) {
+		i2c_ti_hercules_stop_dma(dev, read);
+	}
+#endif
+	if (ret != 0) {
+		LOG_ERR("Transfer to 0x%x timed out", addr);
+		regs->ICIMR = 0U;
+		(void)i2c_ti_hercules_recover(dev);
+		return -EIO;
+	}
+	if (data->status != 0) {
+		/* A NACK ends in a stop, the bus is free again */
+		data->bus_held = false;
+		if (data->arb_lost) {
+			/* Lost to another controller or to a target holding SDA low */
+			(void)i2c_ti_hercules_wait_idle(dev);
+			i2c_ti_hercules_setup(dev);
+		}
+		return data->status;
+	}
+
+	data->bus_held = !stop;
+	return 0;
+}
+
+static int i2c_ti_hercules_transfer(const struct device *dev, struct i2c_msg *msgs,
+				    uint8_t num_msgs, uint16_t addr)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_i2c_regs *regs = DEV_REGS(dev);
+	uint8_t first = 0;
+	int ret = 0;
+
+	if (num_msgs == 0U) {
+		return 0;
+	}
+
+	k_sem_take(&data->lock, K_FOREVER);
+
+	if (!data->bus_held && !i2c_ti_hercules_bus_idle(regs)) {
+		ret = i2c_ti_hercules_wait_idle(dev);
+	}
+
+	while (ret == 0 && first < num_msgs) {
+		uint8_t count = 1;
+		uint32_t len = msgs[first].len;
+
+		/* Extend the segment over messages that continue it on the wire */
+		while (first + count < num_msgs &&
+		       (msgs[first + count - 1U].flags & I2C_MSG_STOP) == 0U &&
+		       (msgs[first + count].flags & I2C_MSG_RESTART) == 0U &&
+		       (msgs[first + count].flags & I2C_MSG_RW_MASK) ==
+			       (msgs[first].flags & I2C_MSG_RW_MASK)) {
+			len += msgs[first + count].len;
+			count++;
+		}
+		if (len == 0U || len > I2C_MAX_COUNT) {
+			/* The byte counter can not express an empty transfer */
+			ret = -ENOTSUP;
+			break;
+		}
+
+		ret = i2c_ti_hercules_segment(dev, &msgs[first], count, addr, len);
+		first += count;
+	}
+
+	if (ret != 0 && data->bus_held) {
+		regs->ICMDR |= I2C_MDR_STP;
+		data->bus_held = false;
+	}
+
+	k_sem_give(&data->lock);
+	return ret;
+}
+
+static int i2c_ti_hercules_configure(const struct device *dev, uint32_t dev_config)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	int ret;
+
+	if ((dev_config & I2C_MODE_CONTROLLER) == 0U) {
+		return -ENOTSUP;
+	}
+
+	k_sem_take(&data->lock, K_FOREVER);
+	ret = i2c_ti_hercules_timing(dev, dev_config);
+	if (ret == 0) {
+		data->dev_config = dev_config;
+		i2c_ti_hercules_setup(dev);
+	}
+	k_sem_give(&data->lock);
+	return ret;
+}
+
+static int i2c_ti_hercules_get_config(const struct device *dev, uint32_t *dev_config)
+{
+	*dev_config = DEV_DATA(dev)->dev_config;
+	return 0;
+}
+
+static int i2c_ti_hercules_recover_bus(const struct device *dev)
+{
+	struct i2c_ti_hercules_data *data = DEV_DATA(dev);
+	int ret;
+
+	k_sem_take(&data->lock, K_FOREVER);
+	ret = i2c_ti_hercules_recover(dev);
+	k_sem_give(&data->lock);
+	return ret;
+}
+
+static int i2c_ti_hercules_init(const struct device *dev)
+{
+	const struct i2c_ti_hercules_config *cfg = DEV_CFG(dev);
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+#ifdef CONFIG_DMA_TI_HERCULES
+	if ((cfg->dma_tx.dev != NULL && !device_is_ready(cfg->dma_tx.dev)) ||
+	    (cfg->dma_rx.dev != NULL && !device_is_ready(cfg->dma_rx.dev))) {
+		return -ENODEV;
+	}
+#endif
+
+	cfg->irq_config_func(dev);
+
+	ret = i2c_ti_hercules_configure(dev,
+					I2C_MODE_CONTROLLER | i2c_map_dt_bitrate(cfg->bitrate));
+	if (ret != 0) {
+		LOG_ERR("Unsupported bitrate %u", cfg->bitrate);
+	}
+	return ret;
+}
+
+static DEVICE_API(i2c, i2c_ti_hercules_api) = {
+	.configure = i2c_ti_hercules_configure,
+	.get_config = i2c_ti_hercules_get_config,
+	.transfer = i2c_ti_hercules_transfer,
+	.recover_bus = i2c_ti_hercules_recover_bus,
+};
+
+#ifdef CONFIG_DMA_TI_HERCULES
+#define I2C_TI_HERCULES_DMA(n, dir)                                                                \
+	.dma_##dir = COND_CODE_1(DT_INST_DMAS_HAS_NAME(n, dir),                                    \
+		({                                                                                 \
+			.dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(n, dir)),                   \
+			.channel = DT_INST_DMAS_CELL_BY_NAME(n, dir, channel),                     \
+			.slot = DT_INST_DMAS_CELL_BY_NAME(n, dir, slot),                           \
+		}),                                                                                \
+		({0})),
+#else
+#define I2C_TI_HERCULES_DMA(n, dir)
+#endif
+
+#define I2C_TI_HERCULES_INIT(n)                                                                    \
+	static void i2c_ti_hercules_irq_config_##n(const struct device *dev)                       \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority), i2c_ti_hercules_isr,    \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ(n, type));                          \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+	static const struct i2c_ti_hercules_config i2c_ti_hercules_config_##n = {                 \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.bitrate = DT_INST_PROP(n, clock_frequency),                                       \
+		.irq_config_func = i2c_ti_hercules_irq_config_##n,                                 \
+		I2C_TI_HERCULES_DMA(n, tx) I2C_TI_HERCULES_DMA(n, rx)};                            \
+	static struct i2c_ti_hercules_data i2c_ti_hercules_data_##n = {                            \
+		.lock = Z_SEM_INITIALIZER(i2c_ti_hercules_data_##n.lock, 1, 1),                    \
+		.done = Z_SEM_INITIALIZER(i2c_ti_hercules_data_##n.done, 0, 1),                    \
+	};                                                                                         \
+	I2C_DEVICE_DT_INST_DEFINE(n, i2c_ti_hercules_init, NULL, &i2c_ti_hercules_data_##n,        \
+				  &i2c_ti_hercules_config_##n, POST_KERNEL,                        \
+				  CONFIG_I2C_INIT_PRIORITY, &i2c_ti_hercules_api);
+
+DT_INST_FOREACH_STATUS_OKAY(I2C_TI_HERCULES_INIT)
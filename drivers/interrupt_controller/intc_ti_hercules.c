@@ -7,9 +7,13 @@
 
 #include <soc.h>
 
-#include <zephyr/arch/arm/irq.h>
 #include <zephyr/arch/cpu.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/drivers/interrupt_controller/intc_ti_hercules_vim.h>
+#include <zephyr/drivers/misc/ti_hercules_esm/ti_hercules_esm.h>
+#include <zephyr/drivers/ti_hercules_boot_trace.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/drivers/ti_hercules_sys_regs.h>
 #include <zephyr/fatal.h>
 #include <zephyr/kernel.h>
 #include <zephyr/linker/linker-defs.h>
@@ -53,139 +57,139 @@ struct hercules_vim_regs {
 	uint32_t FIQVECREG;      /* 0x0174        */
 	uint32_t CAPEVT;         /* 0x0178        */
 	uint32_t rsvd4;          /* 0x017C        */
-	uint32_t CHANCTRL[32U];  /* 0x0180-0x02FC */
+	uint32_t CHANCTRL[32U];  /* 0x0180-0x01FC */
 };
 
 void vim_ecc_error_handle(void)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
-	volatile struct hercules_esm_regs *esm_reg = (void *)DT_REG_ADDR(ESM_NODE);
-	uint32_t vec = 0;
-	uint32_t err_addr = reg->UERRADDR;
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
+	uint32_t vec;
+	uint32_t err_addr = HERCULES_REG_READ(reg, UERRADDR);
 	uint32_t err_channel = ((err_addr & 0x3ff) >> 2);
-	int idx = vec / 32;
-	int rem = vec % 32;
-	LOG_WRN("ECC error addr: %p, chan: %u, resetting", (void *)err_addr, err_channel);
+	LOG_WRN("ECC error addr: %p, chan: %u, resetting", (void *)(uintptr_t)err_addr,
+		err_channel);
 	/* Reset the offending interrupt address. */
 	// *(VIM_RAM_ADDR + err_channel) = (void *)_vector_start[err_channel];
 	/* Clear the ECC Error */
-	reg->ECCSTAT = 1U;
+	HERCULES_REG_WRITE(reg, ECCSTAT, 1U);
 	/* Disable and enable the highest priority pending channel */
-	if (reg->FIQINDEX != 0U) {
-		vec = reg->FIQINDEX - 1U;
+	vec = HERCULES_REG_READ(reg, FIQINDEX);
+	if (vec != 0U) {
+		vec -= 1U;
 	} else {
-		vec = reg->IRQINDEX - 1U;
+		vec = HERCULES_REG_READ(reg, IRQINDEX) - 1U;
 	}
 	if (vec == 0U) {
-		reg->INTREQ[0] = 1U;
-		vec = esm_reg->IOFFHR - 1U;
-		/* This doesn't do anything yet as the ESM isn't enabled yet. */
-		if (vec < 32U) {
-			esm_reg->SR1[0U] = (uint32_t)1U << rem;
-			/* Notify ESM Group 1 */
-		} else if (vec < 64U) {
-			esm_reg->SR1[1U] = (uint32_t)1U << rem;
-			/* Notify ESM Group 2 */
-		} else if (vec < 96U) {
-			esm_reg->SR4[0U] = (uint32_t)1U << rem;
-			/* Notify ESM Group 1 */
-		} else if ((vec >= 128U) && (vec < 160U)) {
-			esm_reg->SR7[0U] = (uint32_t)1U << rem;
-			/* Notify ESM Group 2 */
-		} else {
-			esm_reg->SR7[0U] = 0xFFFFFFFFU;
-			esm_reg->SR4[1U] = 0xFFFFFFFFU;
-			esm_reg->SR4[0U] = 0xFFFFFFFFU;
-			esm_reg->SR1[1U] = 0xFFFFFFFFU;
-			esm_reg->SR1[0U] = 0xFFFFFFFFU;
-		}
+		/* Channel 0 is the ESM high level interrupt */
+		HERCULES_REG_WRITE(reg, INTREQ[0], 1U);
+#ifdef CONFIG_TI_HERCULES_ESM
+		ti_hercules_esm_dispatch_high(DEVICE_DT_GET(ESM_NODE));
+#endif
 	} else {
-		reg->REQMASKCLR[idx] = (uint32_t)1U << rem;
-		reg->REQMASKSET[idx] = (uint32_t)1U << rem;
+		HERCULES_REG_WRITE(reg, REQMASKCLR[vec / 32U], (uint32_t)1U << (vec % 32U));
+		HERCULES_REG_WRITE(reg, REQMASKSET[vec / 32U], (uint32_t)1U << (vec % 32U));
 	}
 }
 
 void z_soc_irq_init(void)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
-	size_t irq_count = (size_t)_vector_end - (size_t)_vector_start;
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
+	uint32_t start = ti_hercules_boot_trace_now();
 	/* Enable ECC for VIM RAM */
 	/* Errata VIM#28 Workaround: Disable Single Bit error correction */
-	reg->ECCCTL = VIM_ECC_ENABLE | EDAC_MODE_DISABLE;
-	/* Copy IRQ handlers into VIM RAM */
-	(void)memcpy(VIM_RAM_ADDR, _vector_start, irq_count);
+	HERCULES_REG_WRITE(reg, ECCCTL, VIM_ECC_ENABLE | EDAC_MODE_DISABLE);
+#ifndef CONFIG_TI_HERCULES_MMIO_MODEL
+	/* Copy IRQ handlers into VIM RAM, the register model has no vector RAM */
+	(void)memcpy(VIM_RAM_ADDR, _vector_start, (size_t)_vector_end - (size_t)_vector_start);
+#endif
 
 	/* ECC related ERROR handler */
-	reg->FBVECADDR = (uint32_t)&vim_ecc_error_handle;
-	reg->FIRQPR[0] = 0x3; /* Channel 0 & 1 are FIQ only */
+	HERCULES_REG_WRITE(reg, FBVECADDR, (uint32_t)(uintptr_t)&vim_ecc_error_handle);
+	HERCULES_REG_WRITE(reg, FIRQPR[0], 0x3); /* Channel 0 & 1 are FIQ only */
 	/* Set all remaining channels to SYS_IRQ for now. */
-	reg->FIRQPR[1] = 0;
-	reg->FIRQPR[2] = 0;
-	reg->FIRQPR[3] = 0;
-	reg->REQMASKSET[0] = 0x3; /* Enable Channel 0 & 1 IRQs. */
+	HERCULES_REG_WRITE(reg, FIRQPR[1], 0);
+	HERCULES_REG_WRITE(reg, FIRQPR[2], 0);
+	HERCULES_REG_WRITE(reg, FIRQPR[3], 0);
+	HERCULES_REG_WRITE(reg, REQMASKSET[0], 0x3); /* Enable Channel 0 & 1 IRQs. */
 	/* Disable all other IRQs for now. */
-	reg->REQMASKSET[1] = 0;
-	reg->REQMASKSET[2] = 0;
-	reg->REQMASKSET[3] = 0;
+	HERCULES_REG_WRITE(reg, REQMASKSET[1], 0);
+	HERCULES_REG_WRITE(reg, REQMASKSET[2], 0);
+	HERCULES_REG_WRITE(reg, REQMASKSET[3], 0);
 
 	/* Set Capture Event Sources. */
-	reg->CAPEVT = ((uint32_t)((uint32_t)0U << 0U) | (uint32_t)((uint32_t)0U << 16U));
+	HERCULES_REG_WRITE(reg, CAPEVT,
+			   ((uint32_t)((uint32_t)0U << 0U) | (uint32_t)((uint32_t)0U << 16U)));
+
+	ti_hercules_boot_trace_stage(TI_HERCULES_BOOT_STAGE_VIM_INIT, start);
 }
 
 void z_soc_irq_enable(unsigned int irq)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
 	int idx = irq / 32;
 	int rem = irq % 32;
-	reg->REQMASKSET[idx] |= 1 << rem;
+	HERCULES_REG_WRITE(reg, REQMASKSET[idx], 1U << rem);
 }
 
 void z_soc_irq_disable(unsigned int irq)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
 	int idx = irq / 32;
 	int rem = irq % 32;
-	reg->REQMASKCLR[idx] |= 1 << rem;
+	HERCULES_REG_WRITE(reg, REQMASKCLR[idx], 1U << rem);
 }
 
 int z_soc_irq_is_enabled(unsigned int irq)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
 	int idx = irq / 32;
 	int rem = irq % 32;
-	return ((reg->REQMASKSET[idx] >> rem) & 0x1);
+	return ((HERCULES_REG_READ(reg, REQMASKSET[idx]) >> rem) & 0x1);
 }
 
 void z_soc_irq_priority_set(unsigned int irq, unsigned int prio, unsigned int flags)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
 	uint32_t idx = irq / 32;
 	uint32_t rem = irq % 32;
 	uint32_t offset_idx = prio / 4; /* Get channel priority map offset for irq channel */
 	uint32_t offset_rem = prio % 4;
 	offset_rem = 3 - offset_rem; /* Swap bytes */
 	offset_rem *= 8;             /* Start bit to set */
-	reg->CHANCTRL[offset_idx] &=
-		~(uint32_t)((uint32_t)0xFFU << offset_rem); /* Clear previous mapping. */
-	reg->CHANCTRL[offset_idx] |= (uint32_t)((uint32_t)0x7FU & irq) << offset_rem;
+	/* Replace the previous mapping. */
+	HERCULES_REG_UPDATE(reg, CHANCTRL[offset_idx], (uint32_t)((uint32_t)0xFFU << offset_rem),
+			    (uint32_t)((uint32_t)0x7FU & irq) << offset_rem);
 	/* flags is set to either SYS_IRQ or SYS_FIQ */
-	WRITE_BIT(reg->FIRQPR[idx], rem, flags);
+	HERCULES_REG_UPDATE(reg, FIRQPR[idx], BIT(rem), (flags != 0U) ? BIT(rem) : 0U);
+}
+
+void ti_hercules_vim_wakeup_set(unsigned int irq, bool enable)
+{
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
+
+	if (enable) {
+		HERCULES_REG_WRITE(reg, WAKEMASKSET[irq / 32U], BIT(irq % 32U));
+	} else {
+		HERCULES_REG_WRITE(reg, WAKEMASKCLR[irq / 32U], BIT(irq % 32U));
+	}
 }
 
 unsigned int z_soc_irq_get_active(void)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
-	if (reg->FIQINDEX != 0U) {
-		return reg->FIQINDEX - 1U;
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
+	uint32_t fiq = HERCULES_REG_READ(reg, FIQINDEX);
+
+	if (fiq != 0U) {
+		return fiq - 1U;
 	} else {
-		return reg->IRQINDEX - 1U;
+		return HERCULES_REG_READ(reg, IRQINDEX) - 1U;
 	}
 }
 
 void z_soc_irq_eoi(unsigned int irq)
 {
-	volatile struct hercules_vim_regs *reg = (void *)DT_REG_ADDR(VIM_NODE);
+	volatile struct hercules_vim_regs *reg = HERCULES_MMIO(DT_REG_ADDR(VIM_NODE));
 	int idx = irq / 32;
 	int rem = irq % 32;
-	reg->INTREQ[idx] |= 1 << rem; /* Clear pending IRQ */
+	HERCULES_REG_WRITE(reg, INTREQ[idx], 1U << rem); /* Clear pending IRQ */
 }
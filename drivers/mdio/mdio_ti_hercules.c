@@ -0,0 +1,157 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_mdio
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/mdio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(mdio_ti_hercules, CONFIG_MDIO_LOG_LEVEL);
+
+#define MDIO_CONTROL_ENABLE   BIT(30)
+#define MDIO_CONTROL_FAULTENB BIT(18)
+#define MDIO_CONTROL_CLKDIV   GENMASK(15, 0)
+
+#define MDIO_USERACCESS_GO        BIT(31)
+#define MDIO_USERACCESS_WRITE     BIT(30)
+#define MDIO_USERACCESS_ACK       BIT(29)
+#define MDIO_USERACCESS_REGADR(x) (((uint32_t)(x) & 0x1FU) << 21)
+#define MDIO_USERACCESS_PHYADR(x) (((uint32_t)(x) & 0x1FU) << 16)
+#define MDIO_USERACCESS_DATA      GENMASK(15, 0)
+
+/* A frame is 64 MDCLK cycles, this leaves room for very slow bus clocks */
+#define MDIO_TIMEOUT_US 5000U
+
+#define DEV_CFG(dev)  ((const struct mdio_ti_hercules_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct mdio_ti_hercules_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_mdio_regs *)DEV_CFG(dev)->base)
+
+struct hercules_mdio_regs {
+	uint32_t REVID;            /* 0x00 */
+	uint32_t CONTROL;          /* 0x04 */
+	uint32_t ALIVE;            /* 0x08 */
+	uint32_t LINK;             /* 0x0C */
+	uint32_t LINKINTRAW;       /* 0x10 */
+	uint32_t LINKINTMASKED;    /* 0x14 */
+	uint32_t RESERVED1[2];     /* 0x18 */
+	uint32_t USERINTRAW;       /* 0x20 */
+	uint32_t USERINTMASKED;    /* 0x24 */
+	uint32_t USERINTMASKSET;   /* 0x28 */
+	uint32_t USERINTMASKCLEAR; /* 0x2C */
+	uint32_t RESERVED2[20];    /* 0x30 */
+	uint32_t USERACCESS0;      /* 0x80 */
+	uint32_t USERPHYSEL0;      /* 0x84 */
+	uint32_t USERACCESS1;      /* 0x88 */
+	uint32_t USERPHYSEL1;      /* 0x8C */
+};
+
+struct mdio_ti_hercules_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	uint32_t bus_freq;
+};
+
+struct mdio_ti_hercules_data {
+	struct k_mutex lock;
+};
+
+static int mdio_ti_hercules_transfer(const struct device *dev, uint32_t cmd, uint16_t *value)
+{
+	volatile struct hercules_mdio_regs *regs = DEV_REGS(dev);
+	struct mdio_ti_hercules_data *data = DEV_DATA(dev);
+	uint32_t val;
+	int ret = 0;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	if (!WAIT_FOR((regs->USERACCESS0 & MDIO_USERACCESS_GO) == 0U, MDIO_TIMEOUT_US,
+		      k_busy_wait(1))) {
+		ret = -ETIMEDOUT;
+	} else {
+		regs->USERACCESS0 = cmd | MDIO_USERACCESS_GO;
+		if (!WAIT_FOR(((val = regs->USERACCESS0) & MDIO_USERACCESS_GO) == 0U,
+			      MDIO_TIMEOUT_US, k_busy_wait(1))) {
+			ret = -ETIMEDOUT;
+		} else if (value != NULL) {
+			/* ACK is only meaningful for reads */
+			if ((val & MDIO_USERACCESS_ACK) == 0U) {
+				ret = -EIO;
+			} else {
+				*value = val & MDIO_USERACCESS_DATA;
+			}
+		}
+	}
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static int mdio_ti_hercules_read(const struct device *dev, uint8_t prtad, uint8_t regad,
+				 uint16_t *data)
+{
+	return mdio_ti_hercules_transfer(
+		dev, MDIO_USERACCESS_REGADR(regad) | MDIO_USERACCESS_PHYADR(prtad), data);
+}
+
+static int mdio_ti_hercules_write(const struct device *dev, uint8_t prtad, uint8_t regad,
+				  uint16_t data)
+{
+	return mdio_ti_hercules_transfer(dev,
+					 MDIO_USERACCESS_WRITE | MDIO_USERACCESS_REGADR(regad) |
+						 MDIO_USERACCESS_PHYADR(prtad) | data,
+					 NULL);
+}
+
+static int mdio_ti_hercules_init(const struct device *dev)
+{
+	const struct mdio_ti_hercules_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_mdio_regs *regs = DEV_REGS(dev);
+	uint32_t rate, div;
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &rate);
+	if (ret != 0) {
+		return ret;
+	}
+
+	k_mutex_init(&DEV_DATA(dev)->lock);
+
+	/* MDCLK = VBUSP / (CLKDIV + 1), rounded so the bus never runs too fast */
+	div = DIV_ROUND_UP(rate, cfg->bus_freq);
+	div = CLAMP(div, 1U, MDIO_CONTROL_CLKDIV + 1U) - 1U;
+	regs->CONTROL = MDIO_CONTROL_ENABLE | MDIO_CONTROL_FAULTENB | div;
+
+	return 0;
+}
+
+static DEVICE_API(mdio, mdio_ti_hercules_api) = {
+	.read = mdio_ti_hercules_read,
+	.write = mdio_ti_hercules_write,
+};
+
+#define MDIO_TI_HERCULES_INIT(n)                                                                   \
+	static const struct mdio_ti_hercules_config mdio_ti_hercules_config_##n = {                \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.bus_freq = DT_INST_PROP(n, clock_frequency),                                      \
+	};                                                                                         \
+	static struct mdio_ti_hercules_data mdio_ti_hercules_data_##n;                             \
+	DEVICE_DT_INST_DEFINE(n, mdio_ti_hercules_init, NULL, &mdio_ti_hercules_data_##n,          \
+			      &mdio_ti_hercules_config_##n, POST_KERNEL,                           \
+			      CONFIG_MDIO_INIT_PRIORITY, &mdio_ti_hercules_api);
+
+DT_INST_FOREACH_STATUS_OKAY(MDIO_TI_HERCULES_INIT)
@@ -0,0 +1,488 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_crc
+
+#include <soc.h>
+
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/misc/ti_hercules_crc/ti_hercules_crc.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+
+/*
+ * Channel 1 runs in semi-CPU mode: the DMA writes the patterns into its PSA
+ * signature register and the compression complete interrupt fires once the
+ * pattern counter runs out, the signature is then latched in the sector
+ * signature register. Channel 2 runs in full-CPU mode for the synchronous
+ * path, the CPU writes the patterns and reads the PSA signature back.
+ */
+#define CRC_CH_DMA 0U
+#define CRC_CH_CPU 1U
+
+#define CRC_CTRL0_PSA_SWREST(ch) BIT((ch) * 8U)
+#define CRC_CTRL1_PWDN           BIT(0)
+#define CRC_CTRL2_MODE_MASK(ch)  (0x3U << ((ch) * 8U))
+#define CRC_CTRL2_MODE(ch, mode) ((uint32_t)(mode) << ((ch) * 8U))
+#define CRC_INT_CCIT(ch)         BIT((ch) * 8U)
+#define CRC_INT_ALL(ch)          (0x1FU << ((ch) * 8U))
+
+enum crc_mode {
+	CRC_MODE_DATA_CAPTURE = 0,
+	CRC_MODE_AUTO = 1,
+	CRC_MODE_SEMI_CPU = 2,
+	CRC_MODE_FULL_CPU = 3,
+};
+
+/* One DMA block per 32 KiB, below the 8191 element limit of a block transfer */
+#define CRC_DMA_CHUNK (4096U * sizeof(uint64_t))
+
+/* Retry delay of a scrub region while another background computation runs */
+#define CRC_SCRUB_RETRY K_MSEC(1)
+
+struct hercules_crc_regs {
+	uint32_t CTRL0;      /* 0x0000 */
+	uint32_t rsvd1;      /* 0x0004 */
+	uint32_t CTRL1;      /* 0x0008 */
+	uint32_t rsvd2;      /* 0x000C */
+	uint32_t CTRL2;      /* 0x0010 */
+	uint32_t rsvd3;      /* 0x0014 */
+	uint32_t INTS;       /* 0x0018 */
+	uint32_t rsvd4;      /* 0x001C */
+	uint32_t INTR;       /* 0x0020 */
+	uint32_t rsvd5;      /* 0x0024 */
+	uint32_t STATUS;     /* 0x0028 */
+	uint32_t rsvd6;      /* 0x002C */
+	uint32_t INT_OFFSET; /* 0x0030 */
+	uint32_t rsvd7;      /* 0x0034 */
+	uint32_t BUSY;       /* 0x0038 */
+	uint32_t rsvd8;      /* 0x003C */
+	struct {
+		uint32_t PCOUNT;         /* 0x0040 */
+		uint32_t SCOUNT;         /* 0x0044 */
+		uint32_t CURSEC;         /* 0x0048 */
+		uint32_t WDTOPLD;        /* 0x004C */
+		uint32_t BCTOPLD;        /* 0x0050 */
+		uint32_t rsvd[3];        /* 0x0054 */
+		uint32_t PSA_SIGREGL;    /* 0x0060 */
+		uint32_t PSA_SIGREGH;    /* 0x0064 */
+		uint32_t REGL;           /* 0x0068 */
+		uint32_t REGH;           /* 0x006C */
+		uint32_t PSA_SECSIGREGL; /* 0x0070 */
+		uint32_t PSA_SECSIGREGH; /* 0x0074 */
+		uint32_t RAW_DATAREGL;   /* 0x0078 */
+		uint32_t RAW_DATAREGH;   /* 0x007C */
+	} CH[2];
+};
+
+struct ti_hercules_crc_config {
+	uintptr_t base;
+	const struct device *dma_dev;
+	uint32_t dma_channel;
+	uint32_t dma_slot;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct ti_hercules_crc_data {
+	/* Full-CPU channel owner */
+	struct k_mutex lock;
+	/* Semi-CPU channel state */
+	atomic_t busy;
+	uintptr_t next;
+	size_t remaining;
+	bool check;
+	uint64_t expected;
+	ti_hercules_crc_callback_t cb;
+	void *user_data;
+	/* Synchronous DMA computations */
+	struct k_sem done;
+	int status;
+	uint64_t result;
+#ifdef CONFIG_TI_HERCULES_CRC_SCRUB
+	/* Periodic scrubbing */
+	const struct device *dev;
+	struct k_work_delayable scrub_work;
+	atomic_t scrub_active;
+	const struct ti_hercules_crc_region *scrub_regions;
+	size_t scrub_count;
+	size_t scrub_index;
+	ti_hercules_crc_scrub_callback_t scrub_cb;
+	void *scrub_user_data;
+#endif
+};
+
+#define DEV_CFG(dev)  ((const struct ti_hercules_crc_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct ti_hercules_crc_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_crc_regs *)DEV_CFG(dev)->base)
+
+static bool crc_buffer_valid(const void *buf, size_t len)
+{
+	return len > 0U && len <= TI_HERCULES_CRC_MAX_LEN && (len % sizeof(uint64_t)) == 0U &&
+	       ((uintptr_t)buf % sizeof(uint64_t)) == 0U;
+}
+
+/* Clears the PSA signature of a channel and switches it to @p mode. */
+static void crc_channel_start(volatile struct hercules_crc_regs *regs, uint32_t ch,
+			      enum crc_mode mode)
+{
+	regs->CTRL2 &= ~CRC_CTRL2_MODE_MASK(ch);
+	regs->CTRL0 |= CRC_CTRL0_PSA_SWREST(ch);
+	regs->CTRL0 &= ~CRC_CTRL0_PSA_SWREST(ch);
+	regs->CTRL2 |= CRC_CTRL2_MODE(ch, mode);
+}
+
+static void crc_channel_stop(volatile struct hercules_crc_regs *regs, uint32_t ch)
+{
+	regs->INTR = CRC_INT_ALL(ch);
+	regs->CTRL2 &= ~CRC_CTRL2_MODE_MASK(ch);
+	regs->STATUS = CRC_INT_ALL(ch);
+}
+
+static uint64_t crc_compute_cpu(const struct device *dev, const uint64_t *buf, size_t len)
+{
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+	volatile struct hercules_crc_regs *regs = DEV_REGS(dev);
+	/* One 64 bit store per pattern, the compression is triggered by the bus write */
+	volatile uint64_t *psa = (volatile uint64_t *)&regs->CH[CRC_CH_CPU].PSA_SIGREGL;
+	uint64_t crc;
+
+	if (!k_is_pre_kernel()) {
+		k_mutex_lock(&data->lock, K_FOREVER);
+	}
+
+	crc_channel_start(regs, CRC_CH_CPU, CRC_MODE_FULL_CPU);
+	for (size_t i = 0; i < len / sizeof(uint64_t); i++) {
+		*psa = buf[i];
+	}
+	crc = ((uint64_t)regs->CH[CRC_CH_CPU].PSA_SIGREGH << 32) |
+	      regs->CH[CRC_CH_CPU].PSA_SIGREGL;
+	crc_channel_stop(regs, CRC_CH_CPU);
+
+	if (!k_is_pre_kernel()) {
+		k_mutex_unlock(&data->lock);
+	}
+	return crc;
+}
+
+static void crc_complete(const struct device *dev, int status, uint64_t crc)
+{
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+	ti_hercules_crc_callback_t cb = data->cb;
+	void *user_data = data->user_data;
+
+	crc_channel_stop(DEV_REGS(dev), CRC_CH_DMA);
+	if (status == 0 && data->check && crc != data->expected) {
+		status = -EILSEQ;
+	}
+	/* The callback may start the next computation */
+	atomic_clear(&data->busy);
+	cb(dev, status, crc, user_data);
+}
+
+static void crc_dma_done(const struct device *dma_dev, void *user_data, uint32_t channel,
+			 int status);
+
+static int crc_dma_next(const struct device *dev)
+{
+	const struct ti_hercules_crc_config *cfg = DEV_CFG(dev);
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+	size_t size = MIN(data->remaining, CRC_DMA_CHUNK);
+	struct dma_block_config block = {
+		.source_address = data->next,
+		.dest_address = (uint32_t)&DEV_REGS(dev)->CH[CRC_CH_DMA].PSA_SIGREGL,
+		.block_size = size,
+		.source_addr_adj = DMA_ADDR_ADJ_INCREMENT,
+		.dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE,
+	};
+	struct dma_config dma_cfg = {
+		.dma_slot = cfg->dma_slot,
+		.channel_direction = MEMORY_TO_MEMORY,
+		.source_data_size = sizeof(uint64_t),
+		.dest_data_size = sizeof(uint64_t),
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &block,
+		.dma_callback = crc_dma_done,
+		.user_data = (void *)dev,
+	};
+	int ret;
+
+	data->next += size;
+	data->remaining -= size;
+
+	ret = dma_config(cfg->dma_dev, cfg->dma_channel, &dma_cfg);
+	if (ret == 0) {
+		ret = dma_start(cfg->dma_dev, cfg->dma_channel);
+	}
+	return ret;
+}
+
+static void crc_dma_done(const struct device *dma_dev, void *user_data, uint32_t channel,
+			 int status)
+{
+	const struct device *dev = user_data;
+
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(channel);
+
+	if (status < 0 || (DEV_DATA(dev)->remaining > 0U && crc_dma_next(dev) != 0)) {
+		crc_complete(dev, -EIO, 0);
+	}
+	/* The last block completes through the compression complete interrupt */
+}
+
+static int crc_start_dma(const struct device *dev, const void *buf, size_t len, bool check,
+			 uint64_t expected, ti_hercules_crc_callback_t cb, void *user_data)
+{
+	const struct ti_hercules_crc_config *cfg = DEV_CFG(dev);
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+	volatile struct hercules_crc_regs *regs = DEV_REGS(dev);
+	int ret;
+
+	if (!crc_buffer_valid(buf, len)) {
+		return -EINVAL;
+	}
+	if (cfg->dma_dev == NULL) {
+		return -ENOTSUP;
+	}
+	if (!atomic_cas(&data->busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	data->next = (uintptr_t)buf;
+	data->remaining = len;
+	data->check = check;
+	data->expected = expected;
+	data->cb = cb;
+	data->user_data = user_data;
+
+	/* The DMA reads memory behind the data cache */
+	sys_cache_data_flush_range((void *)buf, len);
+
+	crc_channel_start(regs, CRC_CH_DMA, CRC_MODE_DATA_CAPTURE);
+	regs->CH[CRC_CH_DMA].PCOUNT = len / sizeof(uint64_t);
+	regs->CH[CRC_CH_DMA].SCOUNT = 1U;
+	/* No timeout supervision, the DMA is the only data source */
+	regs->CH[CRC_CH_DMA].WDTOPLD = 0U;
+	regs->CH[CRC_CH_DMA].BCTOPLD = 0U;
+	regs->STATUS = CRC_INT_ALL(CRC_CH_DMA);
+	regs->INTS = CRC_INT_CCIT(CRC_CH_DMA);
+	regs->CTRL2 |= CRC_CTRL2_MODE(CRC_CH_DMA, CRC_MODE_SEMI_CPU);
+
+	ret = crc_dma_next(dev);
+	if (ret != 0) {
+		crc_channel_stop(regs, CRC_CH_DMA);
+		atomic_clear(&data->busy);
+	}
+	return ret;
+}
+
+static void crc_sync_done(const struct device *dev, int status, uint64_t crc, void *user_data)
+{
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+
+	ARG_UNUSED(user_data);
+
+	data->status = status;
+	data->result = crc;
+	k_sem_give(&data->done);
+}
+
+int ti_hercules_crc_compute(const struct device *dev, const void *buf, size_t len,
+			    uint64_t *crc)
+{
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+
+	if (k_is_in_isr()) {
+		return -EWOULDBLOCK;
+	}
+	if (!crc_buffer_valid(buf, len)) {
+		return -EINVAL;
+	}
+
+	if (!k_is_pre_kernel() &&
+	    crc_start_dma(dev, buf, len, false, 0, crc_sync_done, NULL) == 0) {
+		k_sem_take(&data->done, K_FOREVER);
+		*crc = data->result;
+		return data->status;
+	}
+
+	/* No DMA, not allowed to sleep or a background computation is running */
+	*crc = crc_compute_cpu(dev, buf, len);
+	return 0;
+}
+
+int ti_hercules_crc_compute_async(const struct device *dev, const void *buf, size_t len,
+				  ti_hercules_crc_callback_t cb, void *user_data)
+{
+	return crc_start_dma(dev, buf, len, false, 0, cb, user_data);
+}
+
+int ti_hercules_crc_check_async(const struct device *dev, const void *buf, size_t len,
+				uint64_t expected, ti_hercules_crc_callback_t cb, void *user_data)
+{
+	return crc_start_dma(dev, buf, len, true, expected, cb, user_data);
+}
+
+#ifdef CONFIG_TI_HERCULES_CRC_SCRUB
+static void crc_scrub_done(const struct device *dev, int status, uint64_t crc, void *user_data)
+{
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+	k_timeout_t next = K_NO_WAIT;
+
+	/* Drop a check that completed after scrubbing was stopped or restarted */
+	if (!atomic_get(&data->scrub_active) ||
+	    user_data != &data->scrub_regions[data->scrub_index]) {
+		return;
+	}
+	data->scrub_cb(dev, user_data, status, crc, data->scrub_user_data);
+
+	if (++data->scrub_index == data->scrub_count) {
+		data->scrub_index = 0;
+		next = K_MSEC(CONFIG_TI_HERCULES_CRC_SCRUB_INTERVAL_MS);
+	}
+	k_work_reschedule(&data->scrub_work, next);
+}
+
+static void crc_scrub_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct ti_hercules_crc_data *data =
+		CONTAINER_OF(dwork, struct ti_hercules_crc_data, scrub_work);
+	const struct ti_hercules_crc_region *region;
+	int ret;
+
+	if (!atomic_get(&data->scrub_active)) {
+		return;
+	}
+	region = &data->scrub_regions[data->scrub_index];
+	ret = crc_start_dma(data->dev, region->buf, region->len, true, region->expected,
+			    crc_scrub_done, (void *)region);
+	if (ret == -EBUSY) {
+		k_work_reschedule(&data->scrub_work, CRC_SCRUB_RETRY);
+	} else if (ret != 0) {
+		crc_scrub_done(data->dev, ret, 0, (void *)region);
+	}
+}
+
+int ti_hercules_crc_scrub_start(const struct device *dev,
+				const struct ti_hercules_crc_region *regions, size_t count,
+				ti_hercules_crc_scrub_callback_t cb, void *user_data)
+{
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+
+	if (count == 0U) {
+		return -EINVAL;
+	}
+	for (size_t i = 0; i < count; i++) {
+		if (!crc_buffer_valid(regions[i].buf, regions[i].len)) {
+			return -EINVAL;
+		}
+	}
+	if (DEV_CFG(dev)->dma_dev == NULL) {
+		return -ENOTSUP;
+	}
+	if (!atomic_cas(&data->scrub_active, 0, 1)) {
+		return -EALREADY;
+	}
+
+	data->scrub_regions = regions;
+	data->scrub_count = count;
+	data->scrub_index = 0;
+	data->scrub_cb = cb;
+	data->scrub_user_data = user_data;
+	k_work_reschedule(&data->scrub_work, K_NO_WAIT);
+	return 0;
+}
+
+int ti_hercules_crc_scrub_stop(const struct device *dev)
+{
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+
+	if (!atomic_cas(&data->scrub_active, 1, 0)) {
+		return -EALREADY;
+	}
+	k_work_cancel_delayable(&data->scrub_work);
+	return 0;
+}
+#endif /* CONFIG_TI_HERCULES_CRC_SCRUB */
+
+static void ti_hercules_crc_isr(const struct device *dev)
+{
+	volatile struct hercules_crc_regs *regs = DEV_REGS(dev);
+	uint64_t crc;
+
+	if ((regs->STATUS & CRC_INT_CCIT(CRC_CH_DMA)) == 0U) {
+		return;
+	}
+	regs->STATUS = CRC_INT_CCIT(CRC_CH_DMA);
+	crc = ((uint64_t)regs->CH[CRC_CH_DMA].PSA_SECSIGREGH << 32) |
+	      regs->CH[CRC_CH_DMA].PSA_SECSIGREGL;
+	crc_complete(dev, 0, crc);
+}
+
+static int ti_hercules_crc_init(const struct device *dev)
+{
+	const struct ti_hercules_crc_config *cfg = DEV_CFG(dev);
+	struct ti_hercules_crc_data *data = DEV_DATA(dev);
+	volatile struct hercules_crc_regs *regs = DEV_REGS(dev);
+
+	if (cfg->dma_dev != NULL && !device_is_ready(cfg->dma_dev)) {
+		return -ENODEV;
+	}
+
+	k_mutex_init(&data->lock);
+	k_sem_init(&data->done, 0, 1);
+#ifdef CONFIG_TI_HERCULES_CRC_SCRUB
+	data->dev = dev;
+	k_work_init_delayable(&data->scrub_work, crc_scrub_work);
+#endif
+
+	regs->CTRL1 &= ~CRC_CTRL1_PWDN;
+	crc_channel_stop(regs, CRC_CH_DMA);
+	crc_channel_stop(regs, CRC_CH_CPU);
+
+	cfg->irq_config_func(dev);
+	return 0;
+}
+
+#ifdef CONFIG_DMA_TI_HERCULES
+#define TI_HERCULES_CRC_DMA(n)                                                                     \
+	COND_CODE_1(DT_INST_DMAS_HAS_NAME(n, data),                                                \
+		    (.dma_dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(n, data)),                \
+		     .dma_channel = DT_INST_DMAS_CELL_BY_NAME(n, data, channel),                  \
+		     .dma_slot = DT_INST_DMAS_CELL_BY_NAME(n, data, slot),), ())
+#else
+#define TI_HERCULES_CRC_DMA(n)
+#endif
+
+#define TI_HERCULES_CRC_INIT(n)                                                                    \
+	static void ti_hercules_crc_irq_config_##n(const struct device *dev)                       \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority), ti_hercules_crc_isr,    \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ(n, type));                          \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+                                                                                                   \
+	static const struct ti_hercules_crc_config ti_hercules_crc_config_##n = {                  \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.irq_config_func = ti_hercules_crc_irq_config_##n,                                 \
+		TI_HERCULES_CRC_DMA(n)};                                                           \
+                                                                                                   \
+	static struct ti_hercules_crc_data ti_hercules_crc_data_##n;                               \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(n, ti_hercules_crc_init, NULL, &ti_hercules_crc_data_##n,            \
+			      &ti_hercules_crc_config_##n, PRE_KERNEL_1,                           \
+			      CONFIG_TI_HERCULES_CRC_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(TI_HERCULES_CRC_INIT)
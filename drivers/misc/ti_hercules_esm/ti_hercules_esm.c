@@ -0,0 +1,304 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_esm
+
+#include <soc.h>
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/misc/ti_hercules_esm/ti_hercules_esm.h>
+#include <zephyr/drivers/ti_hercules_sys_regs.h>
+#include <zephyr/irq.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#include <errno.h>
+#include <stddef.h>
+
+#ifdef CONFIG_RUNTIME_NMI
+#include <zephyr/arch/arm/nmi.h>
+#endif
+
+#define DEV_CFG(dev)  ((const struct ti_hercules_esm_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct ti_hercules_esm_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_esm_regs *)HERCULES_MMIO(DEV_CFG(dev)->base))
+
+/*
+ * Error sources are numbered like the interrupt offset registers minus one:
+ * blocks of 32 channels alternate between group 1 and group 2, i.e. group 1
+ * channels 0-31, group 2 channels 0-31, group 1 channels 32-63, and so on up
+ * to group 1 channels 64-95. This turns an IOFFHR/IOFFLR read directly into
+ * a table index.
+ */
+#define ESM_SOURCES  (TI_HERCULES_ESM_GROUP1_CHANNELS + TI_HERCULES_ESM_GROUP2_CHANNELS)
+#define ESM_WORDS    3U /* group 1 registers sets 1, 4 and 7 */
+#define ESM_KEY_NORM 0x5U
+
+#define EPSR_NO_ERROR BIT(0)
+
+/* Status register of each block of 32 error sources */
+static const uint8_t esm_status_offset[] = {
+	offsetof(struct hercules_esm_regs, SR1[0]), offsetof(struct hercules_esm_regs, SR1[1]),
+	offsetof(struct hercules_esm_regs, SR4[0]), offsetof(struct hercules_esm_regs, SR4[1]),
+	offsetof(struct hercules_esm_regs, SR7[0]),
+};
+
+BUILD_ASSERT(ARRAY_SIZE(esm_status_offset) * 32U == ESM_SOURCES);
+
+struct ti_hercules_esm_handler {
+	ti_hercules_esm_callback_t cb;
+	void *user_data;
+};
+
+struct ti_hercules_esm_config {
+	uintptr_t base;
+	/* Group 1 channel masks, one word per register set */
+	uint32_t high[ESM_WORDS];
+	uint32_t low[ESM_WORDS];
+	uint32_t pin[ESM_WORDS];
+	uint32_t ltc_preload;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct ti_hercules_esm_data {
+	struct ti_hercules_esm_handler handlers[ESM_SOURCES];
+	/* Atomic, the high level interrupt is an FIQ and is not masked by irq_lock() */
+	atomic_t counts[ESM_SOURCES];
+};
+
+static int esm_source(uint8_t group, uint8_t channel)
+{
+	if (group == TI_HERCULES_ESM_GROUP1 && channel < TI_HERCULES_ESM_GROUP1_CHANNELS) {
+		return (channel / 32U) * 64U + channel % 32U;
+	}
+	if (group == TI_HERCULES_ESM_GROUP2 && channel < TI_HERCULES_ESM_GROUP2_CHANNELS) {
+		return (channel / 32U) * 64U + 32U + channel % 32U;
+	}
+	return -EINVAL;
+}
+
+static void esm_dispatch(const struct device *dev, volatile uint32_t *offset_reg)
+{
+	struct ti_hercules_esm_data *data = DEV_DATA(dev);
+	uintptr_t base = (uintptr_t)DEV_REGS(dev);
+
+	/* Bounded: every iteration clears one pending source. */
+	for (uint32_t i = 0; i < ESM_SOURCES; i++) {
+		uint32_t vec = HERCULES_MMIO_READ32(offset_reg);
+		uint32_t src, block;
+		struct ti_hercules_esm_handler *handler;
+
+		if (vec == 0U || vec > ESM_SOURCES) {
+			break;
+		}
+		src = vec - 1U;
+		block = src / 32U;
+		HERCULES_MMIO_WRITE32((volatile uint32_t *)(base + esm_status_offset[block]),
+				      BIT(src % 32U));
+		atomic_inc(&data->counts[src]);
+
+		handler = &data->handlers[src];
+		if (handler->cb != NULL) {
+			handler->cb(dev,
+				    (block & 1U) ? TI_HERCULES_ESM_GROUP2 : TI_HERCULES_ESM_GROUP1,
+				    (block / 2U) * 32U + src % 32U, handler->user_data);
+		}
+	}
+}
+
+void ti_hercules_esm_dispatch_high(const struct device *dev)
+{
+	esm_dispatch(dev, &DEV_REGS(dev)->IOFFHR);
+}
+
+static void ti_hercules_esm_low_isr(const struct device *dev)
+{
+	esm_dispatch(dev, &DEV_REGS(dev)->IOFFLR);
+}
+
+int ti_hercules_esm_callback_set(const struct device *dev, uint8_t group, uint8_t channel,
+				 ti_hercules_esm_callback_t cb, void *user_data)
+{
+	struct ti_hercules_esm_handler *handler;
+	int src = esm_source(group, channel);
+
+	if (src < 0) {
+		return src;
+	}
+	handler = &DEV_DATA(dev)->handlers[src];
+
+	/*
+	 * The high level interrupt is an FIQ and is not masked by irq_lock(),
+	 * so order the stores such that the ISR never sees a callback paired
+	 * with stale user data.
+	 */
+	handler->cb = NULL;
+	compiler_barrier();
+	handler->user_data = user_data;
+	compiler_barrier();
+	handler->cb = cb;
+
+	return 0;
+}
+
+int ti_hercules_esm_report(const struct device *dev, uint8_t group, uint8_t channel)
+{
+	struct ti_hercules_esm_data *data = DEV_DATA(dev);
+	struct ti_hercules_esm_handler *handler;
+	ti_hercules_esm_callback_t cb;
+	int src = esm_source(group, channel);
+
+	if (src < 0) {
+		return src;
+	}
+	handler = &data->handlers[src];
+
+	atomic_inc(&data->counts[src]);
+
+	cb = handler->cb;
+	if (cb != NULL) {
+		cb(dev, group, channel, handler->user_data);
+	}
+
+	return 0;
+}
+
+uint32_t ti_hercules_esm_error_count(const struct device *dev, uint8_t group, uint8_t channel)
+{
+	int src = esm_source(group, channel);
+
+	if (src < 0) {
+		return 0;
+	}
+	return (uint32_t)atomic_get(&DEV_DATA(dev)->counts[src]);
+}
+
+bool ti_hercules_esm_error_pin_active(const struct device *dev)
+{
+	return (HERCULES_REG_READ(DEV_REGS(dev), EPSR) & EPSR_NO_ERROR) == 0U;
+}
+
+int ti_hercules_esm_error_pin_reset(const struct device *dev)
+{
+	volatile struct hercules_esm_regs *regs = DEV_REGS(dev);
+
+	if ((HERCULES_REG_READ(regs, EPSR) & EPSR_NO_ERROR) != 0U) {
+		return 0;
+	}
+	/* Ignored by hardware while the low time counter is still running. */
+	HERCULES_REG_WRITE(regs, EKR, ESM_KEY_NORM);
+
+	return (HERCULES_REG_READ(regs, EPSR) & EPSR_NO_ERROR) != 0U ? 0 : -EBUSY;
+}
+
+static int ti_hercules_esm_init(const struct device *dev)
+{
+	const struct ti_hercules_esm_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_esm_regs *regs = DEV_REGS(dev);
+
+	/* Start from a known state, the bootloader may have left channels enabled. */
+	HERCULES_REG_WRITE(regs, IECR1, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, IECR4, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, IECR7, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, DEPAPR1, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, IEPCR4, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, IEPCR7, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, ILCR1, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, ILCR4, UINT32_MAX);
+	HERCULES_REG_WRITE(regs, ILCR7, UINT32_MAX);
+
+	HERCULES_REG_WRITE(regs, LTCPR, cfg->ltc_preload);
+
+	HERCULES_REG_WRITE(regs, ILSR1, cfg->high[0]);
+	HERCULES_REG_WRITE(regs, ILSR4, cfg->high[1]);
+	HERCULES_REG_WRITE(regs, ILSR7, cfg->high[2]);
+	HERCULES_REG_WRITE(regs, EEPAPR1, cfg->pin[0]);
+	HERCULES_REG_WRITE(regs, IEPSR4, cfg->pin[1]);
+	HERCULES_REG_WRITE(regs, IEPSR7, cfg->pin[2]);
+
+	cfg->irq_config_func(dev);
+
+	/*
+	 * Errors latched before this point are left pending so they are
+	 * dispatched and counted as soon as the interrupts are enabled.
+	 */
+	HERCULES_REG_WRITE(regs, IESR1, cfg->high[0] | cfg->low[0]);
+	HERCULES_REG_WRITE(regs, IESR4, cfg->high[1] | cfg->low[1]);
+	HERCULES_REG_WRITE(regs, IESR7, cfg->high[2] | cfg->low[2]);
+
+	return 0;
+}
+
+#define ESM_CHANNEL_BIT(node_id, prop, idx, word)                                                  \
+	(((DT_PROP_BY_IDX(node_id, prop, idx) / 32U) == (word))                                    \
+		 ? BIT(DT_PROP_BY_IDX(node_id, prop, idx) % 32U)                                   \
+		 : 0U) |
+
+#define ESM_CHANNEL_MASK(n, prop, word)                                                            \
+	(DT_INST_FOREACH_PROP_ELEM_VARGS(n, prop, ESM_CHANNEL_BIT, word) 0U)
+
+#define ESM_CHANNEL_MASKS(n, prop)                                                                 \
+	{ESM_CHANNEL_MASK(n, prop, 0), ESM_CHANNEL_MASK(n, prop, 1), ESM_CHANNEL_MASK(n, prop, 2)}
+
+#ifdef CONFIG_RUNTIME_NMI
+/*
+ * The Cortex-R takes the FIQ through the NMI vector, so the high level
+ * interrupt never reaches the software ISR table.
+ */
+#define ESM_HIGH_CONNECT(n)                                                                        \
+	static void ti_hercules_esm_nmi_##n(void)                                                  \
+	{                                                                                          \
+		ti_hercules_esm_dispatch_high(DEVICE_DT_INST_GET(n));                              \
+	}                                                                                          \
+                                                                                                   \
+	static void ti_hercules_esm_high_config_##n(void)                                          \
+	{                                                                                          \
+		z_soc_irq_priority_set(DT_INST_IRQ_BY_NAME(n, high, irq),                          \
+				       DT_INST_IRQ_BY_NAME(n, high, priority),                     \
+				       DT_INST_IRQ_BY_NAME(n, high, type));                        \
+		z_arm_nmi_set_handler(ti_hercules_esm_nmi_##n);                                    \
+		irq_enable(DT_INST_IRQ_BY_NAME(n, high, irq));                                     \
+	}
+#else
+#define ESM_HIGH_CONNECT(n)                                                                        \
+	static void ti_hercules_esm_high_config_##n(void)                                          \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(n, high, irq),                                     \
+			    DT_INST_IRQ_BY_NAME(n, high, priority), ti_hercules_esm_dispatch_high, \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ_BY_NAME(n, high, type));            \
+		irq_enable(DT_INST_IRQ_BY_NAME(n, high, irq));                                     \
+	}
+#endif
+
+#define TI_HERCULES_ESM_INIT(n)                                                                    \
+	ESM_HIGH_CONNECT(n)                                                                        \
+                                                                                                   \
+	static void ti_hercules_esm_irq_config_##n(const struct device *dev)                       \
+	{                                                                                          \
+		ti_hercules_esm_high_config_##n();                                                 \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(n, low, irq),                                      \
+			    DT_INST_IRQ_BY_NAME(n, low, priority), ti_hercules_esm_low_isr,        \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ_BY_NAME(n, low, type));             \
+		irq_enable(DT_INST_IRQ_BY_NAME(n, low, irq));                                      \
+	}                                                                                          \
+                                                                                                   \
+	static const struct ti_hercules_esm_config ti_hercules_esm_config_##n = {                  \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.high = ESM_CHANNEL_MASKS(n, high_channels),                                       \
+		.low = ESM_CHANNEL_MASKS(n, low_channels),                                         \
+		.pin = ESM_CHANNEL_MASKS(n, error_pin_channels),                                   \
+		.ltc_preload = DT_INST_PROP(n, ltc_preload),                                       \
+		.irq_config_func = ti_hercules_esm_irq_config_##n,                                 \
+	};                                                                                         \
+                                                                                                   \
+	static struct ti_hercules_esm_data ti_hercules_esm_data_##n;                               \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(n, ti_hercules_esm_init, NULL, &ti_hercules_esm_data_##n,            \
+			      &ti_hercules_esm_config_##n, PRE_KERNEL_1,                           \
+			      CONFIG_TI_HERCULES_ESM_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(TI_HERCULES_ESM_INIT)
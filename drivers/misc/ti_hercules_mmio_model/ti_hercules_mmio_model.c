@@ -0,0 +1,985 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Behavioural model of the RM57Lx SYS1, SYS2, VIM, RTI, ESM and EMAC register
+ * blocks for running the system drivers on native_sim.
+ *
+ * Every register access advances the model time by one cycle, which drives
+ * the clock source start up (CSVSTAT), the RTI counters and compares, the
+ * digital watchdog and the ESM low time counter. Peripherals are not modelled,
+ * use hercules_mmio_model_vim_raise() and hercules_mmio_model_esm_raise() to
+ * inject their requests. VIM channels map one to one onto requests, CHANCTRL
+ * is stored but not applied. A compare without update value (UDCP 0) fires
+ * once and stays quiet until its COMP register is written again.
+ *
+ * The EMAC walks the channel 0 CPPI descriptor queues in CPPI RAM as a DMA
+ * master would. A TXHDP write sends the whole queue at once and frames are
+ * received with hercules_mmio_model_emac_receive(). Descriptor buffer pointers
+ * are dereferenced as host addresses, which fit the 32-bit native_sim.
+ */
+
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/dt-bindings/clock/ti-hercules-clock.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+#include <string.h>
+
+#define SYS1_BASE 0xFFFFFF00U
+#define SYS2_BASE 0xFFFFE100U
+#define VIM_BASE  0xFFFFFD00U
+#define RTI_BASE  0xFFFFFC00U
+#define ESM_BASE  0xFFFFF500U
+#define EMAC_BASE 0xFCF78000U
+#define ECTL_BASE 0xFCF78800U
+#define CPPI_BASE 0xFC520000U
+
+/* SYS1 */
+#define SYS1_CSDIS    0x30U
+#define SYS1_CSDISSET 0x34U
+#define SYS1_CSDISCLR 0x38U
+#define SYS1_CDDIS    0x3CU
+#define SYS1_CDDISSET 0x40U
+#define SYS1_CDDISCLR 0x44U
+#define SYS1_CSVSTAT  0x54U
+#define SYS1_PLLCTL1  0x70U
+#define SYS1_SYSESR   0xE4U
+#define SYS1_GBLSTAT  0xECU
+#define SYS1_DEVID    0xF0U
+
+#define SYS1_CSDIS_RESET 0xCEU
+#define SYS1_DEVID_RM57  0x8044AD05U
+
+/* SYS2 */
+#define SYS2_PLLCTL3 0x00U
+
+/* VIM */
+#define VIM_IRQINDEX    0x100U
+#define VIM_FIQINDEX    0x104U
+#define VIM_FIRQPR      0x110U
+#define VIM_INTREQ      0x120U
+#define VIM_REQMASKSET  0x130U
+#define VIM_REQMASKCLR  0x140U
+#define VIM_WAKEMASKSET 0x150U
+#define VIM_WAKEMASKCLR 0x160U
+#define VIM_WORDS       4U
+#define VIM_CHANNELS    (VIM_WORDS * 32U)
+#define VIM_FIQ_ONLY    0x3U
+
+/* RTI */
+#define RTI_GCTRL       0x00U
+#define RTI_COMPCTRL    0x0CU
+#define RTI_CNT(n)      (0x10U + (n) * 0x20U)
+#define RTI_FRC         0x00U
+#define RTI_UC          0x04U
+#define RTI_CPUC        0x08U
+#define RTI_COMP(n)     (0x50U + (n) * 8U)
+#define RTI_UDCP(n)     (0x54U + (n) * 8U)
+#define RTI_SETINTENA   0x80U
+#define RTI_CLEARINTENA 0x84U
+#define RTI_INTFLAG     0x88U
+#define RTI_DWDCTRL     0x90U
+#define RTI_DWDPRLD     0x94U
+#define RTI_WDSTATUS    0x98U
+#define RTI_WDKEY       0x9CU
+#define RTI_DWDCNTR     0xA0U
+#define RTI_WWDRXNCTRL  0xA4U
+#define RTI_WWDSIZECTRL 0xA8U
+#define RTI_COMPARES    4U
+#define RTI_VIM_COMP0   2U
+
+#define DWD_ENABLE       0xA98559DAU
+#define DWD_KEY_FIRST    0xE51AU
+#define DWD_KEY_SECOND   0xA35CU
+#define DWD_RXN_NMI      0xAU
+#define WDSTATUS_EXPIRED BIT(5)
+#define WDSTATUS_EARLY   BIT(3)
+#define SYSESR_WATCHDOG  BIT(13)
+#define SYSESR_EXT       BIT(3)
+
+/* ESM */
+#define ESM_EEPAPR1 0x00U
+#define ESM_DEPAPR1 0x04U
+#define ESM_IESR1   0x08U
+#define ESM_IECR1   0x0CU
+#define ESM_ILSR1   0x10U
+#define ESM_ILCR1   0x14U
+#define ESM_SR1     0x18U
+#define ESM_EPSR    0x24U
+#define ESM_IOFFHR  0x28U
+#define ESM_IOFFLR  0x2CU
+#define ESM_LTCR    0x30U
+#define ESM_LTCPR   0x34U
+#define ESM_EKR     0x38U
+#define ESM_IEPSR4  0x40U
+#define ESM_IEPCR4  0x44U
+#define ESM_IESR4   0x48U
+#define ESM_IECR4   0x4CU
+#define ESM_ILSR4   0x50U
+#define ESM_ILCR4   0x54U
+#define ESM_SR4     0x58U
+#define ESM_IEPSR7  0x80U
+#define ESM_IEPCR7  0x84U
+#define ESM_IESR7   0x88U
+#define ESM_IECR7   0x8CU
+#define ESM_ILSR7   0x90U
+#define ESM_ILCR7   0x94U
+#define ESM_SR7     0x98U
+#define ESM_WORDS   3U
+#define ESM_VIM_HIGH 0U
+#define ESM_VIM_LOW  20U
+#define ESM_KEY_NORM 0x5U
+#define ESM_LTCPR_RESET 0x3FFFU
+
+/* EMAC, channel 0 only */
+#define EMAC_TXCONTROL      0x004U
+#define EMAC_RXCONTROL      0x014U
+#define EMAC_TXINTSTATRAW   0x080U
+#define EMAC_TXINTMASKSET   0x088U
+#define EMAC_TXINTMASKCLEAR 0x08CU
+#define EMAC_MACEOIVECTOR   0x094U
+#define EMAC_RXINTSTATRAW   0x0A0U
+#define EMAC_RXINTMASKSET   0x0A8U
+#define EMAC_RXINTMASKCLEAR 0x0ACU
+#define EMAC_SOFTRESET      0x174U
+#define EMAC_RXGOODFRAMES   0x200U
+#define EMAC_TXGOODFRAMES   0x234U
+#define EMAC_RXSOFOVERRUNS  0x280U
+#define EMAC_TXHDP          0x600U
+#define EMAC_RXHDP          0x620U
+#define EMAC_TXCP           0x640U
+#define EMAC_RXCP           0x660U
+#define ECTL_SOFTRESET      0x04U
+#define ECTL_C0RXEN         0x14U
+#define ECTL_C0TXEN         0x18U
+#define EMAC_VIM_TX         77U
+#define EMAC_VIM_RX         79U
+#define EMAC_FRAMES         8U
+#define EMAC_FRAME_MAX      1536U
+
+#define CPPI_DESC_SOP      BIT(31)
+#define CPPI_DESC_EOP      BIT(30)
+#define CPPI_DESC_OWNER    BIT(29)
+#define CPPI_DESC_EOQ      BIT(28)
+#define CPPI_DESC_LEN_MASK 0xFFFFU
+
+#define BLOCK_WORDS(size) ((size) / sizeof(uint32_t))
+
+struct model_block {
+	uintptr_t base;
+	uint32_t *mem;
+	size_t size;
+	uint32_t (*read)(uint32_t off);
+	void (*write)(uint32_t off, uint32_t val);
+};
+
+static uint32_t sys1_mem[BLOCK_WORDS(0x100)];
+static uint32_t sys2_mem[BLOCK_WORDS(0x100)];
+static uint32_t vim_mem[BLOCK_WORDS(0x200)];
+static uint32_t rti_mem[BLOCK_WORDS(0xC0)];
+static uint32_t esm_mem[BLOCK_WORDS(0xA4)];
+static uint32_t emac_mem[BLOCK_WORDS(0x800)];
+static uint32_t ectl_mem[BLOCK_WORDS(0x100)];
+static uint32_t cppi_mem[BLOCK_WORDS(0x2000)];
+
+struct cppi_desc {
+	uint32_t next;
+	uint32_t buf;
+	uint32_t off_len;
+	uint32_t flags_len;
+};
+
+struct emac_frame {
+	uint8_t data[EMAC_FRAME_MAX];
+	size_t len;
+};
+
+static struct {
+	uint64_t now;
+	/* SYS1 */
+	uint64_t src_valid_at[CLOCK_SRC_EXTCLKIN2 + 1];
+	/* VIM */
+	uint32_t pending[VIM_WORDS];
+	uint32_t mask[VIM_WORDS];
+	uint32_t wake[VIM_WORDS];
+	/* RTI */
+	uint64_t rti_last;
+	uint32_t rti_intena;
+	uint32_t rti_fired;
+	bool dwd_key_armed;
+	/* ESM */
+	uint32_t esm_pin[ESM_WORDS];
+	uint32_t esm_ie[ESM_WORDS];
+	uint32_t esm_il[ESM_WORDS];
+	/* EMAC */
+	uint32_t emac_tx_mask;
+	uint32_t emac_rx_mask;
+	struct emac_frame emac_sent[EMAC_FRAMES];
+	uint32_t emac_sent_head;
+	uint32_t emac_sent_tail;
+} model;
+
+#define REG(mem, off) ((mem)[(off) / sizeof(uint32_t)])
+
+/*
+ * SYS1/SYS2: clock sources become valid (CSVSTAT) a start up time after being
+ * enabled. A PLL needs 127 + 1024 * NR reference cycles to lock.
+ */
+
+static uint32_t pll_lock_cycles(uint32_t pllctl)
+{
+	return 127U + 1024U * (((pllctl >> 16) & 0x3FU) + 1U);
+}
+
+static void sys1_sources_on(uint32_t sources)
+{
+	for (uint32_t src = 0; src < ARRAY_SIZE(model.src_valid_at); src++) {
+		uint32_t delay = 0U;
+
+		if ((sources & BIT(src)) == 0U) {
+			continue;
+		}
+		if (src == CLOCK_SRC_PLL1) {
+			delay = pll_lock_cycles(REG(sys1_mem, SYS1_PLLCTL1));
+		} else if (src == CLOCK_SRC_PLL2) {
+			delay = pll_lock_cycles(REG(sys2_mem, SYS2_PLLCTL3));
+		}
+		model.src_valid_at[src] = model.now + delay;
+	}
+}
+
+static void sys1_csdis_write(uint32_t csdis)
+{
+	uint32_t old = REG(sys1_mem, SYS1_CSDIS);
+
+	REG(sys1_mem, SYS1_CSDIS) = csdis;
+	sys1_sources_on(old & ~csdis);
+}
+
+static uint32_t sys1_read(uint32_t off)
+{
+	uint32_t csvstat = 0U;
+
+	switch (off) {
+	case SYS1_CSDISSET:
+	case SYS1_CSDISCLR:
+		return REG(sys1_mem, SYS1_CSDIS);
+	case SYS1_CDDISSET:
+	case SYS1_CDDISCLR:
+		return REG(sys1_mem, SYS1_CDDIS);
+	case SYS1_CSVSTAT:
+		for (uint32_t src = 0; src < ARRAY_SIZE(model.src_valid_at); src++) {
+			if ((REG(sys1_mem, SYS1_CSDIS) & BIT(src)) == 0U &&
+			    model.now >= model.src_valid_at[src]) {
+				csvstat |= BIT(src);
+			}
+		}
+		return csvstat;
+	default:
+		return REG(sys1_mem, off);
+	}
+}
+
+static void sys1_write(uint32_t off, uint32_t val)
+{
+	switch (off) {
+	case SYS1_CSDIS:
+		sys1_csdis_write(val);
+		break;
+	case SYS1_CSDISSET:
+		sys1_csdis_write(REG(sys1_mem, SYS1_CSDIS) | val);
+		break;
+	case SYS1_CSDISCLR:
+		sys1_csdis_write(REG(sys1_mem, SYS1_CSDIS) & ~val);
+		break;
+	case SYS1_CDDISSET:
+		REG(sys1_mem, SYS1_CDDIS) |= val;
+		break;
+	case SYS1_CDDISCLR:
+		REG(sys1_mem, SYS1_CDDIS) &= ~val;
+		break;
+	case SYS1_CSVSTAT:
+	case SYS1_DEVID:
+		/* Read only */
+		break;
+	case SYS1_SYSESR:
+	case SYS1_GBLSTAT:
+		REG(sys1_mem, off) &= ~val;
+		break;
+	default:
+		REG(sys1_mem, off) = val;
+		break;
+	}
+}
+
+/* VIM: highest priority (lowest numbered) enabled pending channel per FIQ/IRQ class. */
+
+static uint32_t vim_index(bool fiq)
+{
+	for (uint32_t w = 0; w < VIM_WORDS; w++) {
+		uint32_t firq = REG(vim_mem, VIM_FIRQPR + w * 4U);
+		uint32_t active = model.pending[w] & model.mask[w] & (fiq ? firq : ~firq);
+
+		if (active != 0U) {
+			return w * 32U + u32_count_trailing_zeros(active) + 1U;
+		}
+	}
+	return 0U;
+}
+
+static uint32_t vim_read(uint32_t off)
+{
+	uint32_t w = (off & 0xFU) / 4U;
+
+	switch (off & ~0xFU) {
+	case VIM_IRQINDEX:
+		return vim_index(off == VIM_FIQINDEX);
+	case VIM_INTREQ:
+		return model.pending[w];
+	case VIM_REQMASKSET:
+	case VIM_REQMASKCLR:
+		return model.mask[w];
+	case VIM_WAKEMASKSET:
+	case VIM_WAKEMASKCLR:
+		return model.wake[w];
+	default:
+		return REG(vim_mem, off);
+	}
+}
+
+static void vim_write(uint32_t off, uint32_t val)
+{
+	uint32_t w = (off & 0xFU) / 4U;
+
+	switch (off & ~0xFU) {
+	case VIM_IRQINDEX:
+		/* Read only */
+		break;
+	case VIM_FIRQPR:
+		REG(vim_mem, off) = (w == 0U) ? (val | VIM_FIQ_ONLY) : val;
+		break;
+	case VIM_INTREQ:
+		model.pending[w] &= ~val;
+		break;
+	case VIM_REQMASKSET:
+		model.mask[w] |= val;
+		break;
+	case VIM_REQMASKCLR:
+		model.mask[w] &= ~val;
+		break;
+	case VIM_WAKEMASKSET:
+		model.wake[w] |= val;
+		break;
+	case VIM_WAKEMASKCLR:
+		model.wake[w] &= ~val;
+		break;
+	default:
+		REG(vim_mem, off) = val;
+		break;
+	}
+}
+
+void hercules_mmio_model_vim_raise(unsigned int channel)
+{
+	__ASSERT_NO_MSG(channel < VIM_CHANNELS);
+	model.pending[channel / 32U] |= BIT(channel % 32U);
+}
+
+/* ESM */
+
+static const uint16_t esm_sr_offset[ESM_WORDS] = {ESM_SR1, ESM_SR4, ESM_SR7};
+
+static uint32_t esm_offset(bool high)
+{
+	/* Interrupt offset blocks alternate group 1 and group 2, see the ESM driver. */
+	for (uint32_t blk = 0; blk < 5U; blk++) {
+		uint32_t w = blk / 2U;
+		uint32_t active;
+
+		if ((blk & 1U) != 0U) {
+			/* Group 2 always raises the high level interrupt */
+			active = high ? REG(esm_mem, esm_sr_offset[w] + 4U) : 0U;
+		} else {
+			active = REG(esm_mem, esm_sr_offset[w]) & model.esm_ie[w] &
+				 (high ? model.esm_il[w] : ~model.esm_il[w]);
+		}
+		if (active != 0U) {
+			return blk * 32U + u32_count_trailing_zeros(active) + 1U;
+		}
+	}
+	return 0U;
+}
+
+static void esm_update_requests(void)
+{
+	if (esm_offset(true) != 0U) {
+		hercules_mmio_model_vim_raise(ESM_VIM_HIGH);
+	}
+	if (esm_offset(false) != 0U) {
+		hercules_mmio_model_vim_raise(ESM_VIM_LOW);
+	}
+}
+
+void hercules_mmio_model_esm_raise(unsigned int group, unsigned int channel)
+{
+	uint32_t w = channel / 32U;
+	uint32_t bit = BIT(channel % 32U);
+	bool pin;
+
+	__ASSERT_NO_MSG(group >= 1U && group <= 3U);
+	__ASSERT_NO_MSG(w < ((group == 1U) ? ESM_WORDS : ESM_WORDS - 1U));
+
+	REG(esm_mem, esm_sr_offset[w] + (group - 1U) * 4U) |= bit;
+	pin = (group != 1U) || (model.esm_pin[w] & bit) != 0U;
+	if (pin) {
+		REG(esm_mem, ESM_EPSR) = 0U;
+		REG(esm_mem, ESM_LTCR) = REG(esm_mem, ESM_LTCPR);
+	}
+	esm_update_requests();
+}
+
+struct esm_set_clr {
+	uint16_t set;
+	uint16_t clr;
+	uint32_t *state;
+};
+
+static const struct esm_set_clr esm_pairs[] = {
+	{ESM_EEPAPR1, ESM_DEPAPR1, &model.esm_pin[0]}, {ESM_IEPSR4, ESM_IEPCR4, &model.esm_pin[1]},
+	{ESM_IEPSR7, ESM_IEPCR7, &model.esm_pin[2]},   {ESM_IESR1, ESM_IECR1, &model.esm_ie[0]},
+	{ESM_IESR4, ESM_IECR4, &model.esm_ie[1]},      {ESM_IESR7, ESM_IECR7, &model.esm_ie[2]},
+	{ESM_ILSR1, ESM_ILCR1, &model.esm_il[0]},      {ESM_ILSR4, ESM_ILCR4, &model.esm_il[1]},
+	{ESM_ILSR7, ESM_ILCR7, &model.esm_il[2]},
+};
+
+static bool esm_is_status(uint32_t off)
+{
+	for (uint32_t w = 0; w < ESM_WORDS; w++) {
+		if (off >= esm_sr_offset[w] && off < esm_sr_offset[w] + 12U) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static uint32_t esm_read(uint32_t off)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(esm_pairs); i++) {
+		if (off == esm_pairs[i].set || off == esm_pairs[i].clr) {
+			return *esm_pairs[i].state;
+		}
+	}
+	switch (off) {
+	case ESM_IOFFHR:
+		return esm_offset(true);
+	case ESM_IOFFLR:
+		return esm_offset(false);
+	default:
+		return REG(esm_mem, off);
+	}
+}
+
+static void esm_write(uint32_t off, uint32_t val)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(esm_pairs); i++) {
+		if (off == esm_pairs[i].set) {
+			*esm_pairs[i].state |= val;
+			esm_update_requests();
+			return;
+		}
+		if (off == esm_pairs[i].clr) {
+			*esm_pairs[i].state &= ~val;
+			return;
+		}
+	}
+	if (esm_is_status(off)) {
+		REG(esm_mem, off) &= ~val;
+		return;
+	}
+	switch (off) {
+	case ESM_EKR:
+		/* The pin is only released once the low time counter expired */
+		if (val == ESM_KEY_NORM && REG(esm_mem, ESM_LTCR) == 0U) {
+			REG(esm_mem, ESM_EPSR) = 1U;
+		}
+		break;
+	case ESM_EPSR:
+	case ESM_IOFFHR:
+	case ESM_IOFFLR:
+	case ESM_LTCR:
+		/* Read only */
+		break;
+	default:
+		REG(esm_mem, off) = val;
+		break;
+	}
+}
+
+/* RTI: counters, compares and the digital windowed watchdog follow model time. */
+
+static uint32_t dwd_reload(void)
+{
+	return ((REG(rti_mem, RTI_DWDPRLD) & 0xFFFU) + 1U) << 13;
+}
+
+static uint32_t dwd_window(void)
+{
+	uint32_t size = REG(rti_mem, RTI_WWDSIZECTRL);
+	uint32_t shift = 0U;
+
+	/* 0x5 is 100%, every further nibble halves the window */
+	while (size > 0x5U && shift < 5U) {
+		size >>= 4;
+		shift++;
+	}
+	return dwd_reload() >> shift;
+}
+
+static void dwd_violation(uint32_t status)
+{
+	REG(rti_mem, RTI_WDSTATUS) |= status;
+	if (REG(rti_mem, RTI_WWDRXNCTRL) == DWD_RXN_NMI) {
+		/* RTI windowed watchdog NMI */
+		hercules_mmio_model_esm_raise(2U, 24U);
+	} else {
+		/*
+		 * Record a watchdog reset for hwinfo, the model keeps running. The
+		 * reset drives nRST, so the external reset flag is latched as well.
+		 */
+		REG(sys1_mem, SYS1_SYSESR) |= SYSESR_WATCHDOG | SYSESR_EXT;
+	}
+	REG(rti_mem, RTI_DWDCNTR) = dwd_reload() - 1U;
+}
+
+static void rti_advance(void)
+{
+	uint64_t delta = model.now - model.rti_last;
+
+	model.rti_last = model.now;
+
+	for (uint32_t c = 0; c < 2U; c++) {
+		uint32_t cnt = RTI_CNT(c);
+		uint64_t period, ticks;
+
+		if ((REG(rti_mem, RTI_GCTRL) & BIT(c)) == 0U) {
+			continue;
+		}
+		period = (uint64_t)REG(rti_mem, cnt + RTI_CPUC) + 1U;
+		ticks = REG(rti_mem, cnt + RTI_UC) + delta;
+		REG(rti_mem, cnt + RTI_FRC) += (uint32_t)(ticks / period);
+		REG(rti_mem, cnt + RTI_UC) = (uint32_t)(ticks % period);
+	}
+
+	for (uint32_t k = 0; k < RTI_COMPARES; k++) {
+		uint32_t c = (REG(rti_mem, RTI_COMPCTRL) >> (4U * k)) & 1U;
+		uint32_t frc = REG(rti_mem, RTI_CNT(c) + RTI_FRC);
+		uint32_t comp = REG(rti_mem, RTI_COMP(k));
+		uint32_t udcp = REG(rti_mem, RTI_UDCP(k));
+		uint32_t late = frc - comp;
+
+		if ((REG(rti_mem, RTI_GCTRL) & BIT(c)) == 0U || (int32_t)late < 0 ||
+		    (model.rti_fired & BIT(k)) != 0U) {
+			continue;
+		}
+		REG(rti_mem, RTI_INTFLAG) |= BIT(k);
+		if (udcp != 0U) {
+			REG(rti_mem, RTI_COMP(k)) = comp + (late / udcp + 1U) * udcp;
+		} else {
+			model.rti_fired |= BIT(k);
+		}
+		if ((model.rti_intena & BIT(k)) != 0U) {
+			hercules_mmio_model_vim_raise(RTI_VIM_COMP0 + k);
+		}
+	}
+
+	if (REG(rti_mem, RTI_DWDCTRL) == DWD_ENABLE) {
+		if (REG(rti_mem, RTI_DWDCNTR) <= delta) {
+			dwd_violation(WDSTATUS_EXPIRED);
+		} else {
+			REG(rti_mem, RTI_DWDCNTR) -= (uint32_t)delta;
+		}
+	}
+
+	/* The ESM low time counter runs from the same model time */
+	REG(esm_mem, ESM_LTCR) -= (uint32_t)MIN((uint64_t)REG(esm_mem, ESM_LTCR), delta);
+}
+
+static uint32_t rti_read(uint32_t off)
+{
+	switch (off) {
+	case RTI_SETINTENA:
+	case RTI_CLEARINTENA:
+		return model.rti_intena;
+	default:
+		return REG(rti_mem, off);
+	}
+}
+
+static void rti_write(uint32_t off, uint32_t val)
+{
+	for (uint32_t k = 0; k < RTI_COMPARES; k++) {
+		if (off == RTI_COMP(k)) {
+			model.rti_fired &= ~BIT(k);
+		}
+	}
+
+	switch (off) {
+	case RTI_SETINTENA:
+		model.rti_intena |= val;
+		break;
+	case RTI_CLEARINTENA:
+		model.rti_intena &= ~val;
+		break;
+	case RTI_INTFLAG:
+	case RTI_WDSTATUS:
+		REG(rti_mem, off) &= ~val;
+		break;
+	case RTI_DWDCTRL:
+		/* Enabling is one way until reset */
+		if (val == DWD_ENABLE && REG(rti_mem, off) != DWD_ENABLE) {
+			REG(rti_mem, off) = val;
+			REG(rti_mem, RTI_DWDCNTR) = dwd_reload() - 1U;
+		}
+		break;
+	case RTI_WDKEY:
+		if (val == DWD_KEY_FIRST) {
+			model.dwd_key_armed = true;
+		} else if (val == DWD_KEY_SECOND && model.dwd_key_armed) {
+			model.dwd_key_armed = false;
+			if (REG(rti_mem, RTI_DWDCTRL) != DWD_ENABLE) {
+				break;
+			}
+			if (REG(rti_mem, RTI_DWDCNTR) >= dwd_window()) {
+				dwd_violation(WDSTATUS_EARLY);
+			} else {
+				REG(rti_mem, RTI_DWDCNTR) = dwd_reload() - 1U;
+			}
+		} else {
+			model.dwd_key_armed = false;
+		}
+		break;
+	case RTI_DWDCNTR:
+		/* Read only */
+		break;
+	default:
+		REG(rti_mem, off) = val;
+		break;
+	}
+}
+
+/*
+ * EMAC: the interrupts are pulses, raised again by an EOI write while a
+ * completion is still unacknowledged.
+ */
+
+static struct cppi_desc *cppi_desc_of(uint32_t addr)
+{
+	__ASSERT(addr >= CPPI_BASE &&
+			 addr - CPPI_BASE <= sizeof(cppi_mem) - sizeof(struct cppi_desc),
+		 "descriptor 0x%x outside of CPPI RAM", addr);
+	return (struct cppi_desc *)((uint8_t *)cppi_mem + (addr - CPPI_BASE));
+}
+
+static void emac_update_requests(void)
+{
+	if ((REG(emac_mem, EMAC_TXINTSTATRAW) & model.emac_tx_mask & REG(ectl_mem, ECTL_C0TXEN) &
+	     BIT(0)) != 0U) {
+		hercules_mmio_model_vim_raise(EMAC_VIM_TX);
+	}
+	if ((REG(emac_mem, EMAC_RXINTSTATRAW) & model.emac_rx_mask & REG(ectl_mem, ECTL_C0RXEN) &
+	     BIT(0)) != 0U) {
+		hercules_mmio_model_vim_raise(EMAC_VIM_RX);
+	}
+}
+
+/* Send every frame queued from TXHDP, the queue ends with EOQ on the last one */
+static void emac_transmit(void)
+{
+	uint32_t addr = REG(emac_mem, EMAC_TXHDP);
+
+	while (addr != 0U) {
+		struct cppi_desc *sop = cppi_desc_of(addr);
+		struct emac_frame *frame =
+			&model.emac_sent[model.emac_sent_head % EMAC_FRAMES];
+		struct cppi_desc *desc;
+		uint32_t eop;
+
+		__ASSERT((sop->flags_len & (CPPI_DESC_SOP | CPPI_DESC_OWNER)) ==
+				 (CPPI_DESC_SOP | CPPI_DESC_OWNER),
+			 "descriptor 0x%x is not an owned SOP", addr);
+		__ASSERT(model.emac_sent_head - model.emac_sent_tail < EMAC_FRAMES,
+			 "sent frames not taken");
+
+		frame->len = 0U;
+		do {
+			uint32_t len;
+
+			desc = cppi_desc_of(addr);
+			len = desc->off_len & CPPI_DESC_LEN_MASK;
+			__ASSERT_NO_MSG(frame->len + len <= sizeof(frame->data));
+			memcpy(&frame->data[frame->len],
+			       (const uint8_t *)(uintptr_t)desc->buf + (desc->off_len >> 16), len);
+			frame->len += len;
+			eop = addr;
+			addr = desc->next;
+		} while ((desc->flags_len & CPPI_DESC_EOP) == 0U);
+		__ASSERT(frame->len == (sop->flags_len & CPPI_DESC_LEN_MASK),
+			 "packet length %u, buffers hold %u", sop->flags_len & CPPI_DESC_LEN_MASK,
+			 (unsigned int)frame->len);
+
+		model.emac_sent_head++;
+		REG(emac_mem, EMAC_TXGOODFRAMES)++;
+		if (addr == 0U) {
+			desc->flags_len |= CPPI_DESC_EOQ;
+		}
+		sop->flags_len &= ~CPPI_DESC_OWNER;
+		REG(emac_mem, EMAC_TXCP) = eop;
+		REG(emac_mem, EMAC_TXINTSTATRAW) |= BIT(0);
+	}
+	REG(emac_mem, EMAC_TXHDP) = 0U;
+	emac_update_requests();
+}
+
+int hercules_mmio_model_emac_receive(const uint8_t *data, size_t len)
+{
+	uint32_t addr = REG(emac_mem, EMAC_RXHDP);
+	struct cppi_desc *sop, *desc;
+	size_t room = 0U;
+	size_t done = 0U;
+	uint32_t eop;
+
+	__ASSERT_NO_MSG(len > 0U && len <= CPPI_DESC_LEN_MASK);
+
+	if ((REG(emac_mem, EMAC_RXCONTROL) & BIT(0)) == 0U) {
+		return -ENOBUFS;
+	}
+	/* The hardware fills buffers as it goes, the model drops a frame that will not fit */
+	for (uint32_t a = addr; a != 0U && room < len; a = cppi_desc_of(a)->next) {
+		room += cppi_desc_of(a)->off_len & CPPI_DESC_LEN_MASK;
+	}
+	if (room < len) {
+		REG(emac_mem, EMAC_RXSOFOVERRUNS)++;
+		return -ENOBUFS;
+	}
+
+	sop = cppi_desc_of(addr);
+	do {
+		size_t chunk;
+
+		desc = cppi_desc_of(addr);
+		chunk = MIN(desc->off_len & CPPI_DESC_LEN_MASK, len - done);
+		memcpy((uint8_t *)(uintptr_t)desc->buf, &data[done], chunk);
+		desc->off_len = chunk;
+		done += chunk;
+		eop = addr;
+		addr = desc->next;
+	} while (done < len);
+
+	/* OWNER is only released in the SOP descriptor */
+	sop->flags_len = CPPI_DESC_SOP | len;
+	desc->flags_len |= CPPI_DESC_EOP;
+	if (addr == 0U) {
+		desc->flags_len |= CPPI_DESC_EOQ;
+	}
+
+	REG(emac_mem, EMAC_RXHDP) = addr;
+	REG(emac_mem, EMAC_RXCP) = eop;
+	REG(emac_mem, EMAC_RXGOODFRAMES)++;
+	REG(emac_mem, EMAC_RXINTSTATRAW) |= BIT(0);
+	emac_update_requests();
+
+	return 0;
+}
+
+size_t hercules_mmio_model_emac_sent(uint8_t *data, size_t size)
+{
+	struct emac_frame *frame = &model.emac_sent[model.emac_sent_tail % EMAC_FRAMES];
+	size_t len;
+
+	if (model.emac_sent_tail == model.emac_sent_head) {
+		return 0U;
+	}
+	len = MIN(frame->len, size);
+	memcpy(data, frame->data, len);
+	model.emac_sent_tail++;
+
+	return frame->len;
+}
+
+static uint32_t emac_read(uint32_t off)
+{
+	switch (off) {
+	case EMAC_TXINTMASKSET:
+	case EMAC_TXINTMASKCLEAR:
+		return model.emac_tx_mask;
+	case EMAC_RXINTMASKSET:
+	case EMAC_RXINTMASKCLEAR:
+		return model.emac_rx_mask;
+	default:
+		return REG(emac_mem, off);
+	}
+}
+
+static void emac_write(uint32_t off, uint32_t val)
+{
+	switch (off) {
+	case EMAC_TXINTMASKSET:
+		model.emac_tx_mask |= val;
+		emac_update_requests();
+		break;
+	case EMAC_TXINTMASKCLEAR:
+		model.emac_tx_mask &= ~val;
+		break;
+	case EMAC_RXINTMASKSET:
+		model.emac_rx_mask |= val;
+		emac_update_requests();
+		break;
+	case EMAC_RXINTMASKCLEAR:
+		model.emac_rx_mask &= ~val;
+		break;
+	case EMAC_MACEOIVECTOR:
+		emac_update_requests();
+		break;
+	case EMAC_TXHDP:
+		REG(emac_mem, off) = val;
+		if ((REG(emac_mem, EMAC_TXCONTROL) & BIT(0)) != 0U) {
+			emac_transmit();
+		}
+		break;
+	case EMAC_TXCP:
+	case EMAC_RXCP:
+		/* Acknowledging the last completed descriptor ends the interrupt */
+		if (val == REG(emac_mem, off)) {
+			REG(emac_mem, off == EMAC_TXCP ? EMAC_TXINTSTATRAW : EMAC_RXINTSTATRAW) &=
+				~BIT(0);
+		}
+		break;
+	case EMAC_SOFTRESET:
+	case EMAC_TXINTSTATRAW:
+	case EMAC_RXINTSTATRAW:
+		/* Reset completes at once, the rest is read only */
+		break;
+	default:
+		REG(emac_mem, off) = val;
+		break;
+	}
+}
+
+static void ectl_write(uint32_t off, uint32_t val)
+{
+	switch (off) {
+	case ECTL_SOFTRESET:
+		/* Completes at once */
+		break;
+	case ECTL_C0TXEN:
+	case ECTL_C0RXEN:
+		REG(ectl_mem, off) = val;
+		emac_update_requests();
+		break;
+	default:
+		REG(ectl_mem, off) = val;
+		break;
+	}
+}
+
+static struct model_block blocks[] = {
+	{SYS1_BASE, sys1_mem, sizeof(sys1_mem), sys1_read, sys1_write},
+	{SYS2_BASE, sys2_mem, sizeof(sys2_mem), NULL, NULL},
+	{VIM_BASE, vim_mem, sizeof(vim_mem), vim_read, vim_write},
+	{RTI_BASE, rti_mem, sizeof(rti_mem), rti_read, rti_write},
+	{ESM_BASE, esm_mem, sizeof(esm_mem), esm_read, esm_write},
+	{EMAC_BASE, emac_mem, sizeof(emac_mem), emac_read, emac_write},
+	{ECTL_BASE, ectl_mem, sizeof(ectl_mem), NULL, ectl_write},
+	{CPPI_BASE, cppi_mem, sizeof(cppi_mem), NULL, NULL},
+};
+
+static struct model_block *model_block_of(volatile uint32_t *reg, uint32_t *off)
+{
+	uintptr_t addr = (uintptr_t)reg;
+
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		uintptr_t mem = (uintptr_t)blocks[i].mem;
+
+		if (addr >= mem && addr < mem + blocks[i].size) {
+			*off = addr - mem;
+			return &blocks[i];
+		}
+	}
+	__ASSERT(false, "%p is not a modelled register", (void *)reg);
+	return NULL;
+}
+
+void *hercules_mmio_model_map(uintptr_t addr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		if (addr >= blocks[i].base && addr < blocks[i].base + blocks[i].size) {
+			return (uint8_t *)blocks[i].mem + (addr - blocks[i].base);
+		}
+	}
+	__ASSERT(false, "0x%lx is not a modelled register block", (unsigned long)addr);
+	return NULL;
+}
+
+uint32_t hercules_mmio_model_read(volatile uint32_t *reg)
+{
+	uint32_t off;
+	struct model_block *block = model_block_of(reg, &off);
+
+	hercules_mmio_model_advance(1U);
+	return block->read != NULL ? block->read(off) : REG(block->mem, off);
+}
+
+void hercules_mmio_model_write(volatile uint32_t *reg, uint32_t val)
+{
+	uint32_t off;
+	struct model_block *block = model_block_of(reg, &off);
+
+	hercules_mmio_model_advance(1U);
+	if (block->write != NULL) {
+		block->write(off, val);
+	} else {
+		REG(block->mem, off) = val;
+	}
+}
+
+void hercules_mmio_model_advance(uint32_t cycles)
+{
+	model.now += cycles;
+	rti_advance();
+}
+
+uint64_t hercules_mmio_model_now(void)
+{
+	return model.now;
+}
+
+void hercules_mmio_model_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		memset(blocks[i].mem, 0, blocks[i].size);
+	}
+	memset(&model, 0, sizeof(model));
+
+	REG(sys1_mem, SYS1_CSDIS) = SYS1_CSDIS_RESET;
+	REG(sys1_mem, SYS1_SYSESR) = CONFIG_TI_HERCULES_MMIO_MODEL_RESET_CAUSE;
+	REG(sys1_mem, SYS1_DEVID) = SYS1_DEVID_RM57;
+	REG(vim_mem, VIM_FIRQPR) = VIM_FIQ_ONLY;
+	for (uint32_t w = 0; w < VIM_WORDS; w++) {
+		model.wake[w] = UINT32_MAX;
+	}
+	REG(esm_mem, ESM_EPSR) = 1U;
+	REG(esm_mem, ESM_LTCPR) = ESM_LTCPR_RESET;
+}
+
+static int hercules_mmio_model_init(void)
+{
+	hercules_mmio_model_reset();
+	return 0;
+}
+
+SYS_INIT(hercules_mmio_model_init, EARLY, 0);
@@ -0,0 +1,257 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_iomm
+
+#include <soc.h>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/drivers/pinctrl/pinctrl_ti_hercules.h>
+#include <zephyr/init.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+
+#define IOMM_NODE DT_DRV_INST(0)
+
+#define IOMM_PINMMR_COUNT 180U
+#define IOMM_KICK0_UNLOCK 0x83E70B13U
+#define IOMM_KICK1_UNLOCK 0x95A4F1E0U
+
+struct hercules_iomm_regs {
+	uint32_t REVISION;                  /* 0x0000 */
+	uint32_t rsvd1[7];                  /* 0x0004 */
+	uint32_t BOOT;                      /* 0x0020 */
+	uint32_t rsvd2[5];                  /* 0x0024 */
+	uint32_t KICK[2];                   /* 0x0038 */
+	uint32_t rsvd3[40];                 /* 0x0040 */
+	uint32_t ERR_RAW_STATUS;            /* 0x00E0 */
+	uint32_t ERR_ENABLED_STATUS;        /* 0x00E4 */
+	uint32_t ERR_ENABLE;                /* 0x00E8 */
+	uint32_t ERR_ENABLE_CLR;            /* 0x00EC */
+	uint32_t rsvd4;                     /* 0x00F0 */
+	uint32_t FAULT_ADDRESS;             /* 0x00F4 */
+	uint32_t FAULT_STATUS;              /* 0x00F8 */
+	uint32_t FAULT_CLEAR;               /* 0x00FC */
+	uint32_t rsvd5[4];                  /* 0x0100 */
+	uint32_t PINMMR[IOMM_PINMMR_COUNT]; /* 0x0110 */
+};
+
+#define IOMM_REGS ((volatile struct hercules_iomm_regs *)DT_REG_ADDR(IOMM_NODE))
+
+/*
+ * Build-time PINMMR images: for each register, the fields set by a pin state
+ * of any enabled device (one bit per field) and their values. The whole pin
+ * map of a state is then written with one access per touched register
+ * instead of a read-modify-write per field.
+ */
+#define IOMM_PIN_FIELDS(pin) BIT(TI_HERCULES_PINMUX_FIELD(pin))
+#define IOMM_PIN_VALUE(pin)  (TI_HERCULES_PINMUX_VAL(pin) << TI_HERCULES_PINMUX_SHIFT(pin))
+
+#define IOMM_PIN_BITS(node_id, prop, idx, reg, bits)                                               \
+	((TI_HERCULES_PINMUX_REG(DT_PROP_BY_IDX(node_id, prop, idx)) == (reg))                     \
+		 ? bits(DT_PROP_BY_IDX(node_id, prop, idx))                                        \
+		 : 0U) |
+
+#define IOMM_GROUP_BITS(node_id, prop, idx, reg, bits)                                             \
+	DT_FOREACH_PROP_ELEM_VARGS(DT_PHANDLE_BY_IDX(node_id, prop, idx), pinmux, IOMM_PIN_BITS,   \
+				   reg, bits)
+
+#define IOMM_NODE_BITS(node_id, state, reg, bits)                                                  \
+	IF_ENABLED(DT_PINCTRL_HAS_NAME(node_id, state),                                            \
+		   (DT_FOREACH_PROP_ELEM_SEP_VARGS(                                                \
+			   node_id, UTIL_CAT(pinctrl_, DT_PINCTRL_NAME_TO_IDX(node_id, state)),    \
+			   IOMM_GROUP_BITS, (), reg, bits)))
+
+#define IOMM_IMAGE_WORD(reg, state, bits)                                                          \
+	(DT_FOREACH_STATUS_OKAY_NODE_VARGS(IOMM_NODE_BITS, state, reg, bits) 0U)
+
+#define IOMM_IMAGE(state)                                                                          \
+	{                                                                                          \
+		.fields = {LISTIFY(IOMM_PINMMR_COUNT, IOMM_IMAGE_WORD, (,), state,                 \
+				   IOMM_PIN_FIELDS)},                                              \
+		.values = {LISTIFY(IOMM_PINMMR_COUNT, IOMM_IMAGE_WORD, (,), state,                 \
+				   IOMM_PIN_VALUE)},                                               \
+	}
+
+/*
+ * The images OR the fields of every device together, so two devices setting
+ * the same field to different values would silently merge into a third
+ * function. Every pin has to find its own value in the image word of its
+ * register, which is an integer constant expression. The pins are walked with
+ * other devicetree iterators than the image words, as an iterator does not
+ * expand inside itself, so the state is pasted into the macro names.
+ */
+#define IOMM_IMAGE_FIELD(pin, state)                                                               \
+	((IOMM_IMAGE_WORD(TI_HERCULES_PINMUX_REG(pin), state, IOMM_PIN_VALUE) >>                   \
+	  TI_HERCULES_PINMUX_SHIFT(pin)) &                                                         \
+	 0xFFU)
+
+#define IOMM_PIN_ASSERT(group, pin, state)                                                         \
+	BUILD_ASSERT(TI_HERCULES_PINMUX_REG(pin) < IOMM_PINMMR_COUNT,                              \
+		     DT_NODE_PATH(group) ": PINMMR register does not exist");                      \
+	BUILD_ASSERT(IOMM_IMAGE_FIELD(pin, state) == TI_HERCULES_PINMUX_VAL(pin),                  \
+		     DT_NODE_PATH(group) ": PINMMR field set to another value in the " #state      \
+		     " state of a different device");
+
+#define IOMM_PIN_CHECK(node_id, prop, idx, state)                                                  \
+	IOMM_PIN_ASSERT(node_id, DT_PROP_BY_IDX(node_id, prop, idx), state)
+
+#define IOMM_GROUP_CHECK(node_id, prop, idx, state)                                                \
+	DT_FOREACH_PROP_ELEM_SEP(DT_PHANDLE_BY_IDX(node_id, prop, idx), pinmux,                    \
+				 IOMM_PIN_CHECK_##state, ())
+
+#define IOMM_NODE_CHECK(node_id, state)                                                            \
+	IF_ENABLED(DT_PINCTRL_HAS_NAME(node_id, state),                                            \
+		   (DT_FOREACH_PROP_ELEM(                                                          \
+			   node_id, UTIL_CAT(pinctrl_, DT_PINCTRL_NAME_TO_IDX(node_id, state)),    \
+			   IOMM_GROUP_CHECK_##state)))
+
+#define IOMM_PIN_CHECK_default(node_id, prop, idx)   IOMM_PIN_CHECK(node_id, prop, idx, default)
+#define IOMM_GROUP_CHECK_default(node_id, prop, idx) IOMM_GROUP_CHECK(node_id, prop, idx, default)
+#define IOMM_NODE_CHECK_default(node_id)             IOMM_NODE_CHECK(node_id, default)
+#define IOMM_PIN_CHECK_sleep(node_id, prop, idx)     IOMM_PIN_CHECK(node_id, prop, idx, sleep)
+#define IOMM_GROUP_CHECK_sleep(node_id, prop, idx)   IOMM_GROUP_CHECK(node_id, prop, idx, sleep)
+#define IOMM_NODE_CHECK_sleep(node_id)               IOMM_NODE_CHECK(node_id, sleep)
+
+#define IOMM_IMAGE_CHECK(state) DT_FOREACH_STATUS_OKAY_NODE(IOMM_NODE_CHECK_##state)
+
+struct iomm_image {
+	uint8_t fields[IOMM_PINMMR_COUNT];
+	uint32_t values[IOMM_PINMMR_COUNT];
+};
+
+IOMM_IMAGE_CHECK(default)
+#ifdef CONFIG_PM
+IOMM_IMAGE_CHECK(sleep)
+#endif
+
+static const struct iomm_image iomm_images[] = {
+	[TI_HERCULES_PINCTRL_IMAGE_DEFAULT] = IOMM_IMAGE(default),
+#ifdef CONFIG_PM
+	[TI_HERCULES_PINCTRL_IMAGE_SLEEP] = IOMM_IMAGE(sleep),
+#endif
+};
+
+static struct k_spinlock iomm_lock;
+
+static uint32_t iomm_field_mask(uint32_t fields)
+{
+	uint32_t mask = 0U;
+
+	for (uint32_t field = 0U; field < 4U; field++) {
+		if ((fields & BIT(field)) != 0U) {
+			mask |= 0xFFU << (field * 8U);
+		}
+	}
+	return mask;
+}
+
+static void iomm_write(volatile struct hercules_iomm_regs *regs, uint32_t reg, uint32_t mask,
+		       uint32_t value)
+{
+	if (mask == UINT32_MAX) {
+		regs->PINMMR[reg] = value;
+	} else {
+		regs->PINMMR[reg] = (regs->PINMMR[reg] & ~mask) | value;
+	}
+}
+
+/* PINMMR registers only accept writes between the kick unlock and lock */
+static k_spinlock_key_t iomm_unlock(volatile struct hercules_iomm_regs *regs)
+{
+	k_spinlock_key_t key = k_spin_lock(&iomm_lock);
+
+	regs->KICK[0] = IOMM_KICK0_UNLOCK;
+	regs->KICK[1] = IOMM_KICK1_UNLOCK;
+	return key;
+}
+
+static void iomm_lock_regs(volatile struct hercules_iomm_regs *regs, k_spinlock_key_t key)
+{
+	regs->KICK[0] = 0U;
+	regs->KICK[1] = 0U;
+	k_spin_unlock(&iomm_lock, key);
+}
+
+void ti_hercules_pinctrl_apply_image(enum ti_hercules_pinctrl_image image)
+{
+	volatile struct hercules_iomm_regs *regs = IOMM_REGS;
+	const struct iomm_image *img;
+	k_spinlock_key_t key;
+
+	if ((size_t)image >= ARRAY_SIZE(iomm_images)) {
+		return;
+	}
+	img = &iomm_images[image];
+
+	key = iomm_unlock(regs);
+	for (uint32_t reg = 0U; reg < IOMM_PINMMR_COUNT; reg++) {
+		if (img->fields[reg] != 0U) {
+			iomm_write(regs, reg, iomm_field_mask(img->fields[reg]), img->values[reg]);
+		}
+	}
+	iomm_lock_regs(regs, key);
+}
+
+void ti_hercules_pinctrl_update(uint32_t pinmmr, uint32_t mask, uint32_t value)
+{
+	volatile struct hercules_iomm_regs *regs = IOMM_REGS;
+	k_spinlock_key_t key;
+
+	if (pinmmr >= IOMM_PINMMR_COUNT) {
+		return;
+	}
+
+	key = iomm_unlock(regs);
+	regs->PINMMR[pinmmr] = (regs->PINMMR[pinmmr] & ~mask) | (value & mask);
+	iomm_lock_regs(regs, key);
+}
+
+int pinctrl_configure_pins(const pinctrl_soc_pin_t *pins, uint8_t pin_cnt, uintptr_t reg)
+{
+	volatile struct hercules_iomm_regs *regs = IOMM_REGS;
+	k_spinlock_key_t key;
+	uint8_t i = 0U;
+
+	ARG_UNUSED(reg);
+
+	for (uint8_t j = 0U; j < pin_cnt; j++) {
+		if (TI_HERCULES_PINMUX_REG(pins[j]) >= IOMM_PINMMR_COUNT) {
+			return -EINVAL;
+		}
+	}
+
+	key = iomm_unlock(regs);
+	while (i < pin_cnt) {
+		uint32_t pinmmr = TI_HERCULES_PINMUX_REG(pins[i]);
+		uint32_t mask = 0U;
+		uint32_t value = 0U;
+
+		/* Fold adjacent fields of the same register into one access */
+		for (; i < pin_cnt && TI_HERCULES_PINMUX_REG(pins[i]) == pinmmr; i++) {
+			uint32_t field = 0xFFU << TI_HERCULES_PINMUX_SHIFT(pins[i]);
+
+			mask |= field;
+			value = (value & ~field) | (TI_HERCULES_PINMUX_VAL(pins[i])
+						    << TI_HERCULES_PINMUX_SHIFT(pins[i]));
+		}
+		iomm_write(regs, pinmmr, mask, value);
+	}
+	iomm_lock_regs(regs, key);
+
+	return 0;
+}
+
+static int pinctrl_ti_hercules_init(void)
+{
+	ti_hercules_pinctrl_apply_image(TI_HERCULES_PINCTRL_IMAGE_DEFAULT);
+	return 0;
+}
+
+/* Ahead of every driver, which then need not apply their default state */
+SYS_INIT(pinctrl_ti_hercules_init, PRE_KERNEL_1, 0);
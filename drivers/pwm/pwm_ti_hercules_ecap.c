@@ -0,0 +1,245 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The eCAP runs in capture mode with the counter reset on the leading edge:
+ * CAP1 holds the period that edge ended and CAP2 the pulse that follows, so
+ * one interrupt per input period reports both without any arithmetic.
+ */
+
+#define DT_DRV_COMPAT ti_hercules_ecap
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/pwm.h>
+#include <zephyr/irq.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(pwm_ti_hercules_ecap, CONFIG_PWM_LOG_LEVEL);
+
+#define ECAP_ECCTL1_FREE    (2U << 14)
+#define ECAP_ECCTL1_CAPLDEN BIT(8)
+#define ECAP_ECCTL1_CAP2POL BIT(2)
+#define ECAP_ECCTL1_CTRRST1 BIT(1)
+#define ECAP_ECCTL1_CAP1POL BIT(0)
+
+#define ECAP_ECCTL2_SYNCO_DIS  (3U << 6)
+#define ECAP_ECCTL2_TSCTRSTOP  BIT(4)
+#define ECAP_ECCTL2_REARM      BIT(3)
+#define ECAP_ECCTL2_WRAP_CEVT2 (1U << 1)
+
+#define ECAP_INT     BIT(0)
+#define ECAP_CEVT2   BIT(2)
+#define ECAP_CTROVF  BIT(5)
+#define ECAP_INT_ALL GENMASK(7, 0)
+
+#define DEV_CFG(dev)  ((const struct pwm_ti_hercules_ecap_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct pwm_ti_hercules_ecap_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_ecap_regs *)DEV_CFG(dev)->base)
+
+/* 16 bit registers in little-endian order, each halfword pair swapped against the TMS570 */
+struct hercules_ecap_regs {
+	uint32_t TSCTR;    /* 0x00 */
+	uint32_t CTRPHS;   /* 0x04 */
+	uint32_t CAP[4];   /* 0x08 */
+	uint32_t rsvd1[4]; /* 0x18 */
+	uint16_t ECCTL2;   /* 0x28 */
+	uint16_t ECCTL1;   /* 0x2A */
+	uint16_t ECFLG;    /* 0x2C */
+	uint16_t ECEINT;   /* 0x2E */
+	uint16_t ECFRC;    /* 0x30 */
+	uint16_t ECCLR;    /* 0x32 */
+};
+
+struct pwm_ti_hercules_ecap_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct pwm_ti_hercules_ecap_data {
+	uint32_t vclk3;
+	pwm_capture_callback_handler_t cb;
+	void *user_data;
+	bool continuous;
+	/* The first CAP1 after enabling counts from the start, not an edge */
+	bool first;
+};
+
+static int pwm_ti_hercules_ecap_set_cycles(const struct device *dev, uint32_t channel,
+					   uint32_t period_cycles, uint32_t pulse_cycles,
+					   pwm_flags_t flags)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(channel);
+	ARG_UNUSED(period_cycles);
+	ARG_UNUSED(pulse_cycles);
+	ARG_UNUSED(flags);
+
+	return -ENOTSUP;
+}
+
+static int pwm_ti_hercules_ecap_get_cycles_per_sec(const struct device *dev, uint32_t channel,
+						   uint64_t *cycles)
+{
+	ARG_UNUSED(channel);
+
+	*cycles = DEV_DATA(dev)->vclk3;
+	return 0;
+}
+
+#ifdef CONFIG_PWM_CAPTURE
+static int pwm_ti_hercules_ecap_configure_capture(const struct device *dev, uint32_t channel,
+						  pwm_flags_t flags,
+						  pwm_capture_callback_handler_t cb,
+						  void *user_data)
+{
+	volatile struct hercules_ecap_regs *regs = DEV_REGS(dev);
+	struct pwm_ti_hercules_ecap_data *data = DEV_DATA(dev);
+	uint16_t ctl = ECAP_ECCTL1_FREE | ECAP_ECCTL1_CAPLDEN | ECAP_ECCTL1_CTRRST1;
+
+	if (channel != 0U) {
+		return -EINVAL;
+	}
+	if ((regs->ECCTL2 & ECAP_ECCTL2_TSCTRSTOP) != 0U) {
+		return -EBUSY;
+	}
+
+	/* Leading edge on event 1, trailing edge on event 2 */
+	ctl |= (flags & PWM_POLARITY_INVERTED) ? ECAP_ECCTL1_CAP1POL : ECAP_ECCTL1_CAP2POL;
+	regs->ECCTL1 = ctl;
+
+	data->cb = cb;
+	data->user_data = user_data;
+	data->continuous = (flags & PWM_CAPTURE_MODE_CONTINUOUS) != 0U;
+	return 0;
+}
+
+static int pwm_ti_hercules_ecap_enable_capture(const struct device *dev, uint32_t channel)
+{
+	volatile struct hercules_ecap_regs *regs = DEV_REGS(dev);
+	struct pwm_ti_hercules_ecap_data *data = DEV_DATA(dev);
+
+	if (channel != 0U || data->cb == NULL) {
+		return -EINVAL;
+	}
+	if ((regs->ECCTL2 & ECAP_ECCTL2_TSCTRSTOP) != 0U) {
+		return -EBUSY;
+	}
+
+	data->first = true;
+	regs->TSCTR = 0U;
+	regs->ECCLR = ECAP_INT_ALL;
+	regs->ECEINT = ECAP_CEVT2 | ECAP_CTROVF;
+	regs->ECCTL2 = ECAP_ECCTL2_SYNCO_DIS | ECAP_ECCTL2_WRAP_CEVT2 | ECAP_ECCTL2_REARM |
+		       ECAP_ECCTL2_TSCTRSTOP;
+	return 0;
+}
+
+static int pwm_ti_hercules_ecap_disable_capture(const struct device *dev, uint32_t channel)
+{
+	volatile struct hercules_ecap_regs *regs = DEV_REGS(dev);
+
+	if (channel != 0U) {
+		return -EINVAL;
+	}
+	regs->ECEINT = 0U;
+	regs->ECCTL2 = ECAP_ECCTL2_SYNCO_DIS | ECAP_ECCTL2_WRAP_CEVT2;
+	return 0;
+}
+#endif /* CONFIG_PWM_CAPTURE */
+
+static void pwm_ti_hercules_ecap_isr(const struct device *dev)
+{
+	volatile struct hercules_ecap_regs *regs = DEV_REGS(dev);
+	struct pwm_ti_hercules_ecap_data *data = DEV_DATA(dev);
+	uint16_t flags = regs->ECFLG;
+	uint32_t period = regs->CAP[0];
+	uint32_t pulse = regs->CAP[1];
+	int status = 0;
+
+	regs->ECCLR = flags | ECAP_INT;
+
+	if ((flags & ECAP_CTROVF) != 0U) {
+		/* No edge for 2^32 VCLK3 cycles */
+		status = -ERANGE;
+	} else if ((flags & ECAP_CEVT2) == 0U) {
+		return;
+	} else if (data->first) {
+		data->first = false;
+		return;
+	}
+
+	if (!data->continuous) {
+		regs->ECEINT = 0U;
+		regs->ECCTL2 = ECAP_ECCTL2_SYNCO_DIS | ECAP_ECCTL2_WRAP_CEVT2;
+	}
+	if (data->cb != NULL) {
+		data->cb(dev, 0, period, pulse, status, data->user_data);
+	}
+}
+
+static int pwm_ti_hercules_ecap_init(const struct device *dev)
+{
+	const struct pwm_ti_hercules_ecap_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_ecap_regs *regs = DEV_REGS(dev);
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk,
+				     &DEV_DATA(dev)->vclk3);
+	if (ret != 0) {
+		LOG_ERR("Unable to get VCLK3 rate");
+		return ret;
+	}
+
+	regs->ECEINT = 0U;
+	regs->ECCLR = ECAP_INT_ALL;
+	regs->ECCTL2 = ECAP_ECCTL2_SYNCO_DIS | ECAP_ECCTL2_WRAP_CEVT2;
+	regs->ECCTL1 = ECAP_ECCTL1_FREE | ECAP_ECCTL1_CAPLDEN | ECAP_ECCTL1_CTRRST1 |
+		       ECAP_ECCTL1_CAP2POL;
+
+	cfg->irq_config_func(dev);
+	return 0;
+}
+
+static DEVICE_API(pwm, pwm_ti_hercules_ecap_api) = {
+	.set_cycles = pwm_ti_hercules_ecap_set_cycles,
+	.get_cycles_per_sec = pwm_ti_hercules_ecap_get_cycles_per_sec,
+#ifdef CONFIG_PWM_CAPTURE
+	.configure_capture = pwm_ti_hercules_ecap_configure_capture,
+	.enable_capture = pwm_ti_hercules_ecap_enable_capture,
+	.disable_capture = pwm_ti_hercules_ecap_disable_capture,
+#endif
+};
+
+#define PWM_TI_HERCULES_ECAP_INIT(n)                                                               \
+	static void pwm_ti_hercules_ecap_irq_config_##n(const struct device *dev)                  \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority),                         \
+			    pwm_ti_hercules_ecap_isr, DEVICE_DT_INST_GET(n),                       \
+			    DT_INST_IRQ(n, type));                                                 \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+	static const struct pwm_ti_hercules_ecap_config pwm_ti_hercules_ecap_config_##n = {       \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.irq_config_func = pwm_ti_hercules_ecap_irq_config_##n,                            \
+	};                                                                                         \
+	static struct pwm_ti_hercules_ecap_data pwm_ti_hercules_ecap_data_##n;                     \
+	DEVICE_DT_INST_DEFINE(n, pwm_ti_hercules_ecap_init, NULL, &pwm_ti_hercules_ecap_data_##n,  \
+			      &pwm_ti_hercules_ecap_config_##n, POST_KERNEL,                       \
+			      CONFIG_PWM_INIT_PRIORITY, &pwm_ti_hercules_ecap_api);
+
+DT_INST_FOREACH_STATUS_OKAY(PWM_TI_HERCULES_ECAP_INIT)
@@ -0,0 +1,511 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Period and compare values only ever go to the shadow registers, loaded
+ * into the active ones when the counter reaches zero. The time bases of all
+ * modules are started together through TBCLKSYNC once every module is set
+ * up, so synchronized modules keep their phase relationship from the first
+ * period on.
+ */
+
+#define DT_DRV_COMPAT ti_hercules_epwm
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/pinctrl/pinctrl_ti_hercules.h>
+#include <zephyr/drivers/pwm.h>
+#include <zephyr/drivers/pwm/ti_hercules_epwm.h>
+#include <zephyr/irq.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(pwm_ti_hercules_epwm, CONFIG_PWM_LOG_LEVEL);
+
+#define EPWM_CHANNELS 2U
+
+/* Time base clock enable of all ePWM modules */
+#define EPWM_TBCLKSYNC_PINMMR 166U
+#define EPWM_TBCLKSYNC        BIT(1)
+
+#define EPWM_TBCTL_FREE         (2U << 14)
+#define EPWM_TBCTL_CLKDIV(n)    ((n) << 10)
+#define EPWM_TBCTL_SYNCOSEL(n)  ((n) << 4)
+#define EPWM_TBCTL_PHSEN        BIT(2)
+#define EPWM_TBCTL_CTRMODE_MASK 0x3U
+#define EPWM_TBCTL_CTRMODE_UP   0x0U
+#define EPWM_TBCTL_CTRMODE_UPDN 0x2U
+#define EPWM_TBCTL_CTRMODE_STOP 0x3U
+
+#define EPWM_TBSTS_CTRDIR BIT(0)
+
+#define EPWM_TBPRD_MAX 0xFFFFU
+
+/* Action qualifier events: counter zero, CMPA and CMPB counting up or down */
+#define EPWM_AQ_CLEAR  1U
+#define EPWM_AQ_SET    2U
+#define EPWM_AQ_ZRO(a) ((a) << 0)
+#define EPWM_AQ_CAU(a) ((a) << 4)
+#define EPWM_AQ_CAD(a) ((a) << 6)
+#define EPWM_AQ_CBU(a) ((a) << 8)
+#define EPWM_AQ_CBD(a) ((a) << 10)
+
+#define EPWM_AQSFRC_RLDCSF_IMMEDIATE (3U << 6)
+#define EPWM_AQCSFRC_LOW(ch)         (1U << (2U * (ch)))
+#define EPWM_AQCSFRC_MASK(ch)        (3U << (2U * (ch)))
+
+/* Both edges delayed, EPWMxB inverted: active high complementary */
+#define EPWM_DBCTL_AHC (0x2U << 2 | 0x3U)
+#define EPWM_DB_MAX    0x3FFU
+
+#define EPWM_TZSEL_CBC(n)  BIT((n) - 1U)
+#define EPWM_TZSEL_OSHT(n) BIT((n) + 7U)
+#define EPWM_TZCTL(state)  ((state) << 2 | (state))
+
+#define EPWM_TZ_INT BIT(0)
+#define EPWM_TZ_CBC BIT(1)
+#define EPWM_TZ_OST BIT(2)
+
+#define EPWM_ETSEL_INTEN    BIT(3)
+#define EPWM_ETSEL_INT_ZERO 0x1U
+#define EPWM_ETPS_INTPRD_1  0x1U
+#define EPWM_ET_INT         BIT(0)
+
+/* Time base clocks a compare register write may take, with margin */
+#define EPWM_WRITE_GUARD 16U
+
+#define DEV_CFG(dev)  ((const struct pwm_ti_hercules_epwm_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct pwm_ti_hercules_epwm_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_epwm_regs *)DEV_CFG(dev)->base)
+
+/*
+ * 16 bit registers in the little-endian order of the RM57Lx: the two
+ * halfwords of each word are swapped against the big-endian TMS570 layout.
+ */
+struct hercules_epwm_regs {
+	uint16_t TBSTS;   /* 0x00 */
+	uint16_t TBCTL;   /* 0x02 */
+	uint16_t TBPHS;   /* 0x04 */
+	uint16_t TBPHSHR; /* 0x06 */
+	uint16_t TBPRD;   /* 0x08 */
+	uint16_t TBCTR;   /* 0x0A */
+	uint16_t CMPCTL;  /* 0x0C */
+	uint16_t rsvd1;   /* 0x0E */
+	uint16_t CMPA;    /* 0x10 */
+	uint16_t CMPAHR;  /* 0x12 */
+	uint16_t AQCTLA;  /* 0x14 */
+	uint16_t CMPB;    /* 0x16 */
+	uint16_t AQSFRC;  /* 0x18 */
+	uint16_t AQCTLB;  /* 0x1A */
+	uint16_t DBCTL;   /* 0x1C */
+	uint16_t AQCSFRC; /* 0x1E */
+	uint16_t DBFED;   /* 0x20 */
+	uint16_t DBRED;   /* 0x22 */
+	uint16_t TZDCSEL; /* 0x24 */
+	uint16_t TZSEL;   /* 0x26 */
+	uint16_t TZEINT;  /* 0x28 */
+	uint16_t TZCTL;   /* 0x2A */
+	uint16_t TZCLR;   /* 0x2C */
+	uint16_t TZFLG;   /* 0x2E */
+	uint16_t ETSEL;   /* 0x30 */
+	uint16_t TZFRC;   /* 0x32 */
+	uint16_t ETFLG;   /* 0x34 */
+	uint16_t ETPS;    /* 0x36 */
+	uint16_t ETFRC;   /* 0x38 */
+	uint16_t ETCLR;   /* 0x3A */
+	uint16_t PCCTL;   /* 0x3C */
+	uint16_t rsvd2;   /* 0x3E */
+};
+
+/* The A and B registers of a channel are not adjacent in the little-endian layout */
+#define EPWM_CMP(regs, ch)   (*((ch) == 0U ? &(regs)->CMPA : &(regs)->CMPB))
+#define EPWM_AQCTL(regs, ch) (*((ch) == 0U ? &(regs)->AQCTLA : &(regs)->AQCTLB))
+
+struct pwm_ti_hercules_epwm_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	uint8_t clkdiv;
+	bool up_down;
+	uint8_t sync_out;
+	bool phase_enable;
+	uint32_t phase_ns;
+	uint32_t dead_band_rising_ns;
+	uint32_t dead_band_falling_ns;
+	const uint8_t *trip_zones;
+	uint8_t trip_zone_count;
+	bool trip_one_shot;
+	uint8_t trip_state;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct pwm_ti_hercules_epwm_data {
+	uint32_t tbclk;
+	/* Period in time base clocks, 0 until set */
+	uint32_t period;
+	/* Configured channels and their polarity */
+	uint8_t active;
+	uint8_t inverted;
+	ti_hercules_epwm_callback_t period_cb;
+	void *period_user_data;
+	ti_hercules_epwm_callback_t trip_cb;
+	void *trip_user_data;
+};
+
+/* Shared by all modules, ti_hercules_epwm_set_pulses() writes several at once */
+static struct k_spinlock epwm_lock;
+/* Modules that went through init, successfully or not */
+static uint8_t epwm_init_attempts;
+
+/* Time base clocks until the next counter-zero shadow load */
+static uint32_t epwm_cycles_to_load(const struct device *dev)
+{
+	volatile struct hercules_epwm_regs *regs = DEV_REGS(dev);
+	uint32_t ctr = regs->TBCTR;
+	uint32_t prd = regs->TBPRD;
+
+	if (!DEV_CFG(dev)->up_down) {
+		return prd + 1U - MIN(ctr, prd);
+	}
+	return (regs->TBSTS & EPWM_TBSTS_CTRDIR) != 0U ? 2U * prd - MIN(ctr, prd) : ctr;
+}
+
+/* Whether @p writes register writes all land before the next counter-zero load event */
+static bool epwm_in_load_window(const struct device *dev, size_t writes)
+{
+	uint32_t guard = EPWM_WRITE_GUARD * (uint32_t)(writes + 1U);
+
+	if (DEV_DATA(dev)->period == 0U) {
+		return true;
+	}
+	guard = MIN(guard, DEV_DATA(dev)->period / 2U);
+
+	return epwm_cycles_to_load(dev) >= guard;
+}
+
+/* Called with the lock held */
+static void epwm_wait_load_window(const struct device *dev, size_t writes)
+{
+	while (!epwm_in_load_window(dev, writes)) {
+	}
+}
+
+/* Called with the lock held: wait until every module of the group is in its window */
+static void epwm_wait_group_load_window(const struct ti_hercules_epwm_pulse *pulses,
+					size_t count)
+{
+	bool ready;
+
+	do {
+		ready = true;
+		for (size_t i = 0; i < count && ready; i++) {
+			ready = epwm_in_load_window(pulses[i].dev, count);
+		}
+	} while (!ready);
+}
+
+static uint16_t epwm_aqctl(const struct device *dev, uint32_t channel, bool inverted)
+{
+	uint16_t on = inverted ? EPWM_AQ_CLEAR : EPWM_AQ_SET;
+	uint16_t off = inverted ? EPWM_AQ_SET : EPWM_AQ_CLEAR;
+
+	if (DEV_CFG(dev)->up_down) {
+		/* Centered on counter zero */
+		return channel == 0U ? EPWM_AQ_CAU(off) | EPWM_AQ_CAD(on)
+				     : EPWM_AQ_CBU(off) | EPWM_AQ_CBD(on);
+	}
+	return channel == 0U ? EPWM_AQ_ZRO(on) | EPWM_AQ_CAU(off)
+			     : EPWM_AQ_ZRO(on) | EPWM_AQ_CBU(off);
+}
+
+/* Called with the lock held */
+static void epwm_write_compare(const struct device *dev, uint32_t channel, uint32_t pulse,
+			       pwm_flags_t flags)
+{
+	volatile struct hercules_epwm_regs *regs = DEV_REGS(dev);
+	struct pwm_ti_hercules_epwm_data *data = DEV_DATA(dev);
+	bool inverted = (flags & PWM_POLARITY_INVERTED) != 0U;
+
+	/* A compare value past the period never matches: 100% duty cycle */
+	EPWM_CMP(regs, channel) = DEV_CFG(dev)->up_down ? pulse / 2U : pulse;
+
+	if ((data->active & BIT(channel)) == 0U ||
+	    ((data->inverted & BIT(channel)) != 0U) != inverted) {
+		EPWM_AQCTL(regs, channel) = epwm_aqctl(dev, channel, inverted);
+		WRITE_BIT(data->inverted, channel, inverted);
+		if ((data->active & BIT(channel)) == 0U) {
+			data->active |= BIT(channel);
+			regs->AQCSFRC &= ~EPWM_AQCSFRC_MASK(channel);
+		}
+	}
+}
+
+static int pwm_ti_hercules_epwm_set_cycles(const struct device *dev, uint32_t channel,
+					   uint32_t period_cycles, uint32_t pulse_cycles,
+					   pwm_flags_t flags)
+{
+	volatile struct hercules_epwm_regs *regs = DEV_REGS(dev);
+	struct pwm_ti_hercules_epwm_data *data = DEV_DATA(dev);
+	uint32_t prd;
+	k_spinlock_key_t key;
+
+	if (channel >= EPWM_CHANNELS) {
+		return -EINVAL;
+	}
+
+	/* Up-down counting takes two time base clocks per period count */
+	prd = DEV_CFG(dev)->up_down ? period_cycles / 2U : period_cycles - 1U;
+	if (period_cycles < 2U || prd > EPWM_TBPRD_MAX || pulse_cycles > period_cycles) {
+		return -ENOTSUP;
+	}
+
+	key = k_spin_lock(&epwm_lock);
+	epwm_wait_load_window(dev, 2U);
+	regs->TBPRD = prd;
+	epwm_write_compare(dev, channel, pulse_cycles, flags);
+	data->period = period_cycles;
+	k_spin_unlock(&epwm_lock, key);
+
+	return 0;
+}
+
+static int pwm_ti_hercules_epwm_get_cycles_per_sec(const struct device *dev, uint32_t channel,
+						   uint64_t *cycles)
+{
+	ARG_UNUSED(channel);
+
+	*cycles = DEV_DATA(dev)->tbclk;
+	return 0;
+}
+
+int ti_hercules_epwm_set_pulses(const struct ti_hercules_epwm_pulse *pulses, size_t count)
+{
+	k_spinlock_key_t key;
+
+	for (size_t i = 0; i < count; i++) {
+		const struct pwm_ti_hercules_epwm_config *cfg = DEV_CFG(pulses[i].dev);
+
+		if (pulses[i].channel >= EPWM_CHANNELS ||
+		    pulses[i].pulse_cycles > DEV_DATA(pulses[i].dev)->period) {
+			return -EINVAL;
+		}
+		/* Only modules sharing their counter-zero event can be updated together */
+		if ((cfg->phase_enable && cfg->phase_ns != 0U) ||
+		    cfg->up_down != DEV_CFG(pulses[0].dev)->up_down ||
+		    DEV_DATA(pulses[i].dev)->period != DEV_DATA(pulses[0].dev)->period) {
+			return -EINVAL;
+		}
+	}
+	if (count == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&epwm_lock);
+	epwm_wait_group_load_window(pulses, count);
+	for (size_t i = 0; i < count; i++) {
+		epwm_write_compare(pulses[i].dev, pulses[i].channel, pulses[i].pulse_cycles,
+				   pulses[i].flags);
+	}
+	k_spin_unlock(&epwm_lock, key);
+
+	return 0;
+}
+
+int ti_hercules_epwm_set_period_callback(const struct device *dev, ti_hercules_epwm_callback_t cb,
+					 void *user_data)
+{
+	volatile struct hercules_epwm_regs *regs = DEV_REGS(dev);
+	struct pwm_ti_hercules_epwm_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key = k_spin_lock(&epwm_lock);
+
+	data->period_cb = cb;
+	data->period_user_data = user_data;
+	regs->ETCLR = EPWM_ET_INT;
+	regs->ETSEL = cb != NULL ? EPWM_ETSEL_INTEN | EPWM_ETSEL_INT_ZERO : 0U;
+	k_spin_unlock(&epwm_lock, key);
+
+	return 0;
+}
+
+int ti_hercules_epwm_set_trip_callback(const struct device *dev, ti_hercules_epwm_callback_t cb,
+				       void *user_data)
+{
+	struct pwm_ti_hercules_epwm_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key = k_spin_lock(&epwm_lock);
+
+	data->trip_cb = cb;
+	data->trip_user_data = user_data;
+	k_spin_unlock(&epwm_lock, key);
+
+	return 0;
+}
+
+int ti_hercules_epwm_trip_clear(const struct device *dev)
+{
+	DEV_REGS(dev)->TZCLR = EPWM_TZ_OST | EPWM_TZ_CBC | EPWM_TZ_INT;
+	return 0;
+}
+
+static void pwm_ti_hercules_epwm_isr(const struct device *dev)
+{
+	struct pwm_ti_hercules_epwm_data *data = DEV_DATA(dev);
+
+	if (data->period_cb != NULL) {
+		data->period_cb(dev, data->period_user_data);
+	}
+	DEV_REGS(dev)->ETCLR = EPWM_ET_INT;
+}
+
+static void pwm_ti_hercules_epwm_tz_isr(const struct device *dev)
+{
+	volatile struct hercules_epwm_regs *regs = DEV_REGS(dev);
+	struct pwm_ti_hercules_epwm_data *data = DEV_DATA(dev);
+	uint16_t flags = regs->TZFLG;
+
+	LOG_WRN("%s: %s trip", dev->name, (flags & EPWM_TZ_OST) != 0U ? "one-shot" : "cycle");
+	if (data->trip_cb != NULL) {
+		data->trip_cb(dev, data->trip_user_data);
+	}
+	/* A one-shot trip holds the outputs until ti_hercules_epwm_trip_clear() */
+	regs->TZCLR = EPWM_TZ_CBC | EPWM_TZ_INT;
+}
+
+static uint16_t epwm_ns_to_cycles(uint32_t tbclk, uint32_t ns)
+{
+	return (uint16_t)MIN((uint64_t)ns * tbclk / NSEC_PER_SEC, EPWM_TBPRD_MAX);
+}
+
+static int epwm_configure(const struct device *dev)
+{
+	const struct pwm_ti_hercules_epwm_config *cfg = DEV_CFG(dev);
+	struct pwm_ti_hercules_epwm_data *data = DEV_DATA(dev);
+	volatile struct hercules_epwm_regs *regs = DEV_REGS(dev);
+	uint16_t tzsel = 0U;
+	uint32_t vclk3;
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &vclk3);
+	if (ret != 0) {
+		LOG_ERR("Unable to get VCLK3 rate");
+		return ret;
+	}
+	data->tbclk = vclk3 >> cfg->clkdiv;
+
+	regs->TBCTL = EPWM_TBCTL_FREE | EPWM_TBCTL_CLKDIV(cfg->clkdiv) |
+		      EPWM_TBCTL_SYNCOSEL(cfg->sync_out) |
+		      (cfg->phase_enable ? EPWM_TBCTL_PHSEN : 0U) | EPWM_TBCTL_CTRMODE_STOP;
+	regs->TBPHS = epwm_ns_to_cycles(data->tbclk, cfg->phase_ns);
+	regs->TBCTR = 0U;
+	regs->TBPRD = 0U;
+	/* Shadowed period and compares, loaded at counter zero */
+	regs->CMPCTL = 0U;
+	regs->CMPA = 0U;
+	regs->CMPB = 0U;
+
+	/* Outputs are held low until their first pwm_set() */
+	regs->AQCTLA = 0U;
+	regs->AQCTLB = 0U;
+	regs->AQSFRC = EPWM_AQSFRC_RLDCSF_IMMEDIATE;
+	regs->AQCSFRC = EPWM_AQCSFRC_LOW(0U) | EPWM_AQCSFRC_LOW(1U);
+
+	if (cfg->dead_band_rising_ns != 0U || cfg->dead_band_falling_ns != 0U) {
+		regs->DBRED = MIN(epwm_ns_to_cycles(data->tbclk, cfg->dead_band_rising_ns),
+				  EPWM_DB_MAX);
+		regs->DBFED = MIN(epwm_ns_to_cycles(data->tbclk, cfg->dead_band_falling_ns),
+				  EPWM_DB_MAX);
+		regs->DBCTL = EPWM_DBCTL_AHC;
+	} else {
+		regs->DBCTL = 0U;
+	}
+
+	for (size_t i = 0; i < cfg->trip_zone_count; i++) {
+		tzsel |= cfg->trip_one_shot ? EPWM_TZSEL_OSHT(cfg->trip_zones[i])
+					    : EPWM_TZSEL_CBC(cfg->trip_zones[i]);
+	}
+	regs->TZCTL = EPWM_TZCTL(cfg->trip_state);
+	regs->TZSEL = tzsel;
+	regs->TZCLR = EPWM_TZ_OST | EPWM_TZ_CBC | EPWM_TZ_INT;
+	regs->TZEINT = tzsel == 0U ? 0U : cfg->trip_one_shot ? EPWM_TZ_OST : EPWM_TZ_CBC;
+
+	regs->ETSEL = 0U;
+	regs->ETPS = EPWM_ETPS_INTPRD_1;
+	regs->ETCLR = EPWM_ET_INT;
+
+	cfg->irq_config_func(dev);
+
+	regs->TBCTL = (regs->TBCTL & ~EPWM_TBCTL_CTRMODE_MASK) |
+		      (cfg->up_down ? EPWM_TBCTL_CTRMODE_UPDN : EPWM_TBCTL_CTRMODE_UP);
+
+	return 0;
+}
+
+static int pwm_ti_hercules_epwm_init(const struct device *dev)
+{
+	int ret;
+
+	/* Hold every time base until all modules are configured */
+	if (epwm_init_attempts == 0U) {
+		ti_hercules_pinctrl_update(EPWM_TBCLKSYNC_PINMMR, EPWM_TBCLKSYNC, 0U);
+	}
+
+	ret = epwm_configure(dev);
+
+	/* A module that failed must not keep the time bases of the others stopped */
+	if (++epwm_init_attempts == DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT)) {
+		ti_hercules_pinctrl_update(EPWM_TBCLKSYNC_PINMMR, EPWM_TBCLKSYNC, EPWM_TBCLKSYNC);
+	}
+
+	return ret;
+}
+
+static DEVICE_API(pwm, pwm_ti_hercules_epwm_api) = {
+	.set_cycles = pwm_ti_hercules_epwm_set_cycles,
+	.get_cycles_per_sec = pwm_ti_hercules_epwm_get_cycles_per_sec,
+};
+
+#define PWM_TI_HERCULES_EPWM_IRQ(n, name, isr)                                                     \
+	IRQ_CONNECT(DT_INST_IRQ_BY_NAME(n, name, irq), DT_INST_IRQ_BY_NAME(n, name, priority),     \
+		    isr, DEVICE_DT_INST_GET(n), DT_INST_IRQ_BY_NAME(n, name, type));               \
+	irq_enable(DT_INST_IRQ_BY_NAME(n, name, irq));
+
+#define PWM_TI_HERCULES_EPWM_INIT(n)                                                               \
+	static const uint8_t pwm_ti_hercules_epwm_tz_##n[] =                                       \
+		DT_INST_PROP_OR(n, trip_zones, {0});                                               \
+	static void pwm_ti_hercules_epwm_irq_config_##n(const struct device *dev)                  \
+	{                                                                                          \
+		PWM_TI_HERCULES_EPWM_IRQ(n, epwm, pwm_ti_hercules_epwm_isr)                        \
+		PWM_TI_HERCULES_EPWM_IRQ(n, tz, pwm_ti_hercules_epwm_tz_isr)                       \
+	}                                                                                          \
+	static const struct pwm_ti_hercules_epwm_config pwm_ti_hercules_epwm_config_##n = {       \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.clkdiv = LOG2(DT_INST_PROP(n, prescaler)),                                        \
+		.up_down = DT_INST_ENUM_IDX(n, counter_mode) == 1,                                 \
+		.sync_out = DT_INST_ENUM_IDX(n, sync_out),                                         \
+		.phase_enable = DT_INST_NODE_HAS_PROP(n, phase_offset_ns),                         \
+		.phase_ns = DT_INST_PROP_OR(n, phase_offset_ns, 0),                                \
+		.dead_band_rising_ns = DT_INST_PROP(n, dead_band_rising_ns),                       \
+		.dead_band_falling_ns = DT_INST_PROP(n, dead_band_falling_ns),                     \
+		.trip_zones = pwm_ti_hercules_epwm_tz_##n,                                         \
+		.trip_zone_count = DT_INST_PROP_LEN_OR(n, trip_zones, 0),                          \
+		.trip_one_shot = DT_INST_PROP(n, trip_one_shot),                                   \
+		.trip_state = DT_INST_ENUM_IDX(n, trip_state),                                     \
+		.irq_config_func = pwm_ti_hercules_epwm_irq_config_##n,                            \
+	};                                                                                         \
+	static struct pwm_ti_hercules_epwm_data pwm_ti_hercules_epwm_data_##n;                     \
+	DEVICE_DT_INST_DEFINE(n, pwm_ti_hercules_epwm_init, NULL, &pwm_ti_hercules_epwm_data_##n,  \
+			      &pwm_ti_hercules_epwm_config_##n, POST_KERNEL,                       \
+			      CONFIG_PWM_INIT_PRIORITY, &pwm_ti_hercules_epwm_api);
+
+DT_INST_FOREACH_STATUS_OKAY(PWM_TI_HERCULES_EPWM_INIT)
@@ -0,0 +1,546 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The N2HET runs a program generated at build time from the devicetree node
+ * (see scripts/gen_n2het_program.py). PWM updates are only ever written to
+ * the reload instructions, which the N2HET copies into the running PWCNT/DJZ
+ * pair once the current period ends. Capture timestamps are moved to RAM by
+ * the HTU without CPU involvement.
+ */
+
+#define DT_DRV_COMPAT ti_hercules_n2het
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/pwm.h>
+#include <zephyr/drivers/pwm/ti_hercules_n2het.h>
+#include <zephyr/irq.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <stddef.h>
+
+#include <n2het_program.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(pwm_ti_hercules_n2het, CONFIG_PWM_LOG_LEVEL);
+
+#define N2HET_PINS      32U
+#define N2HET_CHAN_NONE 0xFFU
+#define N2HET_HR_SHIFT  7U
+#define N2HET_HR_MASK   BIT_MASK(N2HET_HR_SHIFT)
+#define N2HET_LR_MAX    BIT_MASK(25)
+
+#define HET_GCR_TO          BIT(0)
+#define HET_GCR_CMS         BIT(16)
+#define HET_GCR_HET_PIN_ENA BIT(24)
+
+#define HET_PFR_LRPFC_SHIFT 8U
+
+/* Control field pin action, bits 4:3 */
+#define HET_CTRL_ACTION_MASK    (0x3U << 3)
+#define HET_CTRL_ACTION_PULSELO (0x2U << 3)
+#define HET_CTRL_ACTION_PULSEHI (0x3U << 3)
+
+/* PCNT measurement type, program field bits 8:7 */
+#define HET_PCNT_TYPE_MASK      (0x3U << 7)
+#define HET_PCNT_TYPE_FALL2RISE (0x1U << 7)
+#define HET_PCNT_TYPE_RISE2FALL (0x2U << 7)
+
+#define HTU_GC_HTUEN         BIT(16)
+#define HTU_CPENA_ENA_A(dcp) (0x1U << (2U * (dcp)))
+#define HTU_CPENA_DIS(dcp)   (0x3U << (2U * (dcp)))
+
+#define HTU_IHADDRCT_DIR_HET_TO_RAM BIT(23)
+#define HTU_IHADDRCT_TMBA_CIRCULAR  (0x1U << 18)
+#define HTU_IHADDRCT_IHADDR(offset) ((offset) & 0x1FFCU)
+#define HTU_ITCOUNT_FRAMES(n)       (((n) & 0x7FFU) << 16)
+#define HTU_ITCOUNT_ELEMENTS(n)     ((n) & 0x1FU)
+#define HTU_MAX_FRAMES              0x7FFU
+
+struct hercules_n2het_regs {
+	uint32_t GCR;      /* 0x0000 */
+	uint32_t PFR;      /* 0x0004 */
+	uint32_t ADDR;     /* 0x0008 */
+	uint32_t OFF1;     /* 0x000C */
+	uint32_t OFF2;     /* 0x0010 */
+	uint32_t INTENAS;  /* 0x0014 */
+	uint32_t INTENAC;  /* 0x0018 */
+	uint32_t EXC1;     /* 0x001C */
+	uint32_t EXC2;     /* 0x0020 */
+	uint32_t PRY;      /* 0x0024 */
+	uint32_t FLG;      /* 0x0028 */
+	uint32_t AND;      /* 0x002C */
+	uint32_t rsvd1;    /* 0x0030 */
+	uint32_t HRSH;     /* 0x0034 */
+	uint32_t XOR;      /* 0x0038 */
+	uint32_t REQENS;   /* 0x003C */
+	uint32_t REQENC;   /* 0x0040 */
+	uint32_t REQDS;    /* 0x0044 */
+	uint32_t rsvd2;    /* 0x0048 */
+	uint32_t DIR;      /* 0x004C */
+	uint32_t DIN;      /* 0x0050 */
+	uint32_t DOUT;     /* 0x0054 */
+	uint32_t DSET;     /* 0x0058 */
+	uint32_t DCLR;     /* 0x005C */
+	uint32_t PDR;      /* 0x0060 */
+	uint32_t PULDIS;   /* 0x0064 */
+	uint32_t PSL;      /* 0x0068 */
+	uint32_t rsvd3[2]; /* 0x006C */
+	uint32_t PCR;      /* 0x0074 */
+	uint32_t PAR;      /* 0x0078 */
+	uint32_t PPR;      /* 0x007C */
+	uint32_t SFPRLD;   /* 0x0080 */
+	uint32_t SFENA;    /* 0x0084 */
+	uint32_t rsvd4;    /* 0x0088 */
+	uint32_t LBPSEL;   /* 0x008C */
+	uint32_t LBPDIR;   /* 0x0090 */
+	uint32_t PINDIS;   /* 0x0094 */
+};
+
+struct hercules_n2het_instruction {
+	uint32_t program;
+	uint32_t control;
+	uint32_t data;
+	uint32_t rsvd;
+};
+
+struct hercules_htu_regs {
+	uint32_t GC;       /* 0x0000 */
+	uint32_t CPENA;    /* 0x0004 */
+	uint32_t BUSY[4];  /* 0x0008 */
+	uint32_t ACPE;     /* 0x0018 */
+	uint32_t rsvd1;    /* 0x001C */
+	uint32_t RLBECTRL; /* 0x0020 */
+	uint32_t BFINTS;   /* 0x0024 */
+	uint32_t BFINTC;   /* 0x0028 */
+	uint32_t INTMAP;   /* 0x002C */
+	uint32_t rsvd2;    /* 0x0030 */
+	uint32_t INTOFF0;  /* 0x0034 */
+	uint32_t INTOFF1;  /* 0x0038 */
+	uint32_t BIM;      /* 0x003C */
+	uint32_t RLOSTFL;  /* 0x0040 */
+	uint32_t BFINTFL;  /* 0x0044 */
+	uint32_t BERINTFL; /* 0x0048 */
+};
+
+struct hercules_htu_dcp_ram {
+	struct {
+		uint32_t IHADDRCT;
+		uint32_t ITCOUNT;
+		uint32_t IFADDRA;
+		uint32_t IFADDRB;
+	} DCP[8];           /* 0x0000: initial control packets */
+	uint32_t rsvd1[32]; /* 0x0080 */
+	struct {
+		uint32_t CFADDRA;
+		uint32_t CFADDRB;
+		uint32_t CFCOUNT;
+		uint32_t rsvd;
+	} CDCP[8];          /* 0x0100: current control packets */
+};
+
+struct n2het_pwm_chan {
+	uint8_t pin;
+	uint8_t duty;
+	uint8_t reload_duty;
+	uint8_t reload_period;
+};
+
+struct n2het_cap_chan {
+	uint8_t pin;
+	uint8_t pulse;
+	uint8_t period;
+	uint8_t stamp;
+	uint8_t request;
+};
+
+struct n2het_cap_state {
+	pwm_capture_callback_handler_t cb;
+	void *user_data;
+	bool continuous;
+	uintptr_t stream_buf;
+};
+
+struct pwm_ti_hercules_n2het_config {
+	uintptr_t het;
+	uintptr_t ram;
+	uintptr_t htu;
+	uintptr_t htu_dcp;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	uint8_t hr_prescale;
+	uint8_t lr_prescale;
+	const struct hercules_n2het_instruction *program;
+	size_t program_len;
+	const struct n2het_pwm_chan *pwm;
+	size_t pwm_count;
+	const uint8_t *pwm_lut;
+	const struct n2het_cap_chan *cap;
+	size_t cap_count;
+	const uint8_t *cap_lut;
+	const uint8_t *irq_lut;
+	struct n2het_cap_state *cap_state;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct pwm_ti_hercules_n2het_data {
+	struct k_spinlock lock;
+	uint32_t hr_rate;
+};
+
+#define DEV_CFG(dev)  ((const struct pwm_ti_hercules_n2het_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct pwm_ti_hercules_n2het_data *)(dev)->data)
+#define DEV_HET(dev)  ((volatile struct hercules_n2het_regs *)DEV_CFG(dev)->het)
+#define DEV_RAM(dev)  ((volatile struct hercules_n2het_instruction *)DEV_CFG(dev)->ram)
+#define DEV_HTU(dev)  ((volatile struct hercules_htu_regs *)DEV_CFG(dev)->htu)
+#define DEV_DCP(dev)  ((volatile struct hercules_htu_dcp_ram *)DEV_CFG(dev)->htu_dcp)
+
+/* HR cycles <-> N2HET data field (LR count in 31:7, HR fraction in 6:0) */
+static inline uint32_t n2het_cycles_to_data(uint32_t cycles, uint32_t lr)
+{
+	return ((cycles / lr) << N2HET_HR_SHIFT) | (((cycles % lr) << N2HET_HR_SHIFT) / lr);
+}
+
+static inline uint32_t n2het_data_to_cycles(uint32_t data, uint32_t lr)
+{
+	return (data >> N2HET_HR_SHIFT) * lr + (((data & N2HET_HR_MASK) * lr) >> N2HET_HR_SHIFT);
+}
+
+static int pwm_ti_hercules_n2het_set_cycles(const struct device *dev, uint32_t channel,
+					    uint32_t period_cycles, uint32_t pulse_cycles,
+					    pwm_flags_t flags)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_n2het_instruction *ram = DEV_RAM(dev);
+	const struct n2het_pwm_chan *chan;
+	uint32_t lr = cfg->lr_prescale;
+	uint32_t period_lr = period_cycles / lr;
+	uint32_t action;
+	k_spinlock_key_t key;
+
+	if (channel >= N2HET_PINS || cfg->pwm_lut[channel] == N2HET_CHAN_NONE) {
+		return -EINVAL;
+	}
+	chan = &cfg->pwm[cfg->pwm_lut[channel]];
+
+	/* The period is counted in loops, the duty cycle down to one HR clock */
+	if (period_lr == 0U || period_lr > N2HET_LR_MAX) {
+		return -ENOTSUP;
+	}
+	pulse_cycles = MIN(pulse_cycles, period_lr * lr);
+
+	action = (flags & PWM_POLARITY_INVERTED) ? HET_CTRL_ACTION_PULSELO
+						 : HET_CTRL_ACTION_PULSEHI;
+
+	/*
+	 * Only the shadow instructions are touched. The N2HET copies them into
+	 * the running PWCNT/DJZ pair in the same loop at the period boundary.
+	 */
+	key = k_spin_lock(&DEV_DATA(dev)->lock);
+	ram[chan->reload_duty].control =
+		(ram[chan->reload_duty].control & ~HET_CTRL_ACTION_MASK) | action;
+	ram[chan->reload_duty].data = n2het_cycles_to_data(pulse_cycles, lr);
+	ram[chan->reload_period].data = (period_lr - 1U) << N2HET_HR_SHIFT;
+	k_spin_unlock(&DEV_DATA(dev)->lock, key);
+
+	return 0;
+}
+
+static int pwm_ti_hercules_n2het_get_cycles_per_sec(const struct device *dev, uint32_t channel,
+						    uint64_t *cycles)
+{
+	ARG_UNUSED(channel);
+
+	*cycles = DEV_DATA(dev)->hr_rate;
+	return 0;
+}
+
+#ifdef CONFIG_PWM_CAPTURE
+static int pwm_ti_hercules_n2het_configure_capture(const struct device *dev, uint32_t channel,
+						   pwm_flags_t flags,
+						   pwm_capture_callback_handler_t cb,
+						   void *user_data)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_n2het_regs *het = DEV_HET(dev);
+	volatile struct hercules_n2het_instruction *ram = DEV_RAM(dev);
+	const struct n2het_cap_chan *chan;
+	struct n2het_cap_state *state;
+	uint32_t type;
+
+	if (channel >= N2HET_PINS || cfg->cap_lut[channel] == N2HET_CHAN_NONE) {
+		return -EINVAL;
+	}
+	chan = &cfg->cap[cfg->cap_lut[channel]];
+	state = &cfg->cap_state[cfg->cap_lut[channel]];
+
+	if ((het->INTENAS & BIT(chan->period % 32U)) != 0U) {
+		return -EBUSY;
+	}
+
+	type = (flags & PWM_POLARITY_INVERTED) ? HET_PCNT_TYPE_FALL2RISE
+					       : HET_PCNT_TYPE_RISE2FALL;
+	ram[chan->pulse].program = (ram[chan->pulse].program & ~HET_PCNT_TYPE_MASK) | type;
+
+	state->cb = cb;
+	state->user_data = user_data;
+	state->continuous = (flags & PWM_CAPTURE_MODE_CONTINUOUS) != 0U;
+	return 0;
+}
+
+static int pwm_ti_hercules_n2het_enable_capture(const struct device *dev, uint32_t channel)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_n2het_regs *het = DEV_HET(dev);
+	uint32_t flag;
+
+	if (channel >= N2HET_PINS || cfg->cap_lut[channel] == N2HET_CHAN_NONE) {
+		return -EINVAL;
+	}
+	if (cfg->cap_state[cfg->cap_lut[channel]].cb == NULL) {
+		return -EINVAL;
+	}
+
+	flag = BIT(cfg->cap[cfg->cap_lut[channel]].period % 32U);
+	if ((het->INTENAS & flag) != 0U) {
+		return -EBUSY;
+	}
+	het->FLG = flag;
+	het->INTENAS = flag;
+	return 0;
+}
+
+static int pwm_ti_hercules_n2het_disable_capture(const struct device *dev, uint32_t channel)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+
+	if (channel >= N2HET_PINS || cfg->cap_lut[channel] == N2HET_CHAN_NONE) {
+		return -EINVAL;
+	}
+	DEV_HET(dev)->INTENAC = BIT(cfg->cap[cfg->cap_lut[channel]].period % 32U);
+	return 0;
+}
+#endif /* CONFIG_PWM_CAPTURE */
+
+static void pwm_ti_hercules_n2het_isr(const struct device *dev)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_n2het_regs *het = DEV_HET(dev);
+	volatile struct hercules_n2het_instruction *ram = DEV_RAM(dev);
+	uint32_t offset;
+
+	/* HETOFF1 returns the 1-based pending flag and clears it on read */
+	while ((offset = het->OFF1) != 0U) {
+		uint8_t idx = cfg->irq_lut[(offset - 1U) % 32U];
+		const struct n2het_cap_chan *chan;
+		struct n2het_cap_state *state;
+		uint32_t period, pulse;
+
+		if (idx == N2HET_CHAN_NONE) {
+			continue;
+		}
+		chan = &cfg->cap[idx];
+		state = &cfg->cap_state[idx];
+
+		period = n2het_data_to_cycles(ram[chan->period].data, cfg->lr_prescale);
+		pulse = n2het_data_to_cycles(ram[chan->pulse].data, cfg->lr_prescale);
+
+		if (!state->continuous) {
+			het->INTENAC = BIT(chan->period % 32U);
+		}
+		if (state->cb != NULL) {
+			state->cb(dev, chan->pin, period, pulse, 0, state->user_data);
+		}
+	}
+}
+
+int ti_hercules_n2het_stream_start(const struct device *dev, uint32_t channel, uint32_t *buf,
+				   size_t count)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_htu_dcp_ram *dcp = DEV_DCP(dev);
+	const struct n2het_cap_chan *chan;
+	uint32_t offset;
+
+	if (channel >= N2HET_PINS || cfg->cap_lut[channel] == N2HET_CHAN_NONE ||
+	    buf == NULL || !IN_RANGE(count, 1, HTU_MAX_FRAMES)) {
+		return -EINVAL;
+	}
+	chan = &cfg->cap[cfg->cap_lut[channel]];
+	if (chan->request == N2HET_CHAN_NONE) {
+		return -ENOTSUP;
+	}
+
+	/* One 32-bit element per frame from the WCAP data field, ring in RAM */
+	offset = (chan->stamp * sizeof(struct hercules_n2het_instruction)) +
+		 offsetof(struct hercules_n2het_instruction, data);
+	DEV_HTU(dev)->CPENA = HTU_CPENA_DIS(chan->request);
+	dcp->DCP[chan->request].IHADDRCT = HTU_IHADDRCT_DIR_HET_TO_RAM |
+					   HTU_IHADDRCT_TMBA_CIRCULAR |
+					   HTU_IHADDRCT_IHADDR(offset);
+	dcp->DCP[chan->request].ITCOUNT = HTU_ITCOUNT_FRAMES(count) | HTU_ITCOUNT_ELEMENTS(1);
+	dcp->DCP[chan->request].IFADDRA = (uint32_t)buf;
+	dcp->DCP[chan->request].IFADDRB = (uint32_t)buf;
+	cfg->cap_state[cfg->cap_lut[channel]].stream_buf = (uintptr_t)buf;
+
+	DEV_HTU(dev)->CPENA = HTU_CPENA_ENA_A(chan->request);
+	DEV_HET(dev)->REQENS = BIT(chan->request);
+	return 0;
+}
+
+int ti_hercules_n2het_stream_stop(const struct device *dev, uint32_t channel)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	const struct n2het_cap_chan *chan;
+
+	if (channel >= N2HET_PINS || cfg->cap_lut[channel] == N2HET_CHAN_NONE) {
+		return -EINVAL;
+	}
+	chan = &cfg->cap[cfg->cap_lut[channel]];
+	if (chan->request == N2HET_CHAN_NONE) {
+		return -ENOTSUP;
+	}
+
+	DEV_HET(dev)->REQENC = BIT(chan->request);
+	DEV_HTU(dev)->CPENA = HTU_CPENA_DIS(chan->request);
+	cfg->cap_state[cfg->cap_lut[channel]].stream_buf = 0;
+	return 0;
+}
+
+int ti_hercules_n2het_stream_head(const struct device *dev, uint32_t channel)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	const struct n2het_cap_chan *chan;
+	uintptr_t buf;
+
+	if (channel >= N2HET_PINS || cfg->cap_lut[channel] == N2HET_CHAN_NONE) {
+		return -EINVAL;
+	}
+	chan = &cfg->cap[cfg->cap_lut[channel]];
+	buf = cfg->cap_state[cfg->cap_lut[channel]].stream_buf;
+	if (chan->request == N2HET_CHAN_NONE || buf == 0U) {
+		return -ENOTSUP;
+	}
+
+	return (int)((DEV_DCP(dev)->CDCP[chan->request].CFADDRA - buf) / sizeof(uint32_t));
+}
+
+static int pwm_ti_hercules_n2het_init(const struct device *dev)
+{
+	const struct pwm_ti_hercules_n2het_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_n2het_regs *het = DEV_HET(dev);
+	volatile struct hercules_n2het_instruction *ram = DEV_RAM(dev);
+	uint32_t vclk2, pin_mask = 0;
+	int ret;
+
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &vclk2);
+	if (ret != 0) {
+		LOG_ERR("Unable to get VCLK2 rate");
+		return ret;
+	}
+	DEV_DATA(dev)->hr_rate = vclk2 / cfg->hr_prescale;
+
+	/* Stop the N2HET before replacing its program */
+	het->GCR = 0;
+	het->INTENAC = UINT32_MAX;
+	het->REQENC = UINT32_MAX;
+	het->FLG = UINT32_MAX;
+
+	het->PFR = (LOG2(cfg->lr_prescale) << HET_PFR_LRPFC_SHIFT) | (cfg->hr_prescale - 1U);
+
+	/* The instruction RAM only accepts 32-bit accesses */
+	for (size_t i = 0; i < cfg->program_len; i++) {
+		ram[i].program = cfg->program[i].program;
+		ram[i].control = cfg->program[i].control;
+		ram[i].data = cfg->program[i].data;
+		ram[i].rsvd = 0;
+	}
+
+	for (size_t i = 0; i < cfg->pwm_count; i++) {
+		pin_mask |= BIT(cfg->pwm[i].pin);
+	}
+	het->DCLR = pin_mask;
+	het->DIR |= pin_mask;
+
+	/* Capture interrupts use the high priority line (HETOFF1) */
+	for (size_t i = 0; i < cfg->cap_count; i++) {
+		het->PRY |= BIT(cfg->cap[i].period % 32U);
+	}
+	/* Requests go to the HTU, not the DMA */
+	het->REQDS = 0;
+	DEV_HTU(dev)->GC = HTU_GC_HTUEN;
+
+	cfg->irq_config_func(dev);
+
+	het->GCR = HET_GCR_TO | HET_GCR_CMS | HET_GCR_HET_PIN_ENA;
+	return 0;
+}
+
+static DEVICE_API(pwm, pwm_ti_hercules_n2het_api) = {
+	.set_cycles = pwm_ti_hercules_n2het_set_cycles,
+	.get_cycles_per_sec = pwm_ti_hercules_n2het_get_cycles_per_sec,
+#ifdef CONFIG_PWM_CAPTURE
+	.configure_capture = pwm_ti_hercules_n2het_configure_capture,
+	.enable_capture = pwm_ti_hercules_n2het_enable_capture,
+	.disable_capture = pwm_ti_hercules_n2het_disable_capture,
+#endif
+};
+
+#define N2HET_GEN(name, n) CONCAT(name, DT_INST_DEP_ORD(n))
+
+#define PWM_TI_HERCULES_N2HET_INIT(n)                                                              \
+	BUILD_ASSERT(IN_RANGE(DT_INST_PROP(n, hr_prescale), 1, 64),                                \
+		     "hr-prescale out of range! (1 - 64)");                                        \
+	static const struct hercules_n2het_instruction n2het_program_##n[] =                       \
+		N2HET_GEN(N2HET_PROGRAM_, n);                                                      \
+	static const struct n2het_pwm_chan n2het_pwm_##n[MAX(N2HET_GEN(N2HET_PWM_COUNT_, n), 1)] = \
+		N2HET_GEN(N2HET_PWM_CHANNELS_, n);                                                 \
+	static const uint8_t n2het_pwm_lut_##n[N2HET_PINS] = N2HET_GEN(N2HET_PWM_LUT_, n);         \
+	static const struct n2het_cap_chan                                                         \
+		n2het_cap_##n[MAX(N2HET_GEN(N2HET_CAPTURE_COUNT_, n), 1)] =                        \
+			N2HET_GEN(N2HET_CAPTURE_CHANNELS_, n);                                     \
+	static const uint8_t n2het_cap_lut_##n[N2HET_PINS] = N2HET_GEN(N2HET_CAPTURE_LUT_, n);     \
+	static const uint8_t n2het_irq_lut_##n[32] = N2HET_GEN(N2HET_IRQ_LUT_, n);                 \
+	static struct n2het_cap_state                                                              \
+		n2het_cap_state_##n[MAX(N2HET_GEN(N2HET_CAPTURE_COUNT_, n), 1)];                   \
+	static void pwm_ti_hercules_n2het_irq_config_##n(const struct device *dev)                 \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority),                         \
+			    pwm_ti_hercules_n2het_isr, DEVICE_DT_INST_GET(n),                      \
+			    DT_INST_IRQ(n, type));                                                 \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+	static const struct pwm_ti_hercules_n2het_config pwm_ti_hercules_n2het_config_##n = {     \
+		.het = DT_INST_REG_ADDR_BY_NAME(n, het),                                           \
+		.ram = DT_INST_REG_ADDR_BY_NAME(n, ram),                                           \
+		.htu = DT_INST_REG_ADDR_BY_NAME(n, htu),                                           \
+		.htu_dcp = DT_INST_REG_ADDR_BY_NAME(n, htu_dcp),                                   \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.hr_prescale = DT_INST_PROP(n, hr_prescale),                                       \
+		.lr_prescale = DT_INST_PROP(n, lr_prescale),                                       \
+		.program = n2het_program_##n,                                                      \
+		.program_len = N2HET_GEN(N2HET_PROGRAM_LEN_, n),                                   \
+		.pwm = n2het_pwm_##n,                                                              \
+		.pwm_count = N2HET_GEN(N2HET_PWM_COUNT_, n),                                       \
+		.pwm_lut = n2het_pwm_lut_##n,                                                      \
+		.cap = n2het_cap_##n,                                                              \
+		.cap_count = N2HET_GEN(N2HET_CAPTURE_COUNT_, n),                                   \
+		.cap_lut = n2het_cap_lut_##n,                                                      \
+		.irq_lut = n2het_irq_lut_##n,                                                      \
+		.cap_state = n2het_cap_state_##n,                                                  \
+		.irq_config_func = pwm_ti_hercules_n2het_irq_config_##n,                           \
+	};                                                                                         \
+	static struct pwm_ti_hercules_n2het_data pwm_ti_hercules_n2het_data_##n;                   \
+	DEVICE_DT_INST_DEFINE(n, pwm_ti_hercules_n2het_init, NULL,                                 \
+			      &pwm_ti_hercules_n2het_data_##n, &pwm_ti_hercules_n2het_config_##n,  \
+			      POST_KERNEL, CONFIG_PWM_INIT_PRIORITY, &pwm_ti_hercules_n2het_api);
+
+DT_INST_FOREACH_STATUS_OKAY(PWM_TI_HERCULES_N2HET_INIT)
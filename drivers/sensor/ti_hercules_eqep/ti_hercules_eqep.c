@@ -0,0 +1,408 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_eqep
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/ti_hercules_eqep.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(ti_hercules_eqep, CONFIG_SENSOR_LOG_LEVEL);
+
+#define EQEP_QDECCTL_SWAP  BIT(10)
+#define EQEP_QDECCTL_SPSEL BIT(12)
+#define EQEP_QDECCTL_SOEN  BIT(13)
+
+/* Keep counting while the CPU is halted by the debugger */
+#define EQEP_QEPCTL_FREE       (2U << 14)
+#define EQEP_QEPCTL_PCRM_INDEX (0U << 12)
+#define EQEP_QEPCTL_PCRM_MAX   (1U << 12)
+#define EQEP_QEPCTL_IEL_RISING (1U << 4)
+#define EQEP_QEPCTL_QPEN       BIT(3)
+#define EQEP_QEPCTL_QCLM       BIT(2)
+#define EQEP_QEPCTL_UTE        BIT(1)
+
+#define EQEP_QCAPCTL_CEN       BIT(15)
+#define EQEP_QCAPCTL_CCPS(n)   ((n) << 4)
+#define EQEP_QCAPCTL_UPPS(n)   (n)
+
+#define EQEP_QPOSCTL_PCE       BIT(12)
+/* Compare output pulse of (PCSPW + 1) * 4 VCLK3 cycles */
+#define EQEP_QPOSCTL_PCSPW     0xFFFU
+
+#define EQEP_INT_UTO BIT(11)
+#define EQEP_INT_IEL BIT(10)
+#define EQEP_INT_SEL BIT(9)
+#define EQEP_INT_PCM BIT(8)
+#define EQEP_INT_PHE BIT(2)
+#define EQEP_INT_ALL GENMASK(11, 0)
+
+#define EQEP_QEPSTS_QDF  BIT(5)
+#define EQEP_QEPSTS_COEF BIT(3)
+#define EQEP_QEPSTS_CDEF BIT(2)
+
+#define EQEP_TRIGGERS 3U
+
+/* Below this many unit position events per unit period the capture unit is more precise */
+#define EQEP_CAPTURE_EVENTS 4
+
+#define DEV_CFG(dev)  ((const struct eqep_ti_hercules_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct eqep_ti_hercules_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_eqep_regs *)DEV_CFG(dev)->base)
+
+struct hercules_eqep_regs {
+	uint32_t QPOSCNT;  /* 0x00 */
+	uint32_t QPOSINIT; /* 0x04 */
+	uint32_t QPOSMAX;  /* 0x08 */
+	uint32_t QPOSCMP;  /* 0x0C */
+	uint32_t QPOSILAT; /* 0x10 */
+	uint32_t QPOSSLAT; /* 0x14 */
+	uint32_t QPOSLAT;  /* 0x18 */
+	uint32_t QUTMR;    /* 0x1C */
+	uint32_t QUPRD;    /* 0x20 */
+	/* Halfword pairs in little-endian order, swapped against the TMS570 */
+	uint16_t QWDPRD;   /* 0x24 */
+	uint16_t QWDTMR;   /* 0x26 */
+	uint16_t QEPCTL;   /* 0x28 */
+	uint16_t QDECCTL;  /* 0x2A */
+	uint16_t QPOSCTL;  /* 0x2C */
+	uint16_t QCAPCTL;  /* 0x2E */
+	uint16_t QFLG;     /* 0x30 */
+	uint16_t QEINT;    /* 0x32 */
+	uint16_t QFRC;     /* 0x34 */
+	uint16_t QCLR;     /* 0x36 */
+	uint16_t QCTMR;    /* 0x38 */
+	uint16_t QEPSTS;   /* 0x3A */
+	uint16_t QCTMRLAT; /* 0x3C */
+	uint16_t QCPRD;    /* 0x3E */
+	uint16_t rsvd1;    /* 0x40 */
+	uint16_t QCPRDLAT; /* 0x42 */
+};
+
+struct eqep_ti_hercules_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	uint32_t counts;
+	uint32_t unit_period_us;
+	uint8_t capture_prescaler;
+	uint8_t unit_position_prescaler;
+	bool index_reset;
+	bool swap_inputs;
+	bool compare_output;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct eqep_ti_hercules_data {
+	struct k_spinlock lock;
+	uint32_t vclk;
+	/* Updated on every unit timer period */
+	uint32_t last_latch;
+	int32_t delta;
+	uint16_t capture_period;
+	uint16_t status;
+	/* Last sample */
+	uint32_t position;
+	uint32_t index_position;
+	uint32_t strobe_position;
+	int64_t velocity_mrpm;
+	sensor_trigger_handler_t handlers[EQEP_TRIGGERS];
+	const struct sensor_trigger *triggers[EQEP_TRIGGERS];
+};
+
+static const uint16_t eqep_trigger_int[EQEP_TRIGGERS] = {EQEP_INT_IEL, EQEP_INT_SEL, EQEP_INT_PCM};
+
+/* Position change over a unit period, the counter wraps around at one revolution */
+static int32_t eqep_position_delta(uint32_t counts, uint32_t now, uint32_t before)
+{
+	int32_t delta = (int32_t)(now - before);
+
+	if (delta > (int32_t)(counts / 2U)) {
+		delta -= (int32_t)counts;
+	} else if (delta < -(int32_t)(counts / 2U)) {
+		delta += (int32_t)counts;
+	}
+	return delta;
+}
+
+static int64_t eqep_velocity(const struct device *dev, int32_t delta, uint16_t period,
+			     uint16_t status)
+{
+	const struct eqep_ti_hercules_config *cfg = DEV_CFG(dev);
+	struct eqep_ti_hercules_data *data = DEV_DATA(dev);
+	int32_t events = delta >> cfg->unit_position_prescaler;
+	int64_t mrpm;
+
+	if (events <= -EQEP_CAPTURE_EVENTS || events >= EQEP_CAPTURE_EVENTS ||
+	    (status & EQEP_QEPSTS_CDEF) != 0U) {
+		/* High speed or reversal: counts over the unit period */
+		return (int64_t)delta * 60000LL * USEC_PER_SEC /
+		       ((int64_t)cfg->counts * cfg->unit_period_us);
+	}
+
+	if ((status & EQEP_QEPSTS_COEF) != 0U || period == 0U) {
+		/* Slower than one unit position event per capture timer period */
+		return 0;
+	}
+
+	/* Low speed: 2^UPPS counts took QCPRDLAT capture timer ticks */
+	mrpm = (int64_t)((60000ULL * data->vclk) << cfg->unit_position_prescaler) /
+	       ((uint64_t)cfg->counts * period << cfg->capture_prescaler);
+
+	return (status & EQEP_QEPSTS_QDF) != 0U ? mrpm : -mrpm;
+}
+
+static int eqep_ti_hercules_sample_fetch(const struct device *dev, enum sensor_channel chan)
+{
+	volatile struct hercules_eqep_regs *regs = DEV_REGS(dev);
+	struct eqep_ti_hercules_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key;
+	int32_t delta;
+	uint16_t period, status;
+
+	ARG_UNUSED(chan);
+
+	key = k_spin_lock(&data->lock);
+	data->position = regs->QPOSCNT;
+	data->index_position = regs->QPOSILAT;
+	data->strobe_position = regs->QPOSSLAT;
+	delta = data->delta;
+	period = data->capture_period;
+	status = data->status;
+	k_spin_unlock(&data->lock, key);
+
+	data->velocity_mrpm = eqep_velocity(dev, delta, period, status);
+
+	return 0;
+}
+
+static int eqep_ti_hercules_channel_get(const struct device *dev, enum sensor_channel chan,
+					struct sensor_value *val)
+{
+	const struct eqep_ti_hercules_config *cfg = DEV_CFG(dev);
+	struct eqep_ti_hercules_data *data = DEV_DATA(dev);
+
+	switch ((int)chan) {
+	case SENSOR_CHAN_ROTATION:
+		return sensor_value_from_micro(val, (int64_t)data->position * 360000000LL /
+							    cfg->counts);
+	case SENSOR_CHAN_RPM:
+		return sensor_value_from_milli(val, data->velocity_mrpm);
+	case SENSOR_CHAN_TI_HERCULES_EQEP_POSITION:
+		val->val1 = (int32_t)data->position;
+		break;
+	case SENSOR_CHAN_TI_HERCULES_EQEP_INDEX_POSITION:
+		val->val1 = (int32_t)data->index_position;
+		break;
+	case SENSOR_CHAN_TI_HERCULES_EQEP_STROBE_POSITION:
+		val->val1 = (int32_t)data->strobe_position;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+	val->val2 = 0;
+
+	return 0;
+}
+
+static int eqep_ti_hercules_attr_set(const struct device *dev, enum sensor_channel chan,
+				     enum sensor_attribute attr, const struct sensor_value *val)
+{
+	const struct eqep_ti_hercules_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_eqep_regs *regs = DEV_REGS(dev);
+	struct eqep_ti_hercules_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(chan);
+
+	if ((int)attr != SENSOR_ATTR_TI_HERCULES_EQEP_COMPARE) {
+		return -ENOTSUP;
+	}
+	if (val->val1 >= (int32_t)cfg->counts) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+	regs->QPOSCTL = EQEP_QPOSCTL_PCSPW;
+	if (val->val1 >= 0) {
+		regs->QPOSCMP = (uint32_t)val->val1;
+		regs->QPOSCTL = EQEP_QPOSCTL_PCE | EQEP_QPOSCTL_PCSPW;
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return 0;
+}
+
+static int eqep_ti_hercules_attr_get(const struct device *dev, enum sensor_channel chan,
+				     enum sensor_attribute attr, struct sensor_value *val)
+{
+	volatile struct hercules_eqep_regs *regs = DEV_REGS(dev);
+
+	ARG_UNUSED(chan);
+
+	if ((int)attr != SENSOR_ATTR_TI_HERCULES_EQEP_COMPARE) {
+		return -ENOTSUP;
+	}
+
+	val->val1 = (regs->QPOSCTL & EQEP_QPOSCTL_PCE) != 0U ? (int32_t)regs->QPOSCMP : -1;
+	val->val2 = 0;
+
+	return 0;
+}
+
+static int eqep_ti_hercules_trigger_set(const struct device *dev,
+					const struct sensor_trigger *trig,
+					sensor_trigger_handler_t handler)
+{
+	volatile struct hercules_eqep_regs *regs = DEV_REGS(dev);
+	struct eqep_ti_hercules_data *data = DEV_DATA(dev);
+	uint32_t idx = (uint32_t)trig->type - SENSOR_TRIG_TI_HERCULES_EQEP_INDEX;
+	k_spinlock_key_t key;
+
+	if ((int)trig->type < SENSOR_TRIG_TI_HERCULES_EQEP_INDEX || idx >= EQEP_TRIGGERS) {
+		return -ENOTSUP;
+	}
+
+	key = k_spin_lock(&data->lock);
+	data->handlers[idx] = handler;
+	data->triggers[idx] = trig;
+	if (handler != NULL) {
+		regs->QCLR = eqep_trigger_int[idx];
+		regs->QEINT |= eqep_trigger_int[idx];
+	} else {
+		regs->QEINT &= ~eqep_trigger_int[idx];
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return 0;
+}
+
+static void eqep_ti_hercules_isr(const struct device *dev)
+{
+	const struct eqep_ti_hercules_config *cfg = DEV_CFG(dev);
+	volatile struct hercules_eqep_regs *regs = DEV_REGS(dev);
+	struct eqep_ti_hercules_data *data = DEV_DATA(dev);
+	uint16_t flags = regs->QFLG & regs->QEINT;
+
+	/* Clearing INT (bit 0) re-arms the interrupt line */
+	regs->QCLR = flags | BIT(0);
+
+	if ((flags & EQEP_INT_UTO) != 0U) {
+		/* QCLM latched the position and the capture period together */
+		uint32_t latch = regs->QPOSLAT;
+		uint16_t status = regs->QEPSTS;
+
+		data->delta = eqep_position_delta(cfg->counts, latch, data->last_latch);
+		data->last_latch = latch;
+		data->capture_period = regs->QCPRDLAT;
+		data->status = status;
+		regs->QEPSTS = status & (EQEP_QEPSTS_COEF | EQEP_QEPSTS_CDEF);
+	}
+
+	if ((flags & EQEP_INT_PHE) != 0U) {
+		LOG_WRN("%s: quadrature phase error", dev->name);
+	}
+
+	for (size_t i = 0; i < EQEP_TRIGGERS; i++) {
+		if ((flags & eqep_trigger_int[i]) != 0U && data->handlers[i] != NULL) {
+			data->handlers[i](dev, data->triggers[i]);
+		}
+	}
+}
+
+static int eqep_ti_hercules_init(const struct device *dev)
+{
+	const struct eqep_ti_hercules_config *cfg = DEV_CFG(dev);
+	struct eqep_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_eqep_regs *regs = DEV_REGS(dev);
+	uint16_t decctl = 0U;
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &data->vclk);
+	if (ret != 0) {
+		return ret;
+	}
+
+	regs->QEPCTL = 0U;
+	regs->QCAPCTL = 0U;
+	regs->QPOSCTL = EQEP_QPOSCTL_PCSPW;
+	regs->QEINT = 0U;
+	regs->QCLR = EQEP_INT_ALL;
+
+	if (cfg->swap_inputs) {
+		decctl |= EQEP_QDECCTL_SWAP;
+	}
+	if (cfg->compare_output) {
+		decctl |= EQEP_QDECCTL_SOEN | EQEP_QDECCTL_SPSEL;
+	}
+	regs->QDECCTL = decctl;
+
+	regs->QPOSINIT = 0U;
+	regs->QPOSMAX = cfg->counts - 1U;
+	regs->QPOSCNT = 0U;
+	regs->QUPRD = (uint32_t)((uint64_t)data->vclk * cfg->unit_period_us / USEC_PER_SEC);
+	regs->QCAPCTL = EQEP_QCAPCTL_CCPS(cfg->capture_prescaler) |
+			EQEP_QCAPCTL_UPPS(cfg->unit_position_prescaler);
+	regs->QCAPCTL |= EQEP_QCAPCTL_CEN;
+
+	cfg->irq_config_func(dev);
+	regs->QEINT = EQEP_INT_UTO | EQEP_INT_PHE;
+	regs->QEPCTL = EQEP_QEPCTL_FREE |
+		       (cfg->index_reset ? EQEP_QEPCTL_PCRM_INDEX : EQEP_QEPCTL_PCRM_MAX) |
+		       EQEP_QEPCTL_IEL_RISING | EQEP_QEPCTL_QPEN | EQEP_QEPCTL_QCLM |
+		       EQEP_QEPCTL_UTE;
+
+	return 0;
+}
+
+static DEVICE_API(sensor, eqep_ti_hercules_api) = {
+	.sample_fetch = eqep_ti_hercules_sample_fetch,
+	.channel_get = eqep_ti_hercules_channel_get,
+	.attr_set = eqep_ti_hercules_attr_set,
+	.attr_get = eqep_ti_hercules_attr_get,
+	.trigger_set = eqep_ti_hercules_trigger_set,
+};
+
+#define EQEP_TI_HERCULES_INIT(n)                                                                   \
+	BUILD_ASSERT(DT_INST_PROP(n, capture_prescaler) <= 7, "capture-prescaler is 0 - 7");      \
+	BUILD_ASSERT(DT_INST_PROP(n, unit_position_prescaler) <= 11,                               \
+		     "unit-position-prescaler is 0 - 11");                                         \
+	static void eqep_ti_hercules_irq_config_##n(const struct device *dev)                     \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority), eqep_ti_hercules_isr,   \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ(n, type));                          \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+	static const struct eqep_ti_hercules_config eqep_ti_hercules_config_##n = {               \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.counts = DT_INST_PROP(n, counts_per_revolution),                                  \
+		.unit_period_us = DT_INST_PROP(n, unit_period_us),                                 \
+		.capture_prescaler = DT_INST_PROP(n, capture_prescaler),                           \
+		.unit_position_prescaler = DT_INST_PROP(n, unit_position_prescaler),               \
+		.index_reset = DT_INST_PROP(n, index_reset),                                       \
+		.swap_inputs = DT_INST_PROP(n, swap_inputs),                                       \
+		.compare_output = DT_INST_PROP(n, compare_output),                                 \
+		.irq_config_func = eqep_ti_hercules_irq_config_##n};                               \
+	static struct eqep_ti_hercules_data eqep_ti_hercules_data_##n;                            \
+	SENSOR_DEVICE_DT_INST_DEFINE(n, eqep_ti_hercules_init, NULL, &eqep_ti_hercules_data_##n,   \
+				     &eqep_ti_hercules_config_##n, POST_KERNEL,                    \
+				     CONFIG_SENSOR_INIT_PRIORITY, &eqep_ti_hercules_api);
+
+DT_INST_FOREACH_STATUS_OKAY(EQEP_TI_HERCULES_INIT)
@@ -0,0 +1,1087 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_sci
+
+#include <soc.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(uart_ti_hercules, CONFIG_UART_LOG_LEVEL);
+
+#define SCI_GCR1_TIMING     BIT(1)
+#define SCI_GCR1_PARITY_ENA BIT(2)
+#define SCI_GCR1_PARITY     BIT(3)
+#define SCI_GCR1_STOP       BIT(4)
+#define SCI_GCR1_CLOCK      BIT(5)
+#define SCI_GCR1_SWNRST     BIT(7)
+#define SCI_GCR1_LOOPBACK   BIT(16)
+#define SCI_GCR1_RXENA      BIT(24)
+#define SCI_GCR1_TXENA      BIT(25)
+
+#define SCI_INT_BRKDT      BIT(0)
+#define SCI_INT_TX         BIT(8)
+#define SCI_INT_RX         BIT(9)
+#define SCI_INT_TX_DMA     BIT(16)
+#define SCI_INT_RX_DMA     BIT(17)
+#define SCI_INT_RX_DMA_ALL BIT(18)
+#define SCI_INT_PE         BIT(24)
+#define SCI_INT_OE         BIT(25)
+#define SCI_INT_FE         BIT(26)
+#define SCI_INT_ERRORS     (SCI_INT_BRKDT | SCI_INT_PE | SCI_INT_OE | SCI_INT_FE)
+
+#define SCI_FLR_BRKDT   BIT(0)
+#define SCI_FLR_IDLE    BIT(2)
+#define SCI_FLR_TXRDY   BIT(8)
+#define SCI_FLR_RXRDY   BIT(9)
+#define SCI_FLR_TXEMPTY BIT(11)
+#define SCI_FLR_PE      BIT(24)
+#define SCI_FLR_OE      BIT(25)
+#define SCI_FLR_FE      BIT(26)
+#define SCI_FLR_ERRORS  (SCI_FLR_BRKDT | SCI_FLR_PE | SCI_FLR_OE | SCI_FLR_FE)
+
+/* INTVECT0 offsets */
+#define SCI_VECT_BRKDT 7U
+#define SCI_VECT_PE    3U
+#define SCI_VECT_FE    6U
+#define SCI_VECT_OE    9U
+#define SCI_VECT_RX    11U
+#define SCI_VECT_TX    12U
+
+#define SCI_PIO0_RX_FUNC BIT(1)
+#define SCI_PIO0_TX_FUNC BIT(2)
+
+#define SCI_BRS_P_MAX 0xFFFFFFU
+
+struct hercules_sci_regs {
+	uint32_t GCR0;      /* 0x0000 */
+	uint32_t GCR1;      /* 0x0004 */
+	uint32_t GCR2;      /* 0x0008 */
+	uint32_t SETINT;    /* 0x000C */
+	uint32_t CLEARINT;  /* 0x0010 */
+	uint32_t SETINTLVL; /* 0x0014 */
+	uint32_t CLRINTLVL; /* 0x0018 */
+	uint32_t FLR;       /* 0x001C */
+	uint32_t INTVECT0;  /* 0x0020 */
+	uint32_t INTVECT1;  /* 0x0024 */
+	uint32_t FORMAT;    /* 0x0028 */
+	uint32_t BRS;       /* 0x002C */
+	uint32_t ED;        /* 0x0030 */
+	uint32_t RD;        /* 0x0034 */
+	uint32_t TD;        /* 0x0038 */
+	uint32_t PIO0;      /* 0x003C */
+};
+
+#ifdef CONFIG_UART_ASYNC_API
+struct uart_ti_hercules_dma {
+	const struct device *dev;
+	uint32_t channel;
+	uint32_t slot;
+};
+
+struct uart_ti_hercules_async {
+	const struct device *uart;
+	uart_callback_t cb;
+	void *user_data;
+
+	/* TX */
+	const uint8_t *tx_buf;
+	size_t tx_len;
+	struct k_work_delayable tx_timeout_work;
+
+	/* RX, the next buffer is queued in the DMA initial packet */
+	uint8_t *rx_buf;
+	size_t rx_len;
+	size_t rx_offset;
+	size_t rx_counter;
+	uint8_t *rx_next_buf;
+	size_t rx_next_len;
+	int32_t rx_timeout;
+	bool rx_enabled;
+	/* The line went idle, the DMA is parked until the next character */
+	bool rx_idle;
+	struct k_work_delayable rx_timeout_work;
+};
+#endif /* CONFIG_UART_ASYNC_API */
+
+struct uart_ti_hercules_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	void (*irq_config_func)(const struct device *dev);
+#ifdef CONFIG_UART_ASYNC_API
+	struct uart_ti_hercules_dma dma_tx;
+	struct uart_ti_hercules_dma dma_rx;
+#endif
+};
+
+struct uart_ti_hercules_data {
+	struct uart_config uart_cfg;
+	struct k_spinlock lock;
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	uart_irq_callback_user_data_t irq_cb;
+	void *irq_cb_data;
+#endif
+#ifdef CONFIG_UART_ASYNC_API
+	struct uart_ti_hercules_async async;
+#endif
+};
+
+#define DEV_CFG(dev)  ((const struct uart_ti_hercules_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct uart_ti_hercules_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_sci_regs *)DEV_CFG(dev)->base)
+
+static int uart_ti_hercules_poll_in(const struct device *dev, unsigned char *c)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+
+	if ((regs->FLR & SCI_FLR_RXRDY) == 0U) {
+		return -1;
+	}
+	*c = (unsigned char)regs->RD;
+	return 0;
+}
+
+static void uart_ti_hercules_poll_out(const struct device *dev, unsigned char c)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key;
+
+	for (;;) {
+		key = k_spin_lock(&data->lock);
+		if ((regs->FLR & SCI_FLR_TXRDY) != 0U) {
+			break;
+		}
+		k_spin_unlock(&data->lock, key);
+	}
+	regs->TD = c;
+	k_spin_unlock(&data->lock, key);
+}
+
+static int uart_ti_hercules_err_check(const struct device *dev)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	uint32_t flr = regs->FLR & SCI_FLR_ERRORS;
+	int err = 0;
+
+	if ((flr & SCI_FLR_OE) != 0U) {
+		err |= UART_ERROR_OVERRUN;
+	}
+	if ((flr & SCI_FLR_PE) != 0U) {
+		err |= UART_ERROR_PARITY;
+	}
+	if ((flr & SCI_FLR_FE) != 0U) {
+		err |= UART_ERROR_FRAMING;
+	}
+	if ((flr & SCI_FLR_BRKDT) != 0U) {
+		err |= UART_BREAK;
+	}
+	/* Flags are write-one-to-clear */
+	regs->FLR = flr;
+	return err;
+}
+
+static int uart_ti_hercules_set_config(const struct device *dev, const struct uart_config *cfg)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	uint32_t vclk, total, gcr1 = SCI_GCR1_TIMING | SCI_GCR1_CLOCK;
+	int ret;
+
+	if (cfg->baudrate == 0U || cfg->flow_ctrl != UART_CFG_FLOW_CTRL_NONE) {
+		return -ENOTSUP;
+	}
+	if (!IN_RANGE(cfg->data_bits, UART_CFG_DATA_BITS_5, UART_CFG_DATA_BITS_8)) {
+		return -ENOTSUP;
+	}
+
+	switch (cfg->parity) {
+	case UART_CFG_PARITY_NONE:
+		break;
+	case UART_CFG_PARITY_ODD:
+		gcr1 |= SCI_GCR1_PARITY_ENA;
+		break;
+	case UART_CFG_PARITY_EVEN:
+		gcr1 |= SCI_GCR1_PARITY_ENA | SCI_GCR1_PARITY;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	switch (cfg->stop_bits) {
+	case UART_CFG_STOP_BITS_1:
+		break;
+	case UART_CFG_STOP_BITS_2:
+		gcr1 |= SCI_GCR1_STOP;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	ret = clock_control_get_rate(config->clk_dev, (clock_control_subsys_t)&config->clk, &vclk);
+	if (ret != 0) {
+		return ret;
+	}
+
+	/*
+	 * Asynchronous timing with the fractional divider:
+	 * baud = VCLK / (16 * (P + 1 + M / 16)), so 16 * (P + 1) + M = VCLK / baud.
+	 */
+	total = (vclk + cfg->baudrate / 2U) / cfg->baudrate;
+	if (total < 16U || (total / 16U - 1U) > SCI_BRS_P_MAX) {
+		return -EINVAL;
+	}
+
+	/* Configuration is only writable while the SCI is held in software reset */
+	regs->GCR1 &= ~SCI_GCR1_SWNRST;
+	regs->GCR1 = gcr1;
+	regs->BRS = ((total % 16U) << 24) | (total / 16U - 1U);
+	regs->FORMAT = cfg->data_bits + 4U; /* CHAR = data bits - 1 */
+	regs->PIO0 = SCI_PIO0_RX_FUNC | SCI_PIO0_TX_FUNC;
+	regs->GCR1 |= SCI_GCR1_SWNRST | SCI_GCR1_RXENA | SCI_GCR1_TXENA;
+
+	DEV_DATA(dev)->uart_cfg = *cfg;
+	return 0;
+}
+
+#ifdef CONFIG_UART_USE_RUNTIME_CONFIGURE
+static int uart_ti_hercules_configure(const struct device *dev, const struct uart_config *cfg)
+{
+	return uart_ti_hercules_set_config(dev, cfg);
+}
+
+static int uart_ti_hercules_config_get(const struct device *dev, struct uart_config *cfg)
+{
+	*cfg = DEV_DATA(dev)->uart_cfg;
+	return 0;
+}
+#endif /* CONFIG_UART_USE_RUNTIME_CONFIGURE */
+
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+static int uart_ti_hercules_fifo_fill(const struct device *dev, const uint8_t *tx_data, int len)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	int num_tx = 0;
+
+	/* No FIFO: the SCI holds a single character in TD */
+	while (num_tx < len && (regs->FLR & SCI_FLR_TXRDY) != 0U) {
+		regs->TD = tx_data[num_tx++];
+	}
+	return num_tx;
+}
+
+static int uart_ti_hercules_fifo_read(const struct device *dev, uint8_t *rx_data, const int size)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	int num_rx = 0;
+
+	while (num_rx < size && (regs->FLR & SCI_FLR_RXRDY) != 0U) {
+		rx_data[num_rx++] = (uint8_t)regs->RD;
+	}
+	return num_rx;
+}
+
+static void uart_ti_hercules_irq_tx_enable(const struct device *dev)
+{
+	DEV_REGS(dev)->SETINT = SCI_INT_TX;
+}
+
+static void uart_ti_hercules_irq_tx_disable(const struct device *dev)
+{
+	DEV_REGS(dev)->CLEARINT = SCI_INT_TX;
+}
+
+static int uart_ti_hercules_irq_tx_ready(const struct device *dev)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+
+	return (regs->SETINT & SCI_INT_TX) != 0U && (regs->FLR & SCI_FLR_TXRDY) != 0U;
+}
+
+static int uart_ti_hercules_irq_tx_complete(const struct device *dev)
+{
+	return (DEV_REGS(dev)->FLR & SCI_FLR_TXEMPTY) != 0U;
+}
+
+static void uart_ti_hercules_irq_rx_enable(const struct device *dev)
+{
+	DEV_REGS(dev)->SETINT = SCI_INT_RX;
+}
+
+static void uart_ti_hercules_irq_rx_disable(const struct device *dev)
+{
+	DEV_REGS(dev)->CLEARINT = SCI_INT_RX;
+}
+
+static int uart_ti_hercules_irq_rx_ready(const struct device *dev)
+{
+	return (DEV_REGS(dev)->FLR & SCI_FLR_RXRDY) != 0U;
+}
+
+static void uart_ti_hercules_irq_err_enable(const struct device *dev)
+{
+	DEV_REGS(dev)->SETINT = SCI_INT_ERRORS;
+}
+
+static void uart_ti_hercules_irq_err_disable(const struct device *dev)
+{
+	DEV_REGS(dev)->CLEARINT = SCI_INT_ERRORS;
+}
+
+static int uart_ti_hercules_irq_is_pending(const struct device *dev)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	uint32_t enabled = regs->SETINT;
+	uint32_t flr = regs->FLR;
+
+	return ((enabled & SCI_INT_TX) != 0U && (flr & SCI_FLR_TXRDY) != 0U) ||
+	       ((enabled & SCI_INT_RX) != 0U && (flr & SCI_FLR_RXRDY) != 0U) ||
+	       (enabled & flr & SCI_INT_ERRORS) != 0U;
+}
+
+static int uart_ti_hercules_irq_update(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+	return 1;
+}
+
+static void uart_ti_hercules_irq_callback_set(const struct device *dev,
+					      uart_irq_callback_user_data_t cb, void *cb_data)
+{
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+
+	data->irq_cb = cb;
+	data->irq_cb_data = cb_data;
+#ifdef CONFIG_UART_EXCLUSIVE_API_CALLBACKS
+	data->async.cb = NULL;
+	data->async.user_data = NULL;
+#endif
+}
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+
+#ifdef CONFIG_UART_ASYNC_API
+static void uart_ti_hercules_async_notify(struct uart_ti_hercules_async *async,
+					  struct uart_event *evt)
+{
+	if (async->cb != NULL) {
+		async->cb(async->uart, evt, async->user_data);
+	}
+}
+
+static int uart_ti_hercules_callback_set(const struct device *dev, uart_callback_t cb,
+					 void *user_data)
+{
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+
+	data->async.cb = cb;
+	data->async.user_data = user_data;
+#if defined(CONFIG_UART_EXCLUSIVE_API_CALLBACKS) && defined(CONFIG_UART_INTERRUPT_DRIVEN)
+	data->irq_cb = NULL;
+	data->irq_cb_data = NULL;
+#endif
+	return 0;
+}
+
+static void uart_ti_hercules_dma_tx_done(const struct device *dma_dev, void *user_data,
+					 uint32_t channel, int status)
+{
+	const struct device *dev = user_data;
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+	struct uart_event evt = {
+		.type = UART_TX_DONE,
+		.data.tx.buf = async->tx_buf,
+		.data.tx.len = async->tx_len,
+	};
+	k_spinlock_key_t key = k_spin_lock(&DEV_DATA(dev)->lock);
+
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(channel);
+	ARG_UNUSED(status);
+
+	DEV_REGS(dev)->CLEARINT = SCI_INT_TX_DMA;
+	k_work_cancel_delayable(&async->tx_timeout_work);
+	async->tx_buf = NULL;
+	async->tx_len = 0;
+	k_spin_unlock(&DEV_DATA(dev)->lock, key);
+
+	uart_ti_hercules_async_notify(async, &evt);
+}
+
+static int uart_ti_hercules_tx(const struct device *dev, const uint8_t *buf, size_t len,
+			       int32_t timeout)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	struct uart_ti_hercules_async *async = &data->async;
+	struct dma_block_config block = {
+		.source_address = (uint32_t)buf,
+		.dest_address = (uint32_t)&regs->TD,
+		.block_size = len,
+		.source_addr_adj = DMA_ADDR_ADJ_INCREMENT,
+		.dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE,
+	};
+	struct dma_config dma_cfg = {
+		.dma_slot = config->dma_tx.slot,
+		.channel_direction = MEMORY_TO_PERIPHERAL,
+		.source_data_size = 1,
+		.dest_data_size = 1,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &block,
+		.dma_callback = uart_ti_hercules_dma_tx_done,
+		.user_data = (void *)dev,
+	};
+	k_spinlock_key_t key;
+	int ret;
+
+	if (config->dma_tx.dev == NULL) {
+		return -ENODEV;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (async->tx_buf != NULL) {
+		k_spin_unlock(&data->lock, key);
+		return -EBUSY;
+	}
+
+	sys_cache_data_flush_range((void *)buf, len);
+	ret = dma_config(config->dma_tx.dev, config->dma_tx.channel, &dma_cfg);
+	if (ret == 0) {
+		async->tx_buf = buf;
+		async->tx_len = len;
+		ret = dma_start(config->dma_tx.dev, config->dma_tx.channel);
+	}
+	if (ret == 0) {
+		/* Every TXRDY now raises a DMA request instead of an interrupt */
+		regs->SETINT = SCI_INT_TX_DMA;
+		if (timeout != SYS_FOREVER_US) {
+			k_work_reschedule(&async->tx_timeout_work, K_USEC(timeout));
+		}
+	} else {
+		async->tx_buf = NULL;
+	}
+	k_spin_unlock(&data->lock, key);
+	return ret;
+}
+
+static int uart_ti_hercules_tx_abort(const struct device *dev)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	struct uart_ti_hercules_async *async = &data->async;
+	struct dma_status stat;
+	struct uart_event evt = {
+		.type = UART_TX_ABORTED,
+	};
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	if (async->tx_buf == NULL) {
+		k_spin_unlock(&data->lock, key);
+		return -EFAULT;
+	}
+
+	DEV_REGS(dev)->CLEARINT = SCI_INT_TX_DMA;
+	evt.data.tx.buf = async->tx_buf;
+	evt.data.tx.len = async->tx_len;
+	if (dma_get_status(config->dma_tx.dev, config->dma_tx.channel, &stat) == 0) {
+		evt.data.tx.len -= stat.pending_length;
+	}
+	dma_stop(config->dma_tx.dev, config->dma_tx.channel);
+	k_work_cancel_delayable(&async->tx_timeout_work);
+	async->tx_buf = NULL;
+	async->tx_len = 0;
+	k_spin_unlock(&data->lock, key);
+
+	uart_ti_hercules_async_notify(async, &evt);
+	return 0;
+}
+
+static void uart_ti_hercules_tx_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct uart_ti_hercules_async *async =
+		CONTAINER_OF(dwork, struct uart_ti_hercules_async, tx_timeout_work);
+
+	uart_ti_hercules_tx_abort(async->uart);
+}
+
+/*
+ * Report everything written into the current buffer since the last report.
+ * Called with the lock held, so it never races with a buffer switch.
+ */
+static void uart_ti_hercules_rx_flush(const struct device *dev)
+{
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+	struct uart_event evt = {
+		.type = UART_RX_RDY,
+		.data.rx.buf = async->rx_buf,
+		.data.rx.offset = async->rx_offset,
+	};
+
+	if (async->rx_counter > async->rx_offset) {
+		evt.data.rx.len = async->rx_counter - async->rx_offset;
+		sys_cache_data_invd_range(&async->rx_buf[async->rx_offset], evt.data.rx.len);
+		async->rx_offset = async->rx_counter;
+		uart_ti_hercules_async_notify(async, &evt);
+	}
+}
+
+/* Release the buffers of a receiver that was stopped and flushed under the lock */
+static void uart_ti_hercules_rx_disable_notify(const struct device *dev)
+{
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+	struct uart_event evt = {
+		.type = UART_RX_BUF_RELEASED,
+	};
+
+	if (async->rx_buf != NULL) {
+		evt.data.rx_buf.buf = async->rx_buf;
+		uart_ti_hercules_async_notify(async, &evt);
+		async->rx_buf = NULL;
+	}
+	if (async->rx_next_buf != NULL) {
+		evt.data.rx_buf.buf = async->rx_next_buf;
+		uart_ti_hercules_async_notify(async, &evt);
+		async->rx_next_buf = NULL;
+	}
+
+	evt.type = UART_RX_DISABLED;
+	uart_ti_hercules_async_notify(async, &evt);
+}
+
+static void uart_ti_hercules_dma_rx_done(const struct device *dma_dev, void *user_data,
+					 uint32_t channel, int status);
+
+/* Run the RX DMA on the rest of the current buffer, the queued buffer follows it */
+static int uart_ti_hercules_rx_dma_start(const struct device *dev)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+	struct dma_block_config block = {
+		.source_address = (uint32_t)&regs->RD,
+		.dest_address = (uint32_t)&async->rx_buf[async->rx_counter],
+		.block_size = async->rx_len - async->rx_counter,
+		.source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE,
+		.dest_addr_adj = DMA_ADDR_ADJ_INCREMENT,
+		.dest_reload_en = 1,
+	};
+	struct dma_config dma_cfg = {
+		.dma_slot = config->dma_rx.slot,
+		.channel_direction = PERIPHERAL_TO_MEMORY,
+		.source_data_size = 1,
+		.dest_data_size = 1,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &block,
+		.dma_callback = uart_ti_hercules_dma_rx_done,
+		.user_data = (void *)dev,
+	};
+	int ret;
+
+	ret = dma_config(config->dma_rx.dev, config->dma_rx.channel, &dma_cfg);
+	if (ret == 0) {
+		ret = dma_start(config->dma_rx.dev, config->dma_rx.channel);
+	}
+	if (ret == 0 && async->rx_next_buf != NULL) {
+		ret = dma_reload(config->dma_rx.dev, config->dma_rx.channel, (uint32_t)&regs->RD,
+				 (uint32_t)async->rx_next_buf, async->rx_next_len);
+	}
+	if (ret == 0) {
+		regs->SETINT = SCI_INT_RX_DMA | SCI_INT_RX_DMA_ALL;
+	}
+	return ret;
+}
+
+/*
+ * The current buffer is full: report it and move on to the queued buffer.
+ * Called with the lock held, returns the buffer to release, or NULL if no
+ * buffer was queued and the receiver stopped.
+ */
+static uint8_t *uart_ti_hercules_rx_switch(const struct device *dev)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+	uint8_t *released = async->rx_buf;
+
+	async->rx_counter = async->rx_len;
+	uart_ti_hercules_rx_flush(dev);
+
+	if (async->rx_next_buf == NULL) {
+		/*
+		 * Auto-initiation has already restarted the channel on the old
+		 * buffer; stop it before the next character lands.
+		 */
+		DEV_REGS(dev)->CLEARINT = SCI_INT_RX | SCI_INT_RX_DMA | SCI_INT_RX_DMA_ALL;
+		dma_stop(config->dma_rx.dev, config->dma_rx.channel);
+		async->rx_enabled = false;
+		k_work_cancel_delayable(&async->rx_timeout_work);
+		return NULL;
+	}
+
+	async->rx_buf = async->rx_next_buf;
+	async->rx_len = async->rx_next_len;
+	async->rx_offset = 0;
+	async->rx_counter = 0;
+	async->rx_next_buf = NULL;
+	async->rx_next_len = 0;
+	return released;
+}
+
+static void uart_ti_hercules_rx_switch_notify(const struct device *dev, uint8_t *released)
+{
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+	struct uart_event evt = {
+		.type = UART_RX_BUF_RELEASED,
+		.data.rx_buf.buf = released,
+	};
+
+	if (released == NULL) {
+		uart_ti_hercules_rx_disable_notify(dev);
+		return;
+	}
+
+	uart_ti_hercules_async_notify(async, &evt);
+	evt.type = UART_RX_BUF_REQUEST;
+	uart_ti_hercules_async_notify(async, &evt);
+}
+
+static void uart_ti_hercules_dma_rx_done(const struct device *dma_dev, void *user_data,
+					 uint32_t channel, int status)
+{
+	const struct device *dev = user_data;
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	uint8_t *released;
+
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(channel);
+	ARG_UNUSED(status);
+
+	if (!data->async.rx_enabled) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	/* The channel already runs on the queued buffer, if there is one */
+	released = uart_ti_hercules_rx_switch(dev);
+	k_spin_unlock(&data->lock, key);
+
+	uart_ti_hercules_rx_switch_notify(dev, released);
+}
+
+/*
+ * First character after an idle line, taken by the RX interrupt while the
+ * DMA is parked. The DMA continues behind it and the timeout is armed.
+ */
+static void uart_ti_hercules_rx_wake(const struct device *dev)
+{
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	struct uart_ti_hercules_async *async = &data->async;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	uint8_t *released = NULL;
+	bool full;
+	uint8_t c;
+
+	regs->CLEARINT = SCI_INT_RX;
+	c = (uint8_t)regs->RD;
+	if (!async->rx_enabled || !async->rx_idle) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	async->rx_idle = false;
+	async->rx_buf[async->rx_counter] = c;
+	/* Write the character back, the reports invalidate what the DMA wrote */
+	sys_cache_data_flush_range(&async->rx_buf[async->rx_counter], 1);
+	async->rx_counter++;
+
+	full = async->rx_counter == async->rx_len;
+	if (full) {
+		released = uart_ti_hercules_rx_switch(dev);
+	}
+	if (async->rx_enabled) {
+		if (uart_ti_hercules_rx_dma_start(dev) != 0) {
+			LOG_ERR("Failed to restart RX DMA");
+		}
+		k_work_reschedule(&async->rx_timeout_work, K_USEC(async->rx_timeout));
+	}
+	k_spin_unlock(&data->lock, key);
+
+	if (full) {
+		uart_ti_hercules_rx_switch_notify(dev, released);
+	}
+}
+
+static void uart_ti_hercules_rx_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct uart_ti_hercules_async *async =
+		CONTAINER_OF(dwork, struct uart_ti_hercules_async, rx_timeout_work);
+	const struct device *dev = async->uart;
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	struct dma_status stat;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	size_t counter;
+
+	if (!async->rx_enabled || async->rx_idle ||
+	    dma_get_status(config->dma_rx.dev, config->dma_rx.channel, &stat) != 0) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	/*
+	 * The DMA consumes every character, so the line is considered idle once
+	 * the write position has not moved for a whole timeout period. A full
+	 * buffer is left to the DMA completion.
+	 */
+	counter = async->rx_len - stat.pending_length;
+	if (counter != async->rx_counter || counter == async->rx_len ||
+	    (regs->FLR & SCI_FLR_IDLE) == 0U) {
+		async->rx_counter = counter;
+		k_work_reschedule(&async->rx_timeout_work, K_USEC(async->rx_timeout));
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	/*
+	 * Park the DMA and wait for the next character on the RX interrupt, so
+	 * the timeout only runs while data comes in.
+	 */
+	regs->CLEARINT = SCI_INT_RX_DMA | SCI_INT_RX_DMA_ALL;
+	if (dma_get_status(config->dma_rx.dev, config->dma_rx.channel, &stat) == 0 &&
+	    stat.busy) {
+		async->rx_counter = async->rx_len - stat.pending_length;
+	}
+	dma_stop(config->dma_rx.dev, config->dma_rx.channel);
+	async->rx_idle = true;
+	uart_ti_hercules_rx_flush(dev);
+	regs->SETINT = SCI_INT_RX;
+	k_spin_unlock(&data->lock, key);
+}
+
+static int uart_ti_hercules_rx_enable(const struct device *dev, uint8_t *buf, size_t len,
+				      int32_t timeout)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	struct uart_ti_hercules_async *async = &data->async;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (config->dma_rx.dev == NULL) {
+		return -ENODEV;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (async->rx_enabled) {
+		k_spin_unlock(&data->lock, key);
+		return -EBUSY;
+	}
+
+	/* No dirty line may be written back over what the DMA stores */
+	sys_cache_data_invd_range(buf, len);
+	async->rx_buf = buf;
+	async->rx_len = len;
+	async->rx_offset = 0;
+	async->rx_counter = 0;
+	async->rx_timeout = timeout;
+	(void)uart_ti_hercules_err_check(dev);
+
+	if (timeout != SYS_FOREVER_US) {
+		/* Idle until the first character arrives, see rx_wake */
+		async->rx_idle = true;
+		regs->SETINT = SCI_INT_RX;
+	} else {
+		async->rx_idle = false;
+		ret = uart_ti_hercules_rx_dma_start(dev);
+	}
+	if (ret == 0) {
+		async->rx_enabled = true;
+		regs->SETINT = SCI_INT_ERRORS;
+	}
+	k_spin_unlock(&data->lock, key);
+
+	if (ret == 0) {
+		struct uart_event evt = {
+			.type = UART_RX_BUF_REQUEST,
+		};
+
+		uart_ti_hercules_async_notify(async, &evt);
+	}
+	return ret;
+}
+
+static int uart_ti_hercules_rx_buf_rsp(const struct device *dev, uint8_t *buf, size_t len)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	struct uart_ti_hercules_async *async = &data->async;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	int ret = 0;
+
+	if (!async->rx_enabled) {
+		ret = -EACCES;
+	} else if (async->rx_next_buf != NULL) {
+		ret = -EBUSY;
+	} else {
+		sys_cache_data_invd_range(buf, len);
+		if (!async->rx_idle) {
+			/* Becomes the channel's next block on auto-initiation */
+			ret = dma_reload(config->dma_rx.dev, config->dma_rx.channel,
+					 (uint32_t)&DEV_REGS(dev)->RD, (uint32_t)buf, len);
+		}
+		if (ret == 0) {
+			async->rx_next_buf = buf;
+			async->rx_next_len = len;
+		}
+	}
+	k_spin_unlock(&data->lock, key);
+	return ret;
+}
+
+static int uart_ti_hercules_rx_disable(const struct device *dev)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+	struct uart_ti_hercules_async *async = &data->async;
+	struct dma_status stat;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	if (!async->rx_enabled) {
+		k_spin_unlock(&data->lock, key);
+		return -EFAULT;
+	}
+
+	DEV_REGS(dev)->CLEARINT =
+		SCI_INT_RX | SCI_INT_RX_DMA | SCI_INT_RX_DMA_ALL | SCI_INT_ERRORS;
+	if (!async->rx_idle &&
+	    dma_get_status(config->dma_rx.dev, config->dma_rx.channel, &stat) == 0 &&
+	    stat.busy) {
+		async->rx_counter = async->rx_len - stat.pending_length;
+	}
+	dma_stop(config->dma_rx.dev, config->dma_rx.channel);
+	k_work_cancel_delayable(&async->rx_timeout_work);
+	async->rx_enabled = false;
+	uart_ti_hercules_rx_flush(dev);
+	k_spin_unlock(&data->lock, key);
+
+	uart_ti_hercules_rx_disable_notify(dev);
+	return 0;
+}
+
+static void uart_ti_hercules_async_isr(const struct device *dev)
+{
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+	struct uart_event evt = {
+		.type = UART_RX_STOPPED,
+	};
+	uint32_t vect;
+
+	/* INTVECT0 returns the highest priority pending flag and clears it on read */
+	while ((vect = regs->INTVECT0 & 0x1FU) != 0U) {
+		switch (vect) {
+		case SCI_VECT_PE:
+			evt.data.rx_stop.reason = UART_ERROR_PARITY;
+			break;
+		case SCI_VECT_FE:
+			evt.data.rx_stop.reason = UART_ERROR_FRAMING;
+			break;
+		case SCI_VECT_BRKDT:
+			evt.data.rx_stop.reason = UART_BREAK;
+			break;
+		case SCI_VECT_OE:
+			evt.data.rx_stop.reason = UART_ERROR_OVERRUN;
+			break;
+		case SCI_VECT_RX:
+			uart_ti_hercules_rx_wake(dev);
+			continue;
+		default:
+			continue;
+		}
+
+		if (async->rx_enabled) {
+			evt.data.rx_stop.data.buf = async->rx_buf;
+			evt.data.rx_stop.data.offset = async->rx_offset;
+			evt.data.rx_stop.data.len = 0;
+			uart_ti_hercules_async_notify(async, &evt);
+			uart_ti_hercules_rx_disable(dev);
+		}
+	}
+}
+
+static int uart_ti_hercules_async_init(const struct device *dev)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	struct uart_ti_hercules_async *async = &DEV_DATA(dev)->async;
+
+	if ((config->dma_tx.dev != NULL && !device_is_ready(config->dma_tx.dev)) ||
+	    (config->dma_rx.dev != NULL && !device_is_ready(config->dma_rx.dev))) {
+		return -ENODEV;
+	}
+
+	async->uart = dev;
+	k_work_init_delayable(&async->tx_timeout_work, uart_ti_hercules_tx_timeout);
+	k_work_init_delayable(&async->rx_timeout_work, uart_ti_hercules_rx_timeout);
+	return 0;
+}
+#endif /* CONFIG_UART_ASYNC_API */
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+static void uart_ti_hercules_isr(const struct device *dev)
+{
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	struct uart_ti_hercules_data *data = DEV_DATA(dev);
+
+	if (data->irq_cb != NULL) {
+		data->irq_cb(dev, data->irq_cb_data);
+		return;
+	}
+#endif
+#ifdef CONFIG_UART_ASYNC_API
+	uart_ti_hercules_async_isr(dev);
+#endif
+}
+#endif
+
+static int uart_ti_hercules_init(const struct device *dev)
+{
+	const struct uart_ti_hercules_config *config = DEV_CFG(dev);
+	volatile struct hercules_sci_regs *regs = DEV_REGS(dev);
+	int ret;
+
+	if (!device_is_ready(config->clk_dev)) {
+		return -ENODEV;
+	}
+
+	/* Bring the module out of reset with every interrupt disabled on line 0 */
+	regs->GCR0 = 0;
+	regs->GCR0 = 1;
+	regs->CLEARINT = UINT32_MAX;
+	regs->CLRINTLVL = UINT32_MAX;
+
+	ret = uart_ti_hercules_set_config(dev, &DEV_DATA(dev)->uart_cfg);
+	if (ret != 0) {
+		return ret;
+	}
+
+#ifdef CONFIG_UART_ASYNC_API
+	ret = uart_ti_hercules_async_init(dev);
+	if (ret != 0) {
+		return ret;
+	}
+#endif
+
+	if (config->irq_config_func != NULL) {
+		config->irq_config_func(dev);
+	}
+	return 0;
+}
+
+static DEVICE_API(uart, uart_ti_hercules_api) = {
+	.poll_in = uart_ti_hercules_poll_in,
+	.poll_out = uart_ti_hercules_poll_out,
+	.err_check = uart_ti_hercules_err_check,
+#ifdef CONFIG_UART_USE_RUNTIME_CONFIGURE
+	.configure = uart_ti_hercules_configure,
+	.config_get = uart_ti_hercules_config_get,
+#endif
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	.fifo_fill = uart_ti_hercules_fifo_fill,
+	.fifo_read = uart_ti_hercules_fifo_read,
+	.irq_tx_enable = uart_ti_hercules_irq_tx_enable,
+	.irq_tx_disable = uart_ti_hercules_irq_tx_disable,
+	.irq_tx_ready = uart_ti_hercules_irq_tx_ready,
+	.irq_tx_complete = uart_ti_hercules_irq_tx_complete,
+	.irq_rx_enable = uart_ti_hercules_irq_rx_enable,
+	.irq_rx_disable = uart_ti_hercules_irq_rx_disable,
+	.irq_rx_ready = uart_ti_hercules_irq_rx_ready,
+	.irq_err_enable = uart_ti_hercules_irq_err_enable,
+	.irq_err_disable = uart_ti_hercules_irq_err_disable,
+	.irq_is_pending = uart_ti_hercules_irq_is_pending,
+	.irq_update = uart_ti_hercules_irq_update,
+	.irq_callback_set = uart_ti_hercules_irq_callback_set,
+#endif
+#ifdef CONFIG_UART_ASYNC_API
+	.callback_set = uart_ti_hercules_callback_set,
+	.tx = uart_ti_hercules_tx,
+	.tx_abort = uart_ti_hercules_tx_abort,
+	.rx_enable = uart_ti_hercules_rx_enable,
+	.rx_buf_rsp = uart_ti_hercules_rx_buf_rsp,
+	.rx_disable = uart_ti_hercules_rx_disable,
+#endif
+};
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+#define UART_TI_HERCULES_IRQ_CONFIG(n)                                                             \
+	static void uart_ti_hercules_irq_config_##n(const struct device *dev)                      \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority), uart_ti_hercules_isr,  \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ(n, type));                          \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}
+#define UART_TI_HERCULES_IRQ_CONFIG_FUNC(n) uart_ti_hercules_irq_config_##n
+#else
+#define UART_TI_HERCULES_IRQ_CONFIG(n)
+#define UART_TI_HERCULES_IRQ_CONFIG_FUNC(n) NULL
+#endif
+
+#ifdef CONFIG_UART_ASYNC_API
+#define UART_TI_HERCULES_DMA(n, dir)                                                               \
+	.dma_##dir = COND_CODE_1(DT_INST_DMAS_HAS_NAME(n, dir),                                    \
+		({                                                                                 \
+			.dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(n, dir)),                   \
+			.channel = DT_INST_DMAS_CELL_BY_NAME(n, dir, channel),                     \
+			.slot = DT_INST_DMAS_CELL_BY_NAME(n, dir, slot),                           \
+		}),                                                                                \
+		({0})),
+#else
+#define UART_TI_HERCULES_DMA(n, dir)
+#endif
+
+#define UART_TI_HERCULES_INIT(n)                                                                   \
+	UART_TI_HERCULES_IRQ_CONFIG(n)                                                             \
+	static const struct uart_ti_hercules_config uart_ti_hercules_config_##n = {               \
+		.base = DT_INST_REG_ADDR(n),                                                       \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.irq_config_func = UART_TI_HERCULES_IRQ_CONFIG_FUNC(n),                            \
+		UART_TI_HERCULES_DMA(n, tx) UART_TI_HERCULES_DMA(n, rx)};                          \
+	static struct uart_ti_hercules_data uart_ti_hercules_data_##n = {                         \
+		.uart_cfg =                                                                        \
+			{                                                                          \
+				.baudrate = DT_INST_PROP(n, current_speed),                        \
+				.parity = DT_INST_ENUM_IDX_OR(n, parity, UART_CFG_PARITY_NONE),    \
+				.stop_bits = DT_INST_ENUM_IDX_OR(n, stop_bits,                     \
+								 UART_CFG_STOP_BITS_1),            \
+				.data_bits = DT_INST_ENUM_IDX_OR(n, data_bits,                     \
+								 UART_CFG_DATA_BITS_8),            \
+				.flow_ctrl = UART_CFG_FLOW_CTRL_NONE,                              \
+			},                                                                         \
+	};                                                                                         \
+	DEVICE_DT_INST_DEFINE(n, uart_ti_hercules_init, NULL, &uart_ti_hercules_data_##n,          \
+			      &uart_ti_hercules_config_##n, PRE_KERNEL_1,                          \
+			      CONFIG_SERIAL_INIT_PRIORITY, &uart_ti_hercules_api);
+
+DT_INST_FOREACH_STATUS_OKAY(UART_TI_HERCULES_INIT)
@@ -0,0 +1,756 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_mibspi
+
+#include <soc.h>
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/spi/ti_hercules_mibspi.h>
+#include <zephyr/irq.h>
+#include <zephyr/sys/byteorder.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(spi_ti_hercules_mibspi, CONFIG_SPI_LOG_LEVEL);
+
+#include "spi_context.h"
+
+#define MIBSPI_BUFFERS 128U
+#define MIBSPI_FORMATS TI_HERCULES_MIBSPI_FORMATS
+
+#define SPI_GCR1_MASTER   BIT(0)
+#define SPI_GCR1_CLKMOD   BIT(1)
+#define SPI_GCR1_LOOPBACK BIT(16)
+#define SPI_GCR1_SPIEN    BIT(24)
+
+#define SPI_FLG_BUFINITACTIVE BIT(24)
+
+#define SPI_PC0_SCS(mask) ((mask) & 0xFFU)
+#define SPI_PC0_CLK       BIT(9)
+#define SPI_PC0_SIMO      BIT(10)
+#define SPI_PC0_SOMI      BIT(11)
+
+#define SPI_FMT_CHARLEN(n)  ((n) & 0x1FU)
+#define SPI_FMT_PRESCALE(n) (((n) & 0xFFU) << 8)
+#define SPI_FMT_PHASE       BIT(16)
+#define SPI_FMT_POLARITY    BIT(17)
+#define SPI_FMT_SHIFTDIR    BIT(20)
+
+#define SPI_MIBSPIE_MSPIENA BIT(0)
+
+#define SPI_TGCTRL_TGENA          BIT(31)
+#define SPI_TGCTRL_ONESHOT        BIT(30)
+#define SPI_TGCTRL_TRIGEVT_ALWAYS (0x7U << 20)
+#define SPI_TGCTRL_PSTART(n)      (((n) & 0x7FU) << 8)
+#define SPI_LTGPEND(n)            (((n) & 0x7FU) << 8)
+#define SPI_TGINT_COMPLETE(tg)    BIT(16 + (tg))
+
+#define SPI_DMACTRL_ONESHOT  BIT(31)
+#define SPI_DMACTRL_BUFID(n) (((n) & 0x7FU) << 24)
+#define SPI_DMACTRL_RXMAP(n) (((n) & 0xFU) << 20)
+#define SPI_DMACTRL_TXMAP(n) (((n) & 0xFU) << 16)
+#define SPI_DMACTRL_RXDMAENA BIT(15)
+#define SPI_DMACTRL_TXDMAENA BIT(14)
+#define SPI_DMACNTLEN_LARGE  BIT(0)
+#define SPI_ICOUNT(n)        (((n) & 0xFFFFU) << 16)
+/* Limited by the 13 bit frame counter of the DMA controller */
+#define SPI_DMA_MAX_WORDS    0x1FFFU
+
+/* MibSPIx[0] and MibSPIx[1] are the request lines routed to the DMA module */
+#define SPI_DMA_TX_LINE 0U
+#define SPI_DMA_RX_LINE 1U
+
+/* Buffer RAM control field, bits 31:16 of a TX word */
+#define MIBSPI_TX_BUFMODE_NORMAL (0x4U << 29)
+#define MIBSPI_TX_CSHOLD         BIT(28)
+#define MIBSPI_TX_DFSEL(n)       (((n) & 0x3U) << 24)
+#define MIBSPI_TX_CSNR(cs)       ((~BIT(cs) & 0xFFU) << 16)
+#define MIBSPI_TX_CSNR_NONE      (0xFFU << 16)
+
+/* Buffer RAM status field, bits 31:16 of an RX word */
+#define MIBSPI_RX_ERRORS (BIT(30) | GENMASK(28, 24))
+
+#define MIBSPI_TG_SEQUENCE 0U
+
+struct hercules_mibspi_regs {
+	uint32_t GCR0;         /* 0x0000 */
+	uint32_t GCR1;         /* 0x0004 */
+	uint32_t INT0;         /* 0x0008 */
+	uint32_t LVL;          /* 0x000C */
+	uint32_t FLG;          /* 0x0010 */
+	uint32_t PC0;          /* 0x0014 */
+	uint32_t PC1;          /* 0x0018 */
+	uint32_t PC2;          /* 0x001C */
+	uint32_t PC3;          /* 0x0020 */
+	uint32_t PC4;          /* 0x0024 */
+	uint32_t PC5;          /* 0x0028 */
+	uint32_t PC6;          /* 0x002C */
+	uint32_t PC7;          /* 0x0030 */
+	uint32_t PC8;          /* 0x0034 */
+	uint32_t DAT0;         /* 0x0038 */
+	uint32_t DAT1;         /* 0x003C */
+	uint32_t BUF;          /* 0x0040 */
+	uint32_t EMU;          /* 0x0044 */
+	uint32_t DELAY;        /* 0x0048 */
+	uint32_t DEF;          /* 0x004C */
+	uint32_t FMT[4];       /* 0x0050 */
+	uint32_t INTVECT0;     /* 0x0060 */
+	uint32_t INTVECT1;     /* 0x0064 */
+	uint32_t SRSEL;        /* 0x0068 */
+	uint32_t PMCTRL;       /* 0x006C */
+	uint32_t MIBSPIE;      /* 0x0070 */
+	uint32_t TGITENST;     /* 0x0074 */
+	uint32_t TGITENCR;     /* 0x0078 */
+	uint32_t TGITLVST;     /* 0x007C */
+	uint32_t TGITLVCR;     /* 0x0080 */
+	uint32_t TGINTFLG;     /* 0x0084 */
+	uint32_t rsvd1[2];     /* 0x0088 */
+	uint32_t TICKCNT;      /* 0x0090 */
+	uint32_t LTGPEND;      /* 0x0094 */
+	uint32_t TGCTRL[16];   /* 0x0098 */
+	uint32_t DMACTRL[8];   /* 0x00D8 */
+	uint32_t ICOUNT[8];    /* 0x00F8 */
+	uint32_t DMACNTLEN;    /* 0x0118 */
+};
+
+struct hercules_mibspi_ram {
+	uint32_t TX[MIBSPI_BUFFERS]; /* 0x0000 */
+	uint32_t RX[MIBSPI_BUFFERS]; /* 0x0200 */
+};
+
+#ifdef CONFIG_DMA_TI_HERCULES
+struct spi_ti_hercules_mibspi_dma {
+	const struct device *dev;
+	uint32_t channel;
+	uint32_t slot;
+};
+#endif
+
+struct spi_ti_hercules_mibspi_config {
+	uintptr_t base;
+	uintptr_t ram;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	uint8_t hw_cs_mask;
+	void (*irq_config_func)(const struct device *dev);
+#ifdef CONFIG_DMA_TI_HERCULES
+	struct spi_ti_hercules_mibspi_dma dma_tx;
+	struct spi_ti_hercules_mibspi_dma dma_rx;
+#endif
+};
+
+struct spi_ti_hercules_mibspi_data {
+	struct spi_context ctx;
+	/* spi_config last programmed into each SPIFMTx register */
+	const struct spi_config *fmt_cfg[MIBSPI_FORMATS];
+	uint8_t fmt_next;
+	/* Current transfer */
+	uint8_t fmt;
+	uint8_t dfs;
+	uint32_t csnr;
+	size_t words;
+	bool dma;
+	/* Raw frame sequence, bypasses spi_context buffers */
+	struct ti_hercules_mibspi_frame *seq;
+	int seq_status;
+};
+
+#define DEV_CFG(dev)  ((const struct spi_ti_hercules_mibspi_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct spi_ti_hercules_mibspi_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_mibspi_regs *)DEV_CFG(dev)->base)
+#define DEV_RAM(dev)  ((volatile struct hercules_mibspi_ram *)DEV_CFG(dev)->ram)
+
+static int spi_ti_hercules_mibspi_fmt(const struct device *dev, const struct spi_config *config,
+				      uint32_t *fmt)
+{
+	const struct spi_ti_hercules_mibspi_config *cfg = DEV_CFG(dev);
+	uint32_t word_size = SPI_WORD_SIZE_GET(config->operation);
+	uint32_t vclk, prescale;
+	int ret;
+
+	if (SPI_OP_MODE_GET(config->operation) != SPI_OP_MODE_MASTER) {
+		return -ENOTSUP;
+	}
+	if (IS_ENABLED(CONFIG_SPI_EXTENDED_MODES) &&
+	    (config->operation & SPI_LINES_MASK) != SPI_LINES_SINGLE) {
+		return -ENOTSUP;
+	}
+	if (!IN_RANGE(word_size, 2, 16) || config->frequency == 0U) {
+		return -EINVAL;
+	}
+
+	ret = clock_control_get_rate(cfg->clk_dev, (clock_control_subsys_t)&cfg->clk, &vclk);
+	if (ret != 0) {
+		return ret;
+	}
+
+	/* SPICLK = VCLK / (PRESCALE + 1), rounded down to the requested rate */
+	prescale = CLAMP(DIV_ROUND_UP(vclk, config->frequency), 2U, 256U) - 1U;
+
+	*fmt = SPI_FMT_CHARLEN(word_size) | SPI_FMT_PRESCALE(prescale);
+	/* PHASE shifts data out half a cycle early, which is CPHA = 0 */
+	if ((SPI_MODE_GET(config->operation) & SPI_MODE_CPHA) == 0U) {
+		*fmt |= SPI_FMT_PHASE;
+	}
+	if ((SPI_MODE_GET(config->operation) & SPI_MODE_CPOL) != 0U) {
+		*fmt |= SPI_FMT_POLARITY;
+	}
+	if ((config->operation & SPI_TRANSFER_LSB) != 0U) {
+		*fmt |= SPI_FMT_SHIFTDIR;
+	}
+	return 0;
+}
+
+static void spi_ti_hercules_mibspi_write_fmt(const struct device *dev, uint8_t slot, uint32_t fmt,
+					     bool loopback)
+{
+	volatile struct hercules_mibspi_regs *regs = DEV_REGS(dev);
+
+	/* Formats are only reprogrammed while no transfer group is running */
+	regs->GCR1 &= ~SPI_GCR1_SPIEN;
+	regs->FMT[slot] = fmt;
+	if (loopback) {
+		regs->GCR1 |= SPI_GCR1_LOOPBACK;
+	} else {
+		regs->GCR1 &= ~SPI_GCR1_LOOPBACK;
+	}
+	regs->GCR1 |= SPI_GCR1_SPIEN;
+}
+
+static int spi_ti_hercules_mibspi_configure(const struct device *dev,
+					    const struct spi_config *config)
+{
+	const struct spi_ti_hercules_mibspi_config *cfg = DEV_CFG(dev);
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	uint32_t fmt;
+	uint8_t slot;
+	int ret;
+
+	if (spi_cs_is_gpio(config)) {
+		data->csnr = MIBSPI_TX_CSNR_NONE;
+	} else if (config->slave < 8U && (cfg->hw_cs_mask & BIT(config->slave)) != 0U) {
+		data->csnr = MIBSPI_TX_CSNR(config->slave);
+	} else {
+		return -EINVAL;
+	}
+
+	data->dfs = SPI_WORD_SIZE_GET(config->operation) > 8U ? 2U : 1U;
+	data->ctx.config = config;
+
+	/* Keep up to four configurations resident in SPIFMT0..3 */
+	for (slot = 0; slot < MIBSPI_FORMATS; slot++) {
+		if (data->fmt_cfg[slot] == config) {
+			data->fmt = slot;
+			return 0;
+		}
+	}
+
+	ret = spi_ti_hercules_mibspi_fmt(dev, config, &fmt);
+	if (ret != 0) {
+		return ret;
+	}
+
+	slot = data->fmt_next;
+	data->fmt_next = (data->fmt_next + 1U) % MIBSPI_FORMATS;
+	spi_ti_hercules_mibspi_write_fmt(dev, slot, fmt,
+					 (SPI_MODE_GET(config->operation) & SPI_MODE_LOOP) != 0U);
+	data->fmt_cfg[slot] = config;
+	data->fmt = slot;
+	return 0;
+}
+
+/* Run buffers 0..count-1 of the buffer RAM as transfer group 0. */
+static void spi_ti_hercules_mibspi_start_tg(const struct device *dev, size_t count)
+{
+	volatile struct hercules_mibspi_regs *regs = DEV_REGS(dev);
+
+	regs->TGCTRL[MIBSPI_TG_SEQUENCE] = 0;
+	regs->TGCTRL[MIBSPI_TG_SEQUENCE + 1] = SPI_TGCTRL_PSTART(count);
+	regs->LTGPEND = SPI_LTGPEND(count - 1U);
+	regs->TGINTFLG = SPI_TGINT_COMPLETE(MIBSPI_TG_SEQUENCE);
+	regs->TGITENST = SPI_TGINT_COMPLETE(MIBSPI_TG_SEQUENCE);
+	regs->TGCTRL[MIBSPI_TG_SEQUENCE] = SPI_TGCTRL_TGENA | SPI_TGCTRL_ONESHOT |
+					   SPI_TGCTRL_TRIGEVT_ALWAYS | SPI_TGCTRL_PSTART(0);
+}
+
+/* True if the next @p count words end both the TX and the RX buffer sets. */
+static bool spi_ti_hercules_mibspi_is_last(const struct spi_context *ctx, size_t count)
+{
+	return ctx->tx_count <= 1U && ctx->tx_len <= count && ctx->rx_count <= 1U &&
+	       ctx->rx_len <= count;
+}
+
+static void spi_ti_hercules_mibspi_load(const struct device *dev, size_t count)
+{
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibspi_ram *ram = DEV_RAM(dev);
+	struct spi_context *ctx = &data->ctx;
+	uint32_t ctrl = MIBSPI_TX_BUFMODE_NORMAL | MIBSPI_TX_CSHOLD | MIBSPI_TX_DFSEL(data->fmt) |
+			data->csnr;
+	uint16_t word = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		if (spi_context_tx_buf_on(ctx) && data->dfs == 2U) {
+			word = sys_get_le16(&ctx->tx_buf[2 * i]);
+		} else if (spi_context_tx_buf_on(ctx)) {
+			word = ctx->tx_buf[i];
+		}
+		if (i == count - 1U && spi_ti_hercules_mibspi_is_last(ctx, count) &&
+		    (ctx->config->operation & SPI_HOLD_ON_CS) == 0U) {
+			/* Release the hardware chip select after the last word */
+			ctrl &= ~MIBSPI_TX_CSHOLD;
+		}
+		ram->TX[i] = ctrl | word;
+	}
+}
+
+static int spi_ti_hercules_mibspi_unload(const struct device *dev, size_t count)
+{
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibspi_ram *ram = DEV_RAM(dev);
+	struct spi_context *ctx = &data->ctx;
+	uint32_t status = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		uint32_t rx = ram->RX[i];
+
+		status |= rx;
+		if (!spi_context_rx_buf_on(ctx)) {
+			continue;
+		}
+		if (data->dfs == 2U) {
+			sys_put_le16((uint16_t)rx, &ctx->rx_buf[2 * i]);
+		} else {
+			ctx->rx_buf[i] = (uint8_t)rx;
+		}
+	}
+	return (status & MIBSPI_RX_ERRORS) != 0U ? -EIO : 0;
+}
+
+#ifdef CONFIG_DMA_TI_HERCULES
+static const uint16_t mibspi_dma_zero;
+static uint16_t mibspi_dma_discard;
+
+static void spi_ti_hercules_mibspi_next(const struct device *dev);
+
+static void spi_ti_hercules_mibspi_dma_done(const struct device *dma_dev, void *user_data,
+					    uint32_t channel, int status)
+{
+	const struct device *dev = user_data;
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibspi_regs *regs = DEV_REGS(dev);
+
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(channel);
+
+	regs->TGCTRL[MIBSPI_TG_SEQUENCE] = 0;
+	regs->DMACTRL[0] = 0;
+	data->dma = false;
+
+	if (status < 0) {
+		spi_context_cs_control(&data->ctx, false);
+		spi_context_complete(&data->ctx, dev, -EIO);
+		return;
+	}
+
+	if (spi_context_rx_buf_on(&data->ctx)) {
+		sys_cache_data_invd_range(data->ctx.rx_buf, data->words * data->dfs);
+	}
+	spi_context_update_tx(&data->ctx, data->dfs, data->words);
+	spi_context_update_rx(&data->ctx, data->dfs, data->words);
+	spi_ti_hercules_mibspi_next(dev);
+}
+
+/*
+ * Stream @p count words through buffer 0: the MibSPI repeats the buffer
+ * ICOUNT + 1 times and raises a TX DMA request to refill and an RX DMA
+ * request to drain it around every word. Completion is signalled by the RX
+ * channel.
+ */
+static int spi_ti_hercules_mibspi_start_dma(const struct device *dev, size_t count)
+{
+	const struct spi_ti_hercules_mibspi_config *cfg = DEV_CFG(dev);
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibspi_regs *regs = DEV_REGS(dev);
+	volatile struct hercules_mibspi_ram *ram = DEV_RAM(dev);
+	struct spi_context *ctx = &data->ctx;
+	bool tx_on = spi_context_tx_buf_on(ctx);
+	bool rx_on = spi_context_rx_buf_on(ctx);
+	struct dma_block_config tx_block = {
+		.source_address = tx_on ? (uint32_t)ctx->tx_buf : (uint32_t)&mibspi_dma_zero,
+		.dest_address = (uint32_t)&ram->TX[0],
+		.block_size = count * data->dfs,
+		.source_addr_adj = tx_on ? DMA_ADDR_ADJ_INCREMENT : DMA_ADDR_ADJ_NO_CHANGE,
+		.dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE,
+	};
+	struct dma_block_config rx_block = {
+		.source_address = (uint32_t)&ram->RX[0],
+		.dest_address = rx_on ? (uint32_t)ctx->rx_buf : (uint32_t)&mibspi_dma_discard,
+		.block_size = count * data->dfs,
+		.source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE,
+		.dest_addr_adj = rx_on ? DMA_ADDR_ADJ_INCREMENT : DMA_ADDR_ADJ_NO_CHANGE,
+	};
+	struct dma_config tx_cfg = {
+		.dma_slot = cfg->dma_tx.slot,
+		.channel_direction = MEMORY_TO_PERIPHERAL,
+		.source_data_size = data->dfs,
+		.dest_data_size = data->dfs,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &tx_block,
+	};
+	struct dma_config rx_cfg = {
+		.dma_slot = cfg->dma_rx.slot,
+		.channel_direction = PERIPHERAL_TO_MEMORY,
+		.source_data_size = data->dfs,
+		.dest_data_size = data->dfs,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &rx_block,
+		.dma_callback = spi_ti_hercules_mibspi_dma_done,
+		.user_data = (void *)dev,
+	};
+	int ret;
+
+	if (tx_on) {
+		sys_cache_data_flush_range((void *)ctx->tx_buf, count * data->dfs);
+	}
+	if (rx_on) {
+		/* No dirty line may be written back over what the DMA stores */
+		sys_cache_data_invd_range(ctx->rx_buf, count * data->dfs);
+	}
+
+	ret = dma_config(cfg->dma_tx.dev, cfg->dma_tx.channel, &tx_cfg);
+	if (ret == 0) {
+		ret = dma_config(cfg->dma_rx.dev, cfg->dma_rx.channel, &rx_cfg);
+	}
+	if (ret != 0) {
+		return ret;
+	}
+
+	/* Buffer 0 keeps the chip select asserted, the last word goes through the RAM path */
+	ram->TX[0] = MIBSPI_TX_BUFMODE_NORMAL | MIBSPI_TX_CSHOLD | MIBSPI_TX_DFSEL(data->fmt) |
+		     data->csnr;
+	regs->DMACNTLEN = SPI_DMACNTLEN_LARGE;
+	regs->ICOUNT[0] = SPI_ICOUNT(count - 1U);
+	regs->DMACTRL[0] = SPI_DMACTRL_ONESHOT | SPI_DMACTRL_BUFID(0) |
+			   SPI_DMACTRL_RXMAP(SPI_DMA_RX_LINE) | SPI_DMACTRL_TXMAP(SPI_DMA_TX_LINE) |
+			   SPI_DMACTRL_RXDMAENA | SPI_DMACTRL_TXDMAENA;
+
+	data->words = count;
+	data->dma = true;
+	dma_start(cfg->dma_rx.dev, cfg->dma_rx.channel);
+	dma_start(cfg->dma_tx.dev, cfg->dma_tx.channel);
+
+	regs->TGITENCR = SPI_TGINT_COMPLETE(MIBSPI_TG_SEQUENCE);
+	regs->TGCTRL[MIBSPI_TG_SEQUENCE + 1] = SPI_TGCTRL_PSTART(1);
+	regs->LTGPEND = SPI_LTGPEND(0);
+	regs->TGCTRL[MIBSPI_TG_SEQUENCE] =
+		SPI_TGCTRL_TGENA | SPI_TGCTRL_TRIGEVT_ALWAYS | SPI_TGCTRL_PSTART(0);
+	return 0;
+}
+#endif /* CONFIG_DMA_TI_HERCULES */
+
+static void spi_ti_hercules_mibspi_next(const struct device *dev)
+{
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	struct spi_context *ctx = &data->ctx;
+	size_t words = spi_context_max_continuous_chunk(ctx);
+
+	if (words == 0U) {
+		spi_context_cs_control(ctx, false);
+		spi_context_complete(ctx, dev, 0);
+		return;
+	}
+
+#ifdef CONFIG_DMA_TI_HERCULES
+	if (DEV_CFG(dev)->dma_tx.dev != NULL && words > MIBSPI_BUFFERS) {
+		int ret = spi_ti_hercules_mibspi_start_dma(dev, MIN(words - 1U, SPI_DMA_MAX_WORDS));
+
+		if (ret != 0) {
+			spi_context_cs_control(ctx, false);
+			spi_context_complete(ctx, dev, ret);
+		}
+		return;
+	}
+#endif
+
+	/* Without DMA the CPU refills the buffer RAM once per group of 128 words */
+	data->words = MIN(words, MIBSPI_BUFFERS);
+	spi_ti_hercules_mibspi_load(dev, data->words);
+	spi_ti_hercules_mibspi_start_tg(dev, data->words);
+}
+
+static void spi_ti_hercules_mibspi_tg_done(const struct device *dev)
+{
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibspi_ram *ram = DEV_RAM(dev);
+	int ret;
+
+	if (data->seq != NULL) {
+		for (size_t i = 0; i < data->words; i++) {
+			uint32_t rx = ram->RX[i];
+
+			data->seq[i].rx = (uint16_t)rx;
+			if ((rx & MIBSPI_RX_ERRORS) != 0U) {
+				data->seq_status = -EIO;
+			}
+		}
+		spi_context_complete(&data->ctx, dev, 0);
+		return;
+	}
+
+	ret = spi_ti_hercules_mibspi_unload(dev, data->words);
+	if (ret != 0) {
+		spi_context_cs_control(&data->ctx, false);
+		spi_context_complete(&data->ctx, dev, ret);
+		return;
+	}
+
+	if (spi_context_rx_buf_on(&data->ctx)) {
+		sys_cache_data_invd_range(data->ctx.rx_buf, data->words * data->dfs);
+	}
+	spi_context_update_tx(&data->ctx, data->dfs, data->words);
+	spi_context_update_rx(&data->ctx, data->dfs, data->words);
+	spi_ti_hercules_mibspi_next(dev);
+}
+
+static void spi_ti_hercules_mibspi_isr(const struct device *dev)
+{
+	volatile struct hercules_mibspi_regs *regs = DEV_REGS(dev);
+	uint32_t vect;
+
+	/*
+	 * INTVECT0 holds the highest priority pending transfer group (plus one)
+	 * in bits 5:1, reading it clears the group's TGINTFLG bit.
+	 */
+	while ((vect = (regs->INTVECT0 >> 1) & 0x1FU) != 0U) {
+		if (vect == MIBSPI_TG_SEQUENCE + 1U) {
+			spi_ti_hercules_mibspi_tg_done(dev);
+		}
+	}
+}
+
+static int transceive(const struct device *dev, const struct spi_config *config,
+		      const struct spi_buf_set *tx_bufs, const struct spi_buf_set *rx_bufs,
+		      bool asynchronous, spi_callback_t cb, void *userdata)
+{
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	int ret;
+
+	spi_context_lock(&data->ctx, asynchronous, cb, userdata, config);
+
+	ret = spi_ti_hercules_mibspi_configure(dev, config);
+	if (ret != 0) {
+		spi_context_release(&data->ctx, ret);
+		return ret;
+	}
+
+	spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, data->dfs);
+	spi_context_cs_control(&data->ctx, true);
+	spi_ti_hercules_mibspi_next(dev);
+
+	ret = spi_context_wait_for_completion(&data->ctx);
+	spi_context_release(&data->ctx, ret);
+	return ret;
+}
+
+static int spi_ti_hercules_mibspi_transceive(const struct device *dev,
+					     const struct spi_config *config,
+					     const struct spi_buf_set *tx_bufs,
+					     const struct spi_buf_set *rx_bufs)
+{
+	return transceive(dev, config, tx_bufs, rx_bufs, false, NULL, NULL);
+}
+
+#ifdef CONFIG_SPI_ASYNC
+static int spi_ti_hercules_mibspi_transceive_async(const struct device *dev,
+						   const struct spi_config *config,
+						   const struct spi_buf_set *tx_bufs,
+						   const struct spi_buf_set *rx_bufs,
+						   spi_callback_t cb, void *userdata)
+{
+	return transceive(dev, config, tx_bufs, rx_bufs, true, cb, userdata);
+}
+#endif /* CONFIG_SPI_ASYNC */
+
+static int spi_ti_hercules_mibspi_release(const struct device *dev,
+					  const struct spi_config *config)
+{
+	ARG_UNUSED(config);
+
+	spi_context_unlock_unconditionally(&DEV_DATA(dev)->ctx);
+	return 0;
+}
+
+int ti_hercules_mibspi_sequence(const struct device *dev, const struct spi_config *formats,
+				size_t num_formats, struct ti_hercules_mibspi_frame *frames,
+				size_t num_frames)
+{
+	const struct spi_ti_hercules_mibspi_config *cfg = DEV_CFG(dev);
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibspi_ram *ram = DEV_RAM(dev);
+	uint32_t fmt[MIBSPI_FORMATS];
+	int ret = 0;
+
+	if (num_formats == 0U || num_formats > MIBSPI_FORMATS || num_frames == 0U) {
+		return -EINVAL;
+	}
+	for (size_t i = 0; i < num_formats; i++) {
+		ret = spi_ti_hercules_mibspi_fmt(dev, &formats[i], &fmt[i]);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+	for (size_t i = 0; i < num_frames; i++) {
+		if (frames[i].format >= num_formats || frames[i].cs >= 8U ||
+		    (cfg->hw_cs_mask & BIT(frames[i].cs)) == 0U) {
+			return -EINVAL;
+		}
+	}
+
+	spi_context_lock(&data->ctx, false, NULL, NULL, &formats[0]);
+	data->ctx.config = &formats[0];
+
+	for (size_t i = 0; i < num_formats; i++) {
+		spi_ti_hercules_mibspi_write_fmt(dev, i, fmt[i], false);
+		data->fmt_cfg[i] = NULL;
+	}
+	data->seq_status = 0;
+
+	while (num_frames > 0U && ret == 0) {
+		data->seq = frames;
+		data->words = MIN(num_frames, MIBSPI_BUFFERS);
+
+		for (size_t i = 0; i < data->words; i++) {
+			ram->TX[i] = MIBSPI_TX_BUFMODE_NORMAL |
+				     (frames[i].cs_hold ? MIBSPI_TX_CSHOLD : 0U) |
+				     MIBSPI_TX_DFSEL(frames[i].format) |
+				     MIBSPI_TX_CSNR(frames[i].cs) | frames[i].tx;
+		}
+		spi_ti_hercules_mibspi_start_tg(dev, data->words);
+		ret = spi_context_wait_for_completion(&data->ctx);
+
+		frames += data->words;
+		num_frames -= data->words;
+	}
+
+	data->seq = NULL;
+	if (ret == 0) {
+		ret = data->seq_status;
+	}
+	spi_context_release(&data->ctx, ret);
+	return ret;
+}
+
+static int spi_ti_hercules_mibspi_init(const struct device *dev)
+{
+	const struct spi_ti_hercules_mibspi_config *cfg = DEV_CFG(dev);
+	struct spi_ti_hercules_mibspi_data *data = DEV_DATA(dev);
+	volatile struct hercules_mibspi_regs *regs = DEV_REGS(dev);
+	int ret;
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+#ifdef CONFIG_DMA_TI_HERCULES
+	if ((cfg->dma_tx.dev != NULL && !device_is_ready(cfg->dma_tx.dev)) ||
+	    (cfg->dma_rx.dev != NULL && !device_is_ready(cfg->dma_rx.dev))) {
+		return -ENODEV;
+	}
+#endif
+
+	regs->GCR0 = 0;
+	regs->GCR0 = 1;
+	regs->GCR1 = SPI_GCR1_MASTER | SPI_GCR1_CLKMOD;
+
+	/* Multi-buffer mode, wait for the buffer RAM auto-initialisation */
+	regs->MIBSPIE = SPI_MIBSPIE_MSPIENA;
+	while ((regs->FLG & SPI_FLG_BUFINITACTIVE) != 0U) {
+		/* nop */;
+	}
+
+	regs->PC0 = SPI_PC0_SOMI | SPI_PC0_SIMO | SPI_PC0_CLK | SPI_PC0_SCS(cfg->hw_cs_mask);
+	regs->DEF = 0xFF;
+	regs->DELAY = 0;
+	regs->INT0 = 0;
+	regs->LVL = 0;
+	regs->TGITENCR = UINT32_MAX;
+	regs->TGITLVCR = UINT32_MAX;
+	regs->TGINTFLG = UINT32_MAX;
+	for (size_t i = 0; i < ARRAY_SIZE(regs->TGCTRL); i++) {
+		regs->TGCTRL[i] = 0;
+	}
+	regs->GCR1 |= SPI_GCR1_SPIEN;
+
+	ret = spi_context_cs_configure_all(&data->ctx);
+	if (ret != 0) {
+		return ret;
+	}
+
+	cfg->irq_config_func(dev);
+	spi_context_unlock_unconditionally(&data->ctx);
+	return 0;
+}
+
+static DEVICE_API(spi, spi_ti_hercules_mibspi_api) = {
+	.transceive = spi_ti_hercules_mibspi_transceive,
+#ifdef CONFIG_SPI_ASYNC
+	.transceive_async = spi_ti_hercules_mibspi_transceive_async,
+#endif
+	.release = spi_ti_hercules_mibspi_release,
+};
+
+#ifdef CONFIG_DMA_TI_HERCULES
+#define SPI_TI_HERCULES_MIBSPI_DMA(n, dir)                                                         \
+	.dma_##dir = COND_CODE_1(DT_INST_DMAS_HAS_NAME(n, dir),                                    \
+		({                                                                                 \
+			.dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(n, dir)),                   \
+			.channel = DT_INST_DMAS_CELL_BY_NAME(n, dir, channel),                     \
+			.slot = DT_INST_DMAS_CELL_BY_NAME(n, dir, slot),                           \
+		}),                                                                                \
+		({0})),
+#else
+#define SPI_TI_HERCULES_MIBSPI_DMA(n, dir)
+#endif
+
+#define SPI_TI_HERCULES_MIBSPI_CS_BIT(node_id, prop, idx) BIT(DT_PROP_BY_IDX(node_id, prop, idx)) |
+
+#define SPI_TI_HERCULES_MIBSPI_INIT(n)                                                             \
+	static void spi_ti_hercules_mibspi_irq_config_##n(const struct device *dev)                \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ(n, irq), DT_INST_IRQ(n, priority),                         \
+			    spi_ti_hercules_mibspi_isr, DEVICE_DT_INST_GET(n),                     \
+			    DT_INST_IRQ(n, type));                                                 \
+		irq_enable(DT_INST_IRQ(n, irq));                                                   \
+	}                                                                                          \
+	static const struct spi_ti_hercules_mibspi_config spi_ti_hercules_mibspi_config_##n = {   \
+		.base = DT_INST_REG_ADDR_BY_NAME(n, spi),                                          \
+		.ram = DT_INST_REG_ADDR_BY_NAME(n, ram),                                           \
+		.clk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR(n)),                                  \
+		.clk = TI_HERC_PERIPH_CLK_DT_INST_GET(n),                                          \
+		.hw_cs_mask = COND_CODE_1(DT_INST_NODE_HAS_PROP(n, hw_cs_pins),                    \
+			(DT_INST_FOREACH_PROP_ELEM(n, hw_cs_pins, SPI_TI_HERCULES_MIBSPI_CS_BIT)   \
+			 0), (0)),                                                                 \
+		.irq_config_func = spi_ti_hercules_mibspi_irq_config_##n,                          \
+		SPI_TI_HERCULES_MIBSPI_DMA(n, tx) SPI_TI_HERCULES_MIBSPI_DMA(n, rx)};              \
+	static struct spi_ti_hercules_mibspi_data spi_ti_hercules_mibspi_data_##n = {             \
+		SPI_CONTEXT_INIT_LOCK(spi_ti_hercules_mibspi_data_##n, ctx),                       \
+		SPI_CONTEXT_INIT_SYNC(spi_ti_hercules_mibspi_data_##n, ctx),                       \
+		SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(n), ctx)};                             \
+	DEVICE_DT_INST_DEFINE(n, spi_ti_hercules_mibspi_init, NULL,                                \
+			      &spi_ti_hercules_mibspi_data_##n,                                    \
+			      &spi_ti_hercules_mibspi_config_##n, POST_KERNEL,                     \
+			      CONFIG_SPI_INIT_PRIORITY, &spi_ti_hercules_mibspi_api);
+
+DT_INST_FOREACH_STATUS_OKAY(SPI_TI_HERCULES_MIBSPI_INIT)
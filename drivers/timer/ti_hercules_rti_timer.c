@@ -4,18 +4,25 @@
  */
 
 /**
- * The systicks for this potentially tickless system is provided from the CNT0.
- * If tickless is enabled, compare 0 is used to provide the time keeping for the
- * kernel.
+ * The system tick is provided by free running counter 0, prescaled to half of
+ * RTICLK. Compare 0 raises the tick interrupt: it is reloaded by hardware
+ * (UDCP0) every tick in ticked mode and programmed for the next timeout in
+ * tickless mode. The 32 bit counter is extended to 64 bits in software from
+ * the last announced tick, which is never more than half a wrap old.
  */
 
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
+#include <zephyr/irq.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
 #include <zephyr/drivers/timer/system_timer.h>
+#include <zephyr/spinlock.h>
 #include <zephyr/sys_clock.h>
 #include <soc.h>
 
+#include <zephyr/drivers/ti_hercules_mmio.h>
 #include <zephyr/dt-bindings/clock/ti-hercules-clock.h>
 #include <zephyr/dt-bindings/timer/ti-hercules-rti-timer.h>
 
@@ -48,30 +55,82 @@ enum ntu_time_source {
 	EXTERNAL1 = 3,
 };
 
-static void rti_irq_handler(const struct device *dev) {
+#define RTI_REGS ((volatile struct hercules_rti_regs *)HERCULES_MMIO(DT_REG_ADDR(RTI_NODE)))
 
-};
+#define RTI_IRQ       DT_IRQ_BY_NAME(RTI_NODE, rti_compare0, irq)
+#define RTI_IRQ_PRIO  DT_IRQ_BY_NAME(RTI_NODE, rti_compare0, priority)
+#define RTI_IRQ_FLAGS DT_IRQ_BY_NAME(RTI_NODE, rti_compare0, type)
+
+/* FRC0 increments every RTI_PRESCALE RTICLK cycles (CPUC0 + 1) */
+#define RTI_PRESCALE 2U
+#define RTI_COMP0    BIT(0)
+#define RTI_INT_ALL  0x7000FU
+
+/* Compare values closer than this to the counter may be missed */
+#define MIN_DELAY 16U
+
+static struct k_spinlock lock;
+static uint64_t announced;
+static uint32_t cyc_per_tick;
+static uint32_t max_ticks;
+
+/* Must be called with the lock held, or from the ISR */
+static uint64_t rti_cycles(void)
+{
+	uint32_t frc = HERCULES_REG_READ(RTI_REGS, CNT[0].FRCx);
+
+	return announced + (uint32_t)(frc - (uint32_t)announced);
+}
+
+static void rti_compare0_isr(const void *arg)
+{
+	k_spinlock_key_t key;
+	uint32_t dticks;
+
+	ARG_UNUSED(arg);
+
+	key = k_spin_lock(&lock);
+	HERCULES_REG_WRITE(RTI_REGS, INTFLAG, RTI_COMP0);
+	dticks = (uint32_t)((rti_cycles() - announced) / cyc_per_tick);
+	announced += (uint64_t)dticks * cyc_per_tick;
+	k_spin_unlock(&lock, key);
+
+	sys_clock_announce(dticks);
+}
 
 uint32_t sys_clock_elapsed(void)
 {
-	return 0;
+	k_spinlock_key_t key;
+	uint32_t ticks;
+
+	if (!TICKLESS) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	ticks = (uint32_t)((rti_cycles() - announced) / cyc_per_tick);
+	k_spin_unlock(&lock, key);
+
+	return ticks;
 }
 
 void sys_clock_disable(void)
 {
-	volatile struct hercules_rti_regs *regs =
-		(volatile struct hercules_rti_regs *)DT_REG_ADDR(RTI_NODE);
-	regs->GCTRL &= ~(CNT0EN);
+	HERCULES_REG_UPDATE(RTI_REGS, GCTRL, CNT0EN, 0);
 }
 
 uint32_t sys_clock_cycle_get_32(void)
 {
-	return 0;
+	return HERCULES_REG_READ(RTI_REGS, CNT[0].FRCx);
 }
 
 uint64_t sys_clock_cycle_get_64(void)
 {
-	return 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint64_t cycles = rti_cycles();
+
+	k_spin_unlock(&lock, key);
+	return cycles;
 }
 
 void sys_clock_idle_exit(void)
@@ -80,53 +139,107 @@ void sys_clock_idle_exit(void)
 
 void sys_clock_set_timeout(int32_t ticks, bool idle)
 {
+	k_spinlock_key_t key;
+	uint64_t now, delay;
+
+	ARG_UNUSED(idle);
+
+	if (!TICKLESS) {
+		return;
+	}
+
+	ticks = (ticks == K_TICKS_FOREVER) ? (int32_t)max_ticks : ticks;
+	ticks = CLAMP(ticks - 1, 0, (int32_t)max_ticks);
+
+	key = k_spin_lock(&lock);
+	now = rti_cycles();
+	/* Round up to a tick boundary so announcements stay tick aligned */
+	delay = (uint64_t)ticks * cyc_per_tick + (now - announced);
+	delay = DIV_ROUND_UP(delay + 1U, cyc_per_tick) * cyc_per_tick;
+	if (announced + delay - now < MIN_DELAY) {
+		delay += cyc_per_tick;
+	}
+	HERCULES_REG_WRITE(RTI_REGS, CMP[0].COMPx, (uint32_t)(announced + delay));
+	k_spin_unlock(&lock, key);
 }
 
 static int sys_clock_driver_init(void)
 {
-	volatile struct hercules_rti_regs *regs =
-		(volatile struct hercules_rti_regs *)DT_REG_ADDR(RTI_NODE);
-	regs->GCTRL = 0;
+	const struct device *clk_dev = DEVICE_DT_GET(DT_CLOCKS_CTLR(RTI_NODE));
+	struct ti_herc_periph_clk clk = TI_HERC_PERIPH_CLK_DT_GET(RTI_NODE);
+	volatile struct hercules_rti_regs *regs = RTI_REGS;
+	uint32_t rticlk;
+	int ret;
+
+	if (!device_is_ready(clk_dev)) {
+		return -ENODEV;
+	}
+	ret = clock_control_get_rate(clk_dev, (clock_control_subsys_t)&clk, &rticlk);
+	if (ret != 0) {
+		return ret;
+	}
+	/* The last clocks cell selects the RTICLK1 divider */
+	rticlk >>= clk.clock_mode;
+
+	z_clock_hw_cycles_per_sec = (int)(rticlk / RTI_PRESCALE);
+	cyc_per_tick = (uint32_t)z_clock_hw_cycles_per_sec / CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+	if (cyc_per_tick == 0U) {
+		return -EINVAL;
+	}
+	max_ticks = (UINT32_MAX / 2U) / cyc_per_tick;
+
+	HERCULES_REG_WRITE(regs, GCTRL, 0);
 	/* Setup NTU clock source if defined in dts or default to FLEXRAY_MACRO_TICK as in TRM */
 	switch ((enum ntu_time_source)DT_ENUM_IDX_OR(RTI_NODE, ntu, FLEXRAY_MACRO_TICK)) {
 	case EXTERNAL1:
-		regs->GCTRL |= (0xFU << 16U);
+		HERCULES_REG_UPDATE(regs, GCTRL, 0, (0xFU << 16U));
 		break;
 
 	case FLEXRAY_START_OF_CYCLE:
-		regs->GCTRL |= (0x5U << 16U);
+		HERCULES_REG_UPDATE(regs, GCTRL, 0, (0x5U << 16U));
 		break;
 
 	case PLL2:
-		regs->GCTRL |= (0xAU << 16U);
+		HERCULES_REG_UPDATE(regs, GCTRL, 0, (0xAU << 16U));
 		break;
 
 	case FLEXRAY_MACRO_TICK:
 	default:
 		/* GCTRL is 0'd already*/
+		break;
 	}
-	return 0;
 #if DT_PROP(RTI_NODE, continue_on_suspend)
-	regs->GCTRL |= BIT(15);
+	HERCULES_REG_UPDATE(regs, GCTRL, 0, BIT(15));
 #endif
-	regs->TBCTRL = 0;
+	HERCULES_REG_WRITE(regs, TBCTRL, 0);
 #if DT_PROP(RTI_NODE, increment_on_failure)
-	regs->TBCTRL |= INC_ON_FAIL_EN;
+	HERCULES_REG_UPDATE(regs, TBCTRL, 0, INC_ON_FAIL_EN);
 #endif
 #if DT_PROP(RTI_NODE, timebase_external)
-	regs->TBCTRL |= TBEXT_EN;
+	HERCULES_REG_UPDATE(regs, TBCTRL, 0, TBEXT_EN);
 #endif
 
-#if TICKLESS
 	/* Disable external capture event for counter 0 */
-	regs->CAPCTRL &= ~(BIT(0));
+	HERCULES_REG_UPDATE(regs, CAPCTRL, BIT(0), 0);
 	/* Set counter0 as compare source for compare 0*/
-	regs->COMPCTRL &= ~(BIT(0));
+	HERCULES_REG_UPDATE(regs, COMPCTRL, BIT(0), 0);
 
 	/* Reset up counter and free running counter 0 */
-	regs->CNT[0].UCx = 0;
-	regs->CNT[0].FRCx = 0;
-#endif
+	HERCULES_REG_WRITE(regs, CNT[0].UCx, 0);
+	HERCULES_REG_WRITE(regs, CNT[0].FRCx, 0);
+	HERCULES_REG_WRITE(regs, CNT[0].CPUCx, RTI_PRESCALE - 1U);
+
+	HERCULES_REG_WRITE(regs, CMP[0].COMPx, cyc_per_tick);
+	HERCULES_REG_WRITE(regs, CMP[0].UDCPx, TICKLESS ? 0U : cyc_per_tick);
+
+	HERCULES_REG_WRITE(regs, CLEARINTENA, RTI_INT_ALL);
+	HERCULES_REG_WRITE(regs, INTFLAG, RTI_INT_ALL);
+	HERCULES_REG_WRITE(regs, SETINTENA, RTI_COMP0);
+
+	IRQ_CONNECT(RTI_IRQ, RTI_IRQ_PRIO, rti_compare0_isr, NULL, RTI_IRQ_FLAGS);
+	irq_enable(RTI_IRQ);
+
+	HERCULES_REG_UPDATE(regs, GCTRL, 0, CNT0EN);
 
 	return 0;
 }
@@ -0,0 +1,279 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT ti_hercules_rti_wdt
+
+#include <soc.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/misc/ti_hercules_esm/ti_hercules_esm.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/drivers/ti_hercules_sys_regs.h>
+#include <zephyr/drivers/watchdog.h>
+#include <zephyr/dt-bindings/timer/ti-hercules-rti-timer.h>
+#include <zephyr/irq.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(wdt_ti_hercules_rti, CONFIG_WDT_LOG_LEVEL);
+
+#define DEV_CFG(dev)  ((const struct wdt_ti_hercules_rti_config *)(dev)->config)
+#define DEV_DATA(dev) ((struct wdt_ti_hercules_rti_data *)(dev)->data)
+#define DEV_REGS(dev) ((volatile struct hercules_rti_regs *)DEV_CFG(dev)->base)
+
+#define DWDCTRL_ENABLE 0xA98559DAU
+#define WDKEY_FIRST    0xE51AU
+#define WDKEY_SECOND   0xA35CU
+#define WDSTATUS_ALL   0xFFU
+
+#define WWDRXN_RESET 0x5U
+#define WWDRXN_NMI   0xAU
+
+/* The 12 bit preload is compared against the upper bits of a 25 bit down counter. */
+#define DWDPRLD_MAX   0xFFFU
+#define DWDPRLD_SHIFT 13U
+
+/* RTI digital windowed watchdog NMI */
+#define ESM_CHANNEL_WWD 24U
+
+/* System software interrupt 1, used to leave the ESM FIQ */
+#define SSIR_KEY     (0x75U << 8)
+#define SSIVEC_SSIR1 1U
+#define SSIVEC_VECT  0xFFU
+
+/* Window sizes as a fraction of the timeout, 100% first */
+static const uint32_t wwd_size_ctrl[] = {
+	0x00000005U, 0x00000050U, 0x00000500U, 0x00005000U, 0x00050000U, 0x00500000U,
+};
+
+struct wdt_ti_hercules_rti_config {
+	uintptr_t base;
+	const struct device *clk_dev;
+	struct ti_herc_periph_clk clk;
+	void (*irq_config_func)(const struct device *dev);
+};
+
+struct wdt_ti_hercules_rti_data {
+	wdt_callback_t callback;
+	uint32_t preload;
+	uint32_t window;
+	uint32_t reaction;
+	bool installed;
+};
+
+static inline bool rti_wdt_enabled(volatile struct hercules_rti_regs *regs)
+{
+	return regs->DWDCTRL == DWDCTRL_ENABLE;
+}
+
+#ifdef CONFIG_TI_HERCULES_ESM
+/*
+ * Runs in the ESM group 2 FIQ, dispatched by the ESM driver from the NMI
+ * handler. irq_lock() does not mask it, so no kernel service may be used
+ * here. Raise the system software interrupt and run the user callback from
+ * its IRQ instead.
+ */
+static void wdt_ti_hercules_rti_nmi(const struct device *esm, uint8_t group, uint8_t channel,
+				    void *user_data)
+{
+	const struct device *dev = user_data;
+	volatile struct hercules_syscon_1_regs *sys = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+
+	ARG_UNUSED(esm);
+	ARG_UNUSED(group);
+	ARG_UNUSED(channel);
+
+	DEV_REGS(dev)->WDSTATUS = WDSTATUS_ALL;
+	HERCULES_REG_WRITE(sys, SSIR1, SSIR_KEY);
+}
+#endif
+
+static void wdt_ti_hercules_rti_ssi_isr(const struct device *dev)
+{
+	volatile struct hercules_syscon_1_regs *sys = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	struct wdt_ti_hercules_rti_data *data = DEV_DATA(dev);
+
+	/* Reading the vector acknowledges the request */
+	if ((HERCULES_REG_READ(sys, SSIVEC) & SSIVEC_VECT) == SSIVEC_SSIR1 &&
+	    data->callback != NULL) {
+		data->callback(dev, 0);
+	}
+}
+
+static int wdt_ti_hercules_rti_setup(const struct device *dev, uint8_t options)
+{
+	struct wdt_ti_hercules_rti_data *data = DEV_DATA(dev);
+	volatile struct hercules_rti_regs *regs = DEV_REGS(dev);
+
+	if (!data->installed) {
+		return -EINVAL;
+	}
+	if (rti_wdt_enabled(regs)) {
+		return -EBUSY;
+	}
+	/* The DWD is suspended along with the CPU by the debugger, but keeps running in sleep. */
+	if ((options & WDT_OPT_PAUSE_IN_SLEEP) != 0U) {
+		return -ENOTSUP;
+	}
+
+#ifdef CONFIG_TI_HERCULES_ESM
+	if (data->reaction == WWDRXN_NMI) {
+		int ret = ti_hercules_esm_callback_set(DEVICE_DT_GET(ESM_NODE),
+						       TI_HERCULES_ESM_GROUP2, ESM_CHANNEL_WWD,
+						       wdt_ti_hercules_rti_nmi, (void *)dev);
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+#endif
+
+	regs->WDSTATUS = WDSTATUS_ALL;
+	regs->DWDPRLD = data->preload;
+	regs->WWDSIZECTRL = wwd_size_ctrl[data->window];
+	regs->WWDRXNCTRL = data->reaction;
+	/* No way back from here until the next reset. */
+	regs->DWDCTRL = DWDCTRL_ENABLE;
+
+	return 0;
+}
+
+static int wdt_ti_hercules_rti_disable(const struct device *dev)
+{
+	return rti_wdt_enabled(DEV_REGS(dev)) ? -EPERM : -EFAULT;
+}
+
+static int wdt_ti_hercules_rti_install_timeout(const struct device *dev,
+					       const struct wdt_timeout_cfg *cfg)
+{
+	const struct wdt_ti_hercules_rti_config *config = DEV_CFG(dev);
+	struct wdt_ti_hercules_rti_data *data = DEV_DATA(dev);
+	uint32_t rticlk, window, open, i;
+	uint64_t ticks;
+	int ret;
+
+	if (rti_wdt_enabled(DEV_REGS(dev))) {
+		return -EBUSY;
+	}
+	if (data->installed) {
+		return -ENOMEM;
+	}
+	if (cfg->window.max == 0U || cfg->window.min >= cfg->window.max) {
+		return -EINVAL;
+	}
+
+	switch (cfg->flags & WDT_FLAG_RESET_MASK) {
+	case WDT_FLAG_RESET_SOC:
+		data->reaction = WWDRXN_RESET;
+		break;
+	case WDT_FLAG_RESET_NONE:
+		if (!IS_ENABLED(CONFIG_TI_HERCULES_ESM) || cfg->callback == NULL) {
+			return -ENOTSUP;
+		}
+		data->reaction = WWDRXN_NMI;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	ret = clock_control_get_rate(config->clk_dev, (clock_control_subsys_t)&config->clk,
+				     &rticlk);
+	if (ret != 0) {
+		return ret;
+	}
+	/* The last clocks cell selects the RTICLK1 divider */
+	rticlk >>= config->clk.clock_mode;
+
+	/* Expiration time is (DWDPRLD + 1) * 2^13 RTICLK cycles. */
+	ticks = ((uint64_t)cfg->window.max * rticlk) / (MSEC_PER_SEC << DWDPRLD_SHIFT);
+	if (ticks == 0U || ticks > DWDPRLD_MAX + 1U) {
+		LOG_ERR("Timeout of %u ms out of range", cfg->window.max);
+		return -EINVAL;
+	}
+
+	/*
+	 * The window is the last 1/2^i of the timeout. Use the smallest one
+	 * that still opens no later than window.min, so feeding at min is
+	 * never a violation.
+	 */
+	window = 0U;
+	for (i = 1U; i < ARRAY_SIZE(wwd_size_ctrl); i++) {
+		open = cfg->window.max - (cfg->window.max >> i);
+		if (open > cfg->window.min) {
+			break;
+		}
+		window = i;
+	}
+
+	data->preload = (uint32_t)ticks - 1U;
+	data->window = window;
+	data->callback = cfg->callback;
+	data->installed = true;
+
+	return 0;
+}
+
+static int wdt_ti_hercules_rti_feed(const struct device *dev, int channel_id)
+{
+	volatile struct hercules_rti_regs *regs = DEV_REGS(dev);
+	unsigned int key;
+
+	if (channel_id != 0) {
+		return -EINVAL;
+	}
+
+	/* Another kick landing between the two keys would break the sequence. */
+	key = irq_lock();
+	regs->WDKEY = WDKEY_FIRST;
+	regs->WDKEY = WDKEY_SECOND;
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int wdt_ti_hercules_rti_init(const struct device *dev)
+{
+	const struct wdt_ti_hercules_rti_config *cfg = DEV_CFG(dev);
+
+	if (!device_is_ready(cfg->clk_dev)) {
+		return -ENODEV;
+	}
+	cfg->irq_config_func(dev);
+	return 0;
+}
+
+static DEVICE_API(wdt, wdt_ti_hercules_rti_api) = {
+	.setup = wdt_ti_hercules_rti_setup,
+	.disable = wdt_ti_hercules_rti_disable,
+	.install_timeout = wdt_ti_hercules_rti_install_timeout,
+	.feed = wdt_ti_hercules_rti_feed,
+};
+
+#define WDT_TI_HERCULES_RTI_INIT(n)                                                                \
+	static void wdt_ti_hercules_rti_irq_config_##n(const struct device *dev)                   \
+	{                                                                                          \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(n, ssi, irq),                                      \
+			    DT_INST_IRQ_BY_NAME(n, ssi, priority), wdt_ti_hercules_rti_ssi_isr,    \
+			    DEVICE_DT_INST_GET(n), DT_INST_IRQ_BY_NAME(n, ssi, type));             \
+		irq_enable(DT_INST_IRQ_BY_NAME(n, ssi, irq));                                      \
+	}                                                                                          \
+                                                                                                   \
+	static const struct wdt_ti_hercules_rti_config wdt_ti_hercules_rti_config_##n = {          \
+		.base = DT_REG_ADDR(DT_INST_PARENT(n)),                                            \
+		.clk_dev = DEVICE_DT_GET(DT_CLOCKS_CTLR(DT_INST_PARENT(n))),                       \
+		.clk = TI_HERC_PERIPH_CLK_DT_GET(DT_INST_PARENT(n)),                               \
+		.irq_config_func = wdt_ti_hercules_rti_irq_config_##n,                             \
+	};                                                                                         \
+                                                                                                   \
+	static struct wdt_ti_hercules_rti_data wdt_ti_hercules_rti_data_##n;                       \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(n, wdt_ti_hercules_rti_init, NULL, &wdt_ti_hercules_rti_data_##n,    \
+			      &wdt_ti_hercules_rti_config_##n, POST_KERNEL,                        \
+			      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &wdt_ti_hercules_rti_api);
+
+DT_INST_FOREACH_STATUS_OKAY(WDT_TI_HERCULES_RTI_INIT)
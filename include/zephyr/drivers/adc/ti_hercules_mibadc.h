@@ -0,0 +1,89 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_ADC_TI_HERCULES_MIBADC_H_
+#define INCLUDE_ZEPHYR_DRIVERS_ADC_TI_HERCULES_MIBADC_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <zephyr/device.h>
+#include <zephyr/types.h>
+
+/** MibADC conversion groups. Group 1 is reserved for adc_read(). */
+enum ti_hercules_mibadc_group {
+	TI_HERCULES_MIBADC_GROUP_EVENT = 0,
+	TI_HERCULES_MIBADC_GROUP_1 = 1,
+	TI_HERCULES_MIBADC_GROUP_2 = 2,
+};
+
+/** Conversion data of a raw result word. */
+#define TI_HERCULES_MIBADC_RESULT_DATA(w)    ((uint16_t)((w) & 0xFFFU))
+/** Channel a raw result word was converted from. */
+#define TI_HERCULES_MIBADC_RESULT_CHANNEL(w) (((w) >> 16) & 0x1FU)
+
+/**
+ * @brief Stream callback, called once per block of results.
+ *
+ * @param dev MibADC device.
+ * @param group Group the results belong to.
+ * @param results Raw result words, or NULL after a FIFO overrun or a lost block.
+ * @param count Number of results, 0 after a FIFO overrun or a lost block.
+ * @param timestamp RTI free running counter 0, read when the block interrupt or
+ *                  DMA completion is serviced. It trails the last conversion of
+ *                  the block by the interrupt latency, derive per sample times
+ *                  from the trigger period instead.
+ * @param user_data User data from the stream configuration.
+ */
+typedef void (*ti_hercules_mibadc_stream_cb_t)(const struct device *dev,
+					       enum ti_hercules_mibadc_group group,
+					       const uint32_t *results, size_t count,
+					       uint32_t timestamp, void *user_data);
+
+/** Hardware triggered stream configuration. */
+struct ti_hercules_mibadc_stream_cfg {
+	/** Channels converted on every trigger, in ascending order. */
+	uint32_t channels;
+	/** Trigger source (GxSRC) from the device datasheet, 0 is the ADxEVT pin. */
+	uint8_t trigger;
+	/** Trigger on the rising instead of the falling edge. */
+	bool rising_edge;
+	/** Keep converting back to back after the first trigger. */
+	bool continuous;
+	/** Ring buffer receiving the raw result words. */
+	uint32_t *buffer;
+	/** Ring buffer length in results, a multiple of @p block holding at least two blocks. */
+	size_t buffer_len;
+	/** Results per callback. Without DMA at most the group FIFO depth. */
+	uint16_t block;
+	/** Block callback, run from interrupt context. */
+	ti_hercules_mibadc_stream_cb_t callback;
+	/** Passed to @p callback. */
+	void *user_data;
+};
+
+/**
+ * @brief Start streaming a group into a ring buffer.
+ *
+ * When the group has a DMA channel in devicetree every result is moved by
+ * DMA and the CPU only sees one interrupt per block, otherwise the FIFO
+ * threshold interrupt drains one block at a time. Channels must have been
+ * set up with adc_channel_setup() first.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the group or configuration is invalid.
+ * @retval -EBUSY if the group is already streaming.
+ */
+int ti_hercules_mibadc_stream_start(const struct device *dev, enum ti_hercules_mibadc_group group,
+				    const struct ti_hercules_mibadc_stream_cfg *cfg);
+
+/**
+ * @brief Stop a stream started with ti_hercules_mibadc_stream_start().
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the group is not streaming.
+ */
+int ti_hercules_mibadc_stream_stop(const struct device *dev, enum ti_hercules_mibadc_group group);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_ADC_TI_HERCULES_MIBADC_H_ */
@@ -0,0 +1,36 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_CLOCK_CONTROL_TI_HERCULES_CLOCK_CONTROL_H_
+#define INCLUDE_ZEPHYR_DRIVERS_CLOCK_CONTROL_TI_HERCULES_CLOCK_CONTROL_H_
+
+#include <zephyr/devicetree.h>
+#include <zephyr/dt-bindings/clock/ti-hercules-clock.h>
+#include <zephyr/types.h>
+
+/**
+ * Clock subsystem descriptor passed to the GCM clock_control driver.
+ *
+ * A source of CLOCK_SRC_NONE selects the rate of the clock domain itself
+ * (e.g. VCLK2 for N2HET), otherwise the rate of the source is reported.
+ */
+struct ti_herc_periph_clk {
+	uint8_t domain;
+	uint8_t source;
+	uint8_t clock_mode;
+	uint8_t arg; /* divider argument (optional) */
+};
+
+/** Build a ti_herc_periph_clk initializer from the first clocks entry of a node. */
+#define TI_HERC_PERIPH_CLK_DT_GET(node_id)                                                         \
+	{                                                                                          \
+		.domain = DT_CLOCKS_CELL(node_id, clock_domain),                                   \
+		.source = DT_CLOCKS_CELL(node_id, clock_source),                                   \
+		.clock_mode = DT_CLOCKS_CELL(node_id, clock_mode),                                 \
+	}
+
+#define TI_HERC_PERIPH_CLK_DT_INST_GET(inst) TI_HERC_PERIPH_CLK_DT_GET(DT_DRV_INST(inst))
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_CLOCK_CONTROL_TI_HERCULES_CLOCK_CONTROL_H_ */
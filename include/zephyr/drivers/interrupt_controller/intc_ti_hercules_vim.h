@@ -0,0 +1,22 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_INTERRUPT_CONTROLLER_INTC_TI_HERCULES_VIM_H_
+#define INCLUDE_ZEPHYR_DRIVERS_INTERRUPT_CONTROLLER_INTC_TI_HERCULES_VIM_H_
+
+#include <stdbool.h>
+
+/**
+ * @brief Select whether a VIM channel wakes the device from a low power mode.
+ *
+ * All channels are wakeup sources out of reset. The PM support narrows this
+ * down to the system timer and the nodes marked with wakeup-source.
+ *
+ * @param irq VIM channel.
+ * @param enable true to let the channel wake the device.
+ */
+void ti_hercules_vim_wakeup_set(unsigned int irq, bool enable);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_INTERRUPT_CONTROLLER_INTC_TI_HERCULES_VIM_H_ */
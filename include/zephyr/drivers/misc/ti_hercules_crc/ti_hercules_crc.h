@@ -0,0 +1,165 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_MISC_TI_HERCULES_CRC_TI_HERCULES_CRC_H_
+#define INCLUDE_ZEPHYR_DRIVERS_MISC_TI_HERCULES_CRC_TI_HERCULES_CRC_H_
+
+#include <stddef.h>
+#include <zephyr/device.h>
+#include <zephyr/types.h>
+
+/**
+ * The CRC controller compresses 64 bit patterns into a 64 bit signature with
+ * the CRC-64 polynomial x^64 + x^4 + x^3 + x + 1, starting from a zero seed.
+ * Buffers are therefore 8 byte aligned and a multiple of 8 bytes long, and
+ * each pattern is taken in memory order (low word first).
+ */
+
+/** Largest buffer one signature can cover, the pattern counter is 20 bits wide. */
+#define TI_HERCULES_CRC_MAX_LEN (0xFFFFFU * sizeof(uint64_t))
+
+/**
+ * @brief Background signature completion callback.
+ *
+ * Called from the CRC or DMA interrupt.
+ *
+ * @param dev CRC device.
+ * @param status 0 on success, -EILSEQ if a checked signature did not match
+ *               or -EIO if the DMA transfer failed.
+ * @param crc Computed signature.
+ * @param user_data User data passed when the computation was started.
+ */
+typedef void (*ti_hercules_crc_callback_t)(const struct device *dev, int status, uint64_t crc,
+					   void *user_data);
+
+/**
+ * @brief Compute the signature of a buffer.
+ *
+ * The DMA feeds the controller when the device has a "data" DMA channel and
+ * the kernel is running, the calling thread sleeps until the signature is
+ * ready. Otherwise, e.g. for an image check before the kernel starts, the
+ * CPU writes the patterns itself. Not callable from an ISR, use
+ * ti_hercules_crc_compute_async() there.
+ *
+ * @param dev CRC device.
+ * @param buf Buffer, 8 byte aligned.
+ * @param len Length in bytes, a multiple of 8 up to TI_HERCULES_CRC_MAX_LEN.
+ * @param crc Computed signature.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the buffer is misaligned or its length is invalid.
+ * @retval -EIO if the DMA transfer failed.
+ * @retval -EWOULDBLOCK if called from an ISR.
+ */
+int ti_hercules_crc_compute(const struct device *dev, const void *buf, size_t len,
+			    uint64_t *crc);
+
+/**
+ * @brief Compute the signature of a buffer in the background.
+ *
+ * The DMA feeds the controller while the CPU keeps running, @p cb is called
+ * once the whole buffer is compressed. Only one background computation runs
+ * at a time. See ti_hercules_crc_scrub_start() for periodic scrubbing of
+ * flash images or RAM blocks.
+ *
+ * @param dev CRC device.
+ * @param buf Buffer, 8 byte aligned.
+ * @param len Length in bytes, a multiple of 8 up to TI_HERCULES_CRC_MAX_LEN.
+ * @param cb Completion callback.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the computation started.
+ * @retval -EINVAL if the buffer is misaligned or its length is invalid.
+ * @retval -ENOTSUP if the device has no DMA channel.
+ * @retval -EBUSY if a background computation is in progress.
+ */
+int ti_hercules_crc_compute_async(const struct device *dev, const void *buf, size_t len,
+				  ti_hercules_crc_callback_t cb, void *user_data);
+
+/**
+ * @brief Check a buffer against a known signature in the background.
+ *
+ * Same as ti_hercules_crc_compute_async(), but @p cb gets -EILSEQ when the
+ * signature differs from @p expected.
+ *
+ * @param dev CRC device.
+ * @param buf Buffer, 8 byte aligned.
+ * @param len Length in bytes, a multiple of 8 up to TI_HERCULES_CRC_MAX_LEN.
+ * @param expected Expected signature.
+ * @param cb Completion callback.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the check started.
+ * @retval -EINVAL if the buffer is misaligned or its length is invalid.
+ * @retval -ENOTSUP if the device has no DMA channel.
+ * @retval -EBUSY if a background computation is in progress.
+ */
+int ti_hercules_crc_check_async(const struct device *dev, const void *buf, size_t len,
+				uint64_t expected, ti_hercules_crc_callback_t cb, void *user_data);
+
+/** @brief Memory region checked by the scrubber. */
+struct ti_hercules_crc_region {
+	/** Start, 8 byte aligned */
+	const void *buf;
+	/** Length in bytes, a multiple of 8 up to TI_HERCULES_CRC_MAX_LEN */
+	size_t len;
+	/** Known signature of the region */
+	uint64_t expected;
+};
+
+/**
+ * @brief Scrubbing result callback.
+ *
+ * Called once per region and pass, from the CRC or DMA interrupt, or from the
+ * system workqueue when the check could not be started.
+ *
+ * @param dev CRC device.
+ * @param region Checked region.
+ * @param status 0 if the signature matched, -EILSEQ if it did not, or a
+ *               negative error if the region could not be checked.
+ * @param crc Computed signature.
+ * @param user_data User data passed to ti_hercules_crc_scrub_start().
+ */
+typedef void (*ti_hercules_crc_scrub_callback_t)(const struct device *dev,
+						 const struct ti_hercules_crc_region *region,
+						 int status, uint64_t crc, void *user_data);
+
+/**
+ * @brief Start periodic background scrubbing.
+ *
+ * The regions are checked one after the other with background computations,
+ * and the pass is repeated CONFIG_TI_HERCULES_CRC_SCRUB_INTERVAL_MS after it
+ * ended. A region is deferred while another background computation runs.
+ * The regions must stay valid until ti_hercules_crc_scrub_stop(). Needs
+ * CONFIG_TI_HERCULES_CRC_SCRUB.
+ *
+ * @param dev CRC device.
+ * @param regions Regions to check.
+ * @param count Number of regions.
+ * @param cb Result callback.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if scrubbing started.
+ * @retval -EINVAL if a region is misaligned or its length is invalid.
+ * @retval -ENOTSUP if the device has no DMA channel.
+ * @retval -EALREADY if scrubbing is already running.
+ */
+int ti_hercules_crc_scrub_start(const struct device *dev,
+				const struct ti_hercules_crc_region *regions, size_t count,
+				ti_hercules_crc_scrub_callback_t cb, void *user_data);
+
+/**
+ * @brief Stop periodic background scrubbing.
+ *
+ * A region check in progress still completes, its result is not reported.
+ *
+ * @param dev CRC device.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if scrubbing is not running.
+ */
+int ti_hercules_crc_scrub_stop(const struct device *dev);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_MISC_TI_HERCULES_CRC_TI_HERCULES_CRC_H_ */
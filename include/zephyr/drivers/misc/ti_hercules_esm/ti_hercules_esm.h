@@ -0,0 +1,114 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_MISC_TI_HERCULES_ESM_TI_HERCULES_ESM_H_
+#define INCLUDE_ZEPHYR_DRIVERS_MISC_TI_HERCULES_ESM_TI_HERCULES_ESM_H_
+
+#include <stdbool.h>
+#include <zephyr/device.h>
+#include <zephyr/types.h>
+
+/** ESM error groups. Group 3 errors only drive the nERROR pin. */
+#define TI_HERCULES_ESM_GROUP1 1U
+#define TI_HERCULES_ESM_GROUP2 2U
+
+/** Number of channels in group 1 and group 2. */
+#define TI_HERCULES_ESM_GROUP1_CHANNELS 96U
+#define TI_HERCULES_ESM_GROUP2_CHANNELS 64U
+
+/**
+ * @brief ESM error callback.
+ *
+ * Called from the ESM interrupt. The high level interrupt is an FIQ, it
+ * runs from the NMI handler and is not masked by irq_lock(). The status
+ * flag of the channel is already cleared. Keep the callback short and do
+ * not call kernel services from a high level one.
+ * FIQs are outside of the lazy FPU context switching, so a high level
+ * callback must not use floating point either.
+ *
+ * @param dev ESM device.
+ * @param group TI_HERCULES_ESM_GROUP1 or TI_HERCULES_ESM_GROUP2.
+ * @param channel Channel within the group.
+ * @param user_data User data passed at registration.
+ */
+typedef void (*ti_hercules_esm_callback_t)(const struct device *dev, uint8_t group,
+					   uint8_t channel, void *user_data);
+
+/**
+ * @brief Register the callback of one error source.
+ *
+ * @param dev ESM device.
+ * @param group TI_HERCULES_ESM_GROUP1 or TI_HERCULES_ESM_GROUP2.
+ * @param channel Channel within the group.
+ * @param cb Callback, NULL to remove it.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the group or channel is invalid.
+ */
+int ti_hercules_esm_callback_set(const struct device *dev, uint8_t group, uint8_t channel,
+				 ti_hercules_esm_callback_t cb, void *user_data);
+
+/**
+ * @brief Report an error found by a software diagnostic.
+ *
+ * The error is counted and dispatched to the callback of the channel as if
+ * the ESM had raised it, for failures that the hardware does not signal on
+ * its own such as the result of a self-test. The callback runs in the
+ * context of the caller.
+ *
+ * @param dev ESM device.
+ * @param group TI_HERCULES_ESM_GROUP1 or TI_HERCULES_ESM_GROUP2.
+ * @param channel Channel within the group.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the group or channel is invalid.
+ */
+int ti_hercules_esm_report(const struct device *dev, uint8_t group, uint8_t channel);
+
+/**
+ * @brief Get the number of errors seen on one error source since boot.
+ *
+ * @param dev ESM device.
+ * @param group TI_HERCULES_ESM_GROUP1 or TI_HERCULES_ESM_GROUP2.
+ * @param channel Channel within the group.
+ *
+ * @return Error count, 0 for an invalid source.
+ */
+uint32_t ti_hercules_esm_error_count(const struct device *dev, uint8_t group, uint8_t channel);
+
+/**
+ * @brief Check whether the nERROR pin is asserted.
+ *
+ * @param dev ESM device.
+ *
+ * @return true if the pin signals an error.
+ */
+bool ti_hercules_esm_error_pin_active(const struct device *dev);
+
+/**
+ * @brief Release the nERROR pin.
+ *
+ * The hardware keeps the pin low for at least the ltc-preload time after
+ * an error, a release request is only accepted once that time has passed.
+ *
+ * @param dev ESM device.
+ *
+ * @retval 0 if the pin is released.
+ * @retval -EBUSY if the low time counter is still running, try again later.
+ */
+int ti_hercules_esm_error_pin_reset(const struct device *dev);
+
+/**
+ * @brief Dispatch the pending high level ESM events.
+ *
+ * Run from the NMI handler for the FIQ, and by the VIM when it takes the
+ * ESM request through its fallback vector, e.g. after a VIM RAM ECC error.
+ *
+ * @param dev ESM device.
+ */
+void ti_hercules_esm_dispatch_high(const struct device *dev);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_MISC_TI_HERCULES_ESM_TI_HERCULES_ESM_H_ */
@@ -0,0 +1,42 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_PINCTRL_PINCTRL_TI_HERCULES_H_
+#define INCLUDE_ZEPHYR_DRIVERS_PINCTRL_PINCTRL_TI_HERCULES_H_
+
+#include <zephyr/types.h>
+
+/** PINMMR images folded from the pin states of all enabled devices. */
+enum ti_hercules_pinctrl_image {
+	/** "default" states, applied at boot */
+	TI_HERCULES_PINCTRL_IMAGE_DEFAULT,
+	/** "sleep" states */
+	TI_HERCULES_PINCTRL_IMAGE_SLEEP,
+};
+
+/**
+ * @brief Write one of the build-time PINMMR images.
+ *
+ * Only the registers touched by the image are written, fully populated
+ * registers without a read back. Two devices setting the same field to
+ * different values in a state fail the build. Callable from any context.
+ *
+ * @param image Image to apply.
+ */
+void ti_hercules_pinctrl_apply_image(enum ti_hercules_pinctrl_image image);
+
+/**
+ * @brief Update bits of a PINMMR register.
+ *
+ * For the control bits that live in the IOMM but belong to a peripheral,
+ * such as the ePWM time base clock enable. Callable from any context.
+ *
+ * @param pinmmr PINMMR register number.
+ * @param mask Bits to update.
+ * @param value New value of the bits in @p mask.
+ */
+void ti_hercules_pinctrl_update(uint32_t pinmmr, uint32_t mask, uint32_t value);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_PINCTRL_PINCTRL_TI_HERCULES_H_ */
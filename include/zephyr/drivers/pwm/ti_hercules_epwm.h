@@ -0,0 +1,94 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_PWM_TI_HERCULES_EPWM_H_
+#define INCLUDE_ZEPHYR_DRIVERS_PWM_TI_HERCULES_EPWM_H_
+
+#include <stddef.h>
+#include <zephyr/device.h>
+#include <zephyr/types.h>
+
+/**
+ * ePWM channels 0 and 1 are the EPWMxA and EPWMxB outputs, they share the
+ * period of the module time base. Period and compare values are written to
+ * the shadow registers and loaded when the counter reaches zero, so an
+ * output never sees a partially updated period.
+ */
+
+/** Compare update of one ePWM output, see ti_hercules_epwm_set_pulses(). */
+struct ti_hercules_epwm_pulse {
+	/** ePWM device */
+	const struct device *dev;
+	/** 0 for EPWMxA, 1 for EPWMxB */
+	uint32_t channel;
+	/** Pulse width in time base clock cycles */
+	uint32_t pulse_cycles;
+	/** PWM_POLARITY_* flags */
+	uint16_t flags;
+};
+
+/**
+ * @brief Callback from the ePWM or trip zone interrupt.
+ *
+ * @param dev ePWM device.
+ * @param user_data User data given when the callback was set.
+ */
+typedef void (*ti_hercules_epwm_callback_t)(const struct device *dev, void *user_data);
+
+/**
+ * @brief Update the pulse widths of several outputs at the same load event.
+ *
+ * All modules must share their counter-zero event, i.e. run the same
+ * period and counter mode and be synchronized with no phase offset, as the
+ * phases of a bridge are. The compare registers are written with interrupts
+ * locked, and not within a few time base clocks of counter zero of any of
+ * the modules, so every value is loaded at the same counter-zero event.
+ *
+ * Callable from the period callback of the first module, which then has
+ * almost a whole period to write the new values.
+ *
+ * @param pulses Updates.
+ * @param count Number of entries in @p pulses.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if a channel is invalid, a pulse longer than the period, or
+ *                 the modules do not share their counter-zero event.
+ */
+int ti_hercules_epwm_set_pulses(const struct ti_hercules_epwm_pulse *pulses, size_t count);
+
+/**
+ * @brief Call @p cb in the ePWM interrupt every time the counter reaches zero.
+ *
+ * This is the usual trigger of a control loop: the new compare values
+ * written from it are loaded at the next counter zero.
+ *
+ * @param dev ePWM device.
+ * @param cb Callback, NULL disables the interrupt.
+ * @param user_data User data passed to @p cb.
+ */
+int ti_hercules_epwm_set_period_callback(const struct device *dev, ti_hercules_epwm_callback_t cb,
+					 void *user_data);
+
+/**
+ * @brief Call @p cb in the trip zone interrupt when the outputs are tripped.
+ *
+ * @param dev ePWM device.
+ * @param cb Callback, NULL only logs trips.
+ * @param user_data User data passed to @p cb.
+ */
+int ti_hercules_epwm_set_trip_callback(const struct device *dev, ti_hercules_epwm_callback_t cb,
+				       void *user_data);
+
+/**
+ * @brief Release the outputs after a one-shot trip.
+ *
+ * Cycle-by-cycle trips release themselves at the next counter zero once the
+ * trip inputs are inactive.
+ *
+ * @param dev ePWM device.
+ */
+int ti_hercules_epwm_trip_clear(const struct device *dev);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_PWM_TI_HERCULES_EPWM_H_ */
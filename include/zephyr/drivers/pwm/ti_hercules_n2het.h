@@ -0,0 +1,47 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_PWM_TI_HERCULES_N2HET_H_
+#define INCLUDE_ZEPHYR_DRIVERS_PWM_TI_HERCULES_N2HET_H_
+
+#include <stddef.h>
+#include <zephyr/device.h>
+#include <zephyr/types.h>
+
+/**
+ * @brief Stream the rising edge timestamps of a capture pin into RAM.
+ *
+ * The HTU copies the WCAP data field of the pin into @p buf on every edge,
+ * wrapping around after @p count entries, without any CPU involvement.
+ * Each entry holds the LR timebase count in bits 31:7 and the HR offset in
+ * bits 6:0.
+ *
+ * Only the first eight capture-pins of a node are wired to the HTU.
+ *
+ * @param dev N2HET device.
+ * @param channel N2HET pin listed in capture-pins.
+ * @param buf Destination ring, must stay valid until the stream is stopped.
+ * @param count Number of 32-bit entries in @p buf (1 - 2047).
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the channel is not a capture pin or @p count is invalid.
+ * @retval -ENOTSUP if the channel has no HTU request line.
+ */
+int ti_hercules_n2het_stream_start(const struct device *dev, uint32_t channel, uint32_t *buf,
+				   size_t count);
+
+/**
+ * @brief Stop streaming timestamps of a capture pin.
+ */
+int ti_hercules_n2het_stream_stop(const struct device *dev, uint32_t channel);
+
+/**
+ * @brief Index of the next entry the HTU will write for a capture pin.
+ *
+ * @return Ring index, or a negative errno value.
+ */
+int ti_hercules_n2het_stream_head(const struct device *dev, uint32_t channel);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_PWM_TI_HERCULES_N2HET_H_ */
@@ -0,0 +1,47 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_SENSOR_TI_HERCULES_EQEP_H_
+#define INCLUDE_ZEPHYR_DRIVERS_SENSOR_TI_HERCULES_EQEP_H_
+
+#include <zephyr/drivers/sensor.h>
+
+/**
+ * The eQEP decodes the encoder in hardware. SENSOR_CHAN_ROTATION is the
+ * shaft angle in degrees and SENSOR_CHAN_RPM the signed speed. The speed is
+ * the position change over the last unit timer period, or at low speed the
+ * time between unit position events measured by the capture unit.
+ *
+ * Trigger handlers run in the eQEP interrupt.
+ */
+
+enum sensor_channel_ti_hercules_eqep {
+	/** Position counter, in quadrature counts */
+	SENSOR_CHAN_TI_HERCULES_EQEP_POSITION = SENSOR_CHAN_PRIV_START,
+	/** Position latched on the last index pulse */
+	SENSOR_CHAN_TI_HERCULES_EQEP_INDEX_POSITION,
+	/** Position latched on the last strobe pulse */
+	SENSOR_CHAN_TI_HERCULES_EQEP_STROBE_POSITION,
+};
+
+enum sensor_trigger_type_ti_hercules_eqep {
+	/** Index pulse */
+	SENSOR_TRIG_TI_HERCULES_EQEP_INDEX = SENSOR_TRIG_PRIV_START,
+	/** Strobe pulse */
+	SENSOR_TRIG_TI_HERCULES_EQEP_STROBE,
+	/** Position counter matched SENSOR_ATTR_TI_HERCULES_EQEP_COMPARE */
+	SENSOR_TRIG_TI_HERCULES_EQEP_COMPARE,
+};
+
+enum sensor_attribute_ti_hercules_eqep {
+	/**
+	 * Position compare value in counts (val1). A negative value disables
+	 * position compare. With compare-output set, a match also pulses the
+	 * EQEPxS pin.
+	 */
+	SENSOR_ATTR_TI_HERCULES_EQEP_COMPARE = SENSOR_ATTR_PRIV_START,
+};
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_SENSOR_TI_HERCULES_EQEP_H_ */
@@ -0,0 +1,57 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_SPI_TI_HERCULES_MIBSPI_H_
+#define INCLUDE_ZEPHYR_DRIVERS_SPI_TI_HERCULES_MIBSPI_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/types.h>
+
+/** Maximum number of data formats usable within one sequence. */
+#define TI_HERCULES_MIBSPI_FORMATS 4
+
+/** One word of a MibSPI transfer group sequence. */
+struct ti_hercules_mibspi_frame {
+	/** Word shifted out. */
+	uint16_t tx;
+	/** Word shifted in, written when the sequence completes. */
+	uint16_t rx;
+	/** Hardware chip select (SPInSCS) asserted for this word. */
+	uint8_t cs;
+	/** Index into the formats passed to ti_hercules_mibspi_sequence(). */
+	uint8_t format;
+	/** Keep the chip select asserted after this word. */
+	bool cs_hold;
+};
+
+/**
+ * @brief Run a sequence of words with per-word chip select and format.
+ *
+ * The words are loaded into the MibSPI buffer RAM as one transfer group
+ * and shifted out back to back by the hardware; the CPU is only involved
+ * once per group of up to 128 words. This suits polling several ADCs or a
+ * chain of sensors on one bus.
+ *
+ * Only the frequency and mode bits of @p formats are used, chip selects
+ * are taken from the frames.
+ *
+ * @param dev MibSPI device.
+ * @param formats Data formats, at most TI_HERCULES_MIBSPI_FORMATS.
+ * @param num_formats Number of entries in @p formats.
+ * @param frames Words to transfer, updated in place with the received data.
+ * @param num_frames Number of entries in @p frames.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if a format or frame is invalid.
+ * @retval -ETIMEDOUT if a transfer group did not complete.
+ */
+int ti_hercules_mibspi_sequence(const struct device *dev, const struct spi_config *formats,
+				size_t num_formats, struct ti_hercules_mibspi_frame *frames,
+				size_t num_frames);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_SPI_TI_HERCULES_MIBSPI_H_ */
@@ -0,0 +1,128 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_BOOT_TRACE_H_
+#define INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_BOOT_TRACE_H_
+
+/**
+ * Boot stage trace of the RM57Lx.
+ *
+ * Each stage records the CPU cycle counter (GCLK1 cycles since the start of
+ * z_arm_platform_init()) at its beginning and end. Stages before the clock
+ * controller runs are clocked by the oscillator. The trace lives in noinit
+ * RAM, so the trace of the previous boot is still available after a warm
+ * reset such as a watchdog reset.
+ *
+ *     uint32_t start = ti_hercules_boot_trace_now();
+ *
+ *     ...
+ *     ti_hercules_boot_trace_stage(TI_HERCULES_BOOT_STAGE_VIM_INIT, start);
+ */
+
+#include <zephyr/sys/util.h>
+#include <zephyr/types.h>
+
+enum ti_hercules_boot_stage {
+	/** L2RAM auto-initialization in z_arm_platform_init() */
+	TI_HERCULES_BOOT_STAGE_MEM_INIT,
+	/** PLL lock errata (SSWF021#45) workaround */
+	TI_HERCULES_BOOT_STAGE_PLL_ERRATA,
+	/** Waiting for both PLLs to be disabled before they are configured */
+	TI_HERCULES_BOOT_STAGE_PLL_DISABLE,
+	/** Whole GCM clock controller initialization */
+	TI_HERCULES_BOOT_STAGE_CLOCK_INIT,
+	/** VIM RAM copy and VIM setup */
+	TI_HERCULES_BOOT_STAGE_VIM_INIT,
+	/** End of z_arm_platform_init() up to the APPLICATION init level */
+	TI_HERCULES_BOOT_STAGE_KERNEL_INIT,
+	TI_HERCULES_BOOT_STAGE_COUNT,
+};
+
+struct ti_hercules_boot_trace_record {
+	/** Reset cause, hwinfo RESET_* flags */
+	uint32_t reset_cause;
+	/** Lock attempts of the PLL errata workaround */
+	uint32_t pll_attempts;
+	/** Attempts that ended in a PLL slip */
+	uint32_t pll_slips;
+	/** Result of the PLL errata workaround, 0 on success */
+	uint32_t pll_fail_code;
+	/** Cycle counter at the beginning and end of each stage, 0 if not run */
+	uint32_t begin[TI_HERCULES_BOOT_STAGE_COUNT];
+	uint32_t end[TI_HERCULES_BOOT_STAGE_COUNT];
+};
+
+#ifdef CONFIG_TI_HERCULES_BOOT_TRACE
+
+#include <soc_pmu.h>
+
+/** @brief Current boot trace timestamp. */
+static inline uint32_t ti_hercules_boot_trace_now(void)
+{
+	return soc_pmu_cycles();
+}
+
+/**
+ * @brief Start the trace of this boot.
+ *
+ * Called from z_arm_platform_init() once RAM is usable. Keeps the trace of
+ * the previous boot if noinit RAM survived the reset.
+ *
+ * @param reset_cause hwinfo reset cause of this boot.
+ * @param start Timestamp taken at the very start of z_arm_platform_init().
+ * @param mem_init_end Timestamp after the memory initialization.
+ */
+void ti_hercules_boot_trace_start(uint32_t reset_cause, uint32_t start, uint32_t mem_init_end);
+
+/**
+ * @brief Record a stage that started at @p begin and ends now.
+ */
+void ti_hercules_boot_trace_stage(enum ti_hercules_boot_stage stage, uint32_t begin);
+
+/** @brief Record the outcome of the PLL errata workaround. */
+void ti_hercules_boot_trace_pll(uint32_t attempts, uint32_t slips, uint32_t fail_code);
+
+/**
+ * @brief Get a boot trace.
+ *
+ * @param previous false for this boot, true for the boot before the last reset.
+ *
+ * @return The record, NULL if there is no valid trace of the previous boot.
+ */
+const struct ti_hercules_boot_trace_record *ti_hercules_boot_trace_get(bool previous);
+
+#else
+
+static inline uint32_t ti_hercules_boot_trace_now(void)
+{
+	return 0;
+}
+
+static inline void ti_hercules_boot_trace_start(uint32_t reset_cause, uint32_t start,
+						uint32_t mem_init_end)
+{
+	ARG_UNUSED(reset_cause);
+	ARG_UNUSED(start);
+	ARG_UNUSED(mem_init_end);
+}
+
+static inline void ti_hercules_boot_trace_stage(enum ti_hercules_boot_stage stage,
+						uint32_t begin)
+{
+	ARG_UNUSED(stage);
+	ARG_UNUSED(begin);
+}
+
+static inline void ti_hercules_boot_trace_pll(uint32_t attempts, uint32_t slips,
+					      uint32_t fail_code)
+{
+	ARG_UNUSED(attempts);
+	ARG_UNUSED(slips);
+	ARG_UNUSED(fail_code);
+}
+
+#endif /* CONFIG_TI_HERCULES_BOOT_TRACE */
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_BOOT_TRACE_H_ */
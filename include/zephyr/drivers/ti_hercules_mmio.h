@@ -0,0 +1,104 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_MMIO_H_
+#define INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_MMIO_H_
+
+/**
+ * Register access for the Hercules system drivers.
+ *
+ * On target these are plain volatile accesses through the register structs.
+ * With CONFIG_TI_HERCULES_MMIO_MODEL (native_sim) register blocks are mapped
+ * onto a host side behavioural model and every access goes through it, so
+ * write-1-to-clear bits, set/clear register pairs, clock source valid status
+ * and the VIM/ESM offset registers behave like the hardware.
+ *
+ *     volatile struct hercules_syscon_1_regs *sys = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+ *
+ *     HERCULES_REG_WRITE(sys, CSDISCLR, BIT(CLOCK_SRC_PLL1));
+ *     while ((HERCULES_REG_READ(sys, CSVSTAT) & BIT(CLOCK_SRC_PLL1)) == 0U) {
+ *     }
+ */
+
+#include <stddef.h>
+#include <zephyr/types.h>
+
+#ifdef CONFIG_TI_HERCULES_MMIO_MODEL
+
+/**
+ * @brief Translate a register block address into the model backing store.
+ *
+ * @param addr Physical address of a register block or register.
+ *
+ * @return Host address of the modelled register, NULL if it is not modelled.
+ */
+void *hercules_mmio_model_map(uintptr_t addr);
+
+/** @brief Read a modelled register, applying its read side effects. */
+uint32_t hercules_mmio_model_read(volatile uint32_t *reg);
+
+/** @brief Write a modelled register, applying its write side effects. */
+void hercules_mmio_model_write(volatile uint32_t *reg, uint32_t val);
+
+/** @brief Reset every modelled block to its power-on state. */
+void hercules_mmio_model_reset(void);
+
+/** @brief Raise a VIM request, as a peripheral would. */
+void hercules_mmio_model_vim_raise(unsigned int channel);
+
+/** @brief Latch an ESM error on a group (1, 2 or 3) channel. */
+void hercules_mmio_model_esm_raise(unsigned int group, unsigned int channel);
+
+/**
+ * @brief Receive a frame on the modelled EMAC.
+ *
+ * The frame is written into the buffers of the channel 0 receive queue,
+ * starting at RXHDP, and the receive interrupt is raised.
+ *
+ * @param data Frame without CRC.
+ * @param len Frame length in bytes.
+ *
+ * @retval 0 on success.
+ * @retval -ENOBUFS if the queue is too short for the frame, which is dropped.
+ */
+int hercules_mmio_model_emac_receive(const uint8_t *data, size_t len);
+
+/**
+ * @brief Take the oldest frame sent by the modelled EMAC.
+ *
+ * @param data Buffer for the frame, as put on the wire without CRC.
+ * @param size Size of @p data, a longer frame is truncated.
+ *
+ * @return Frame length, 0 if no frame is left.
+ */
+size_t hercules_mmio_model_emac_sent(uint8_t *data, size_t size);
+
+/** @brief Advance model time by a number of VCLK cycles. */
+void hercules_mmio_model_advance(uint32_t cycles);
+
+/** @brief Model time in VCLK cycles since the last reset. */
+uint64_t hercules_mmio_model_now(void);
+
+#define HERCULES_MMIO(addr)             ((void *)hercules_mmio_model_map((uintptr_t)(addr)))
+#define HERCULES_MMIO_READ32(ptr)       hercules_mmio_model_read(ptr)
+#define HERCULES_MMIO_WRITE32(ptr, val) hercules_mmio_model_write((ptr), (val))
+
+#else
+
+#define HERCULES_MMIO(addr)             ((void *)(uintptr_t)(addr))
+#define HERCULES_MMIO_READ32(ptr)       (*(ptr))
+#define HERCULES_MMIO_WRITE32(ptr, val) (*(ptr) = (val))
+
+#endif /* CONFIG_TI_HERCULES_MMIO_MODEL */
+
+/** Access register @p reg of the register block @p regs. */
+#define HERCULES_REG_READ(regs, reg)       HERCULES_MMIO_READ32(&(regs)->reg)
+#define HERCULES_REG_WRITE(regs, reg, val) HERCULES_MMIO_WRITE32(&(regs)->reg, (val))
+
+/** Read-modify-write: clear @p clr then set @p set. */
+#define HERCULES_REG_UPDATE(regs, reg, clr, set)                                                   \
+	HERCULES_REG_WRITE(regs, reg, (HERCULES_REG_READ(regs, reg) & ~(uint32_t)(clr)) | (set))
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_MMIO_H_ */
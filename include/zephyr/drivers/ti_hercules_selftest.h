@@ -0,0 +1,62 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_SELFTEST_H_
+#define INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_SELFTEST_H_
+
+/**
+ * Periodic self-test of the RM57Lx.
+ *
+ * The CPU self-test (STC) and the RAM self-test (PBIST) run in slices from a
+ * low priority work queue. An STC slice runs a few test intervals, during
+ * which the CPU is offline, a PBIST slice runs one algorithm on one RAM group
+ * while the CPU keeps running. Once every slice ran, a pass is complete and
+ * the next one starts over. Failures are reported through the ESM.
+ */
+
+#include <zephyr/types.h>
+
+struct ti_hercules_selftest_status {
+	/** Completed passes */
+	uint32_t passes;
+	/** STC intervals run in the current pass, and per pass; a failure restarts the pass */
+	uint16_t stc_intervals;
+	uint16_t stc_intervals_total;
+	/** PBIST slices run in the current pass, and per pass */
+	uint16_t pbist_slices;
+	uint16_t pbist_slices_total;
+	/** Failed STC and PBIST slices since boot */
+	uint32_t stc_failures;
+	uint32_t pbist_failures;
+	/** Longest time the CPU was offline in an STC slice, in microseconds */
+	uint32_t stc_slice_max_us;
+};
+
+#ifdef CONFIG_TI_HERCULES_SELFTEST
+
+/**
+ * @brief Get the coverage of the current pass and the results so far.
+ *
+ * @param status Filled with the status.
+ */
+void ti_hercules_selftest_status_get(struct ti_hercules_selftest_status *status);
+
+/**
+ * @brief Return into the STC slice if this reset ended it.
+ *
+ * Called first thing from z_arm_platform_init(). Returns only if the reset
+ * was not the end of an STC run.
+ */
+void ti_hercules_selftest_resume(void);
+
+#else
+
+static inline void ti_hercules_selftest_resume(void)
+{
+}
+
+#endif /* CONFIG_TI_HERCULES_SELFTEST */
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_SELFTEST_H_ */
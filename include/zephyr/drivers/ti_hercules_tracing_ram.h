@@ -0,0 +1,67 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_TRACING_RAM_H_
+#define INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_TRACING_RAM_H_
+
+/**
+ * RAM ring buffer tracing backend of the RM57Lx.
+ *
+ * The CTF events of the tracing subsystem are copied into a ring buffer and
+ * drained later, by the backend itself over the zephyr,tracing-uart chosen
+ * UART, by the application through ti_hercules_tracing_ram_read() or by a
+ * debugger. Events are timestamped with k_cycle_get_32(), the RTI free
+ * running counter.
+ *
+ * The ring is the global ti_hercules_tracing_ring: the unread stream is
+ * data[tail % size] up to data[head % size]. A halted target can be dumped
+ * from GDB with, for an unwrapped ring:
+ *
+ *     dump binary memory trace.bin \
+ *         &ti_hercules_tracing_ring.data[ti_hercules_tracing_ring.tail % size] \
+ *         &ti_hercules_tracing_ring.data[ti_hercules_tracing_ring.head % size]
+ *
+ * and decoded with babeltrace and the Zephyr CTF metadata.
+ */
+
+#include <stddef.h>
+#include <zephyr/types.h>
+
+struct ti_hercules_tracing_ring {
+	/** Bytes written since boot, only advanced by the tracing subsystem */
+	volatile uint32_t head;
+	/** Bytes read since boot, only advanced by the reader */
+	volatile uint32_t tail;
+	/** Events dropped because the ring was full */
+	volatile uint32_t dropped;
+	uint8_t data[CONFIG_TI_HERCULES_TRACING_RAM_SIZE];
+};
+
+extern struct ti_hercules_tracing_ring ti_hercules_tracing_ring;
+
+/**
+ * @brief Read the oldest trace bytes.
+ *
+ * Events are never split when they are written, so the concatenation of
+ * everything read is a valid CTF stream. Readers, including the UART drain
+ * of the backend, are serialised but share the stream: bytes taken by one
+ * are gone for the others. Callable from any context. Interrupts are locked
+ * while the bytes are copied, so read in small chunks.
+ *
+ * @param buf Destination buffer.
+ * @param len Size of @p buf.
+ *
+ * @return Number of bytes copied into @p buf.
+ */
+size_t ti_hercules_tracing_ram_read(uint8_t *buf, size_t len);
+
+/**
+ * @brief Number of events dropped since boot because the ring was full.
+ *
+ * A growing count means the ring is drained too slowly for the event rate.
+ */
+uint32_t ti_hercules_tracing_ram_dropped(void);
+
+#endif /* INCLUDE_ZEPHYR_DRIVERS_TI_HERCULES_TRACING_RAM_H_ */
@@ -0,0 +1,25 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef INCLUDE_ZEPHYR_DT_BINDINGS_PINCTRL_TI_HERCULES_IOMM_H_
+#define INCLUDE_ZEPHYR_DT_BINDINGS_PINCTRL_TI_HERCULES_IOMM_H_
+
+/**
+ * Every PINMMR register holds four 8 bit fields. Output multiplexing fields
+ * select the function of a ball with a single set bit, input multiplexing
+ * and the remaining control fields take a plain value. Register and field
+ * numbers are listed in the "Pin Multiplexing" tables of the datasheet,
+ * e.g. PINMMR9[16] is register 9, field 2, function 0.
+ */
+#define TI_HERCULES_PINMUX_RAW(reg, field, val)                                                    \
+	((((reg) & 0xFF) << 16) | (((field) & 0x3) << 8) | ((val) & 0xFF))
+
+#define TI_HERCULES_PINMUX(reg, field, func) TI_HERCULES_PINMUX_RAW(reg, field, 1 << (func))
+
+/** EMAC interface select (PINMMR160[24]) */
+#define TI_HERCULES_PINMUX_EMAC_MII  TI_HERCULES_PINMUX_RAW(160, 3, 0)
+#define TI_HERCULES_PINMUX_EMAC_RMII TI_HERCULES_PINMUX_RAW(160, 3, 1)
+
+#endif /* INCLUDE_ZEPHYR_DT_BINDINGS_PINCTRL_TI_HERCULES_IOMM_H_ */
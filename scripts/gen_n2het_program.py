@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+# Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Generate the N2HET instruction images for every enabled ti,hercules-n2het node.
+
+The program is laid out the same way for every instance:
+
+    0                 CNT   free running LR timebase in register T
+    per PWM pin       PWCNT duty counter driving the pin (HR)
+                      DJZ   period counter, branches to the reload block at 0
+    per capture pin   PCNT  pulse width (HR)
+                      PCNT  period (HR), raises the capture interrupt
+                      WCAP  timestamp of the rising edge, requests the HTU
+    last main insn    next = 0 ends the loop
+    per PWM pin       MOV64 copies the shadow duty/action into the PWCNT
+                      MOV32 copies the shadow period into the DJZ and resumes
+                            after the DJZ
+
+The driver only ever writes the reload (shadow) instructions, so a new period
+and duty take effect together on the next period boundary.
+
+Field positions follow the N2HET instruction set chapter of the RM57Lx TRM.
+"""
+
+import argparse
+import os
+import pickle
+import sys
+
+MAX_INSTRUCTIONS = 160
+MAX_PINS = 32
+MAX_HTU_REQUESTS = 8
+LR_DATA_MAX = (1 << 25) - 1
+
+# Opcodes, program field bits 12:9
+OP_ECMP = 0x0
+OP_MOV64 = 0x1
+OP_MOV32 = 0x4
+OP_CNT = 0x6
+OP_PCNT = 0x7
+OP_CNT_GROUP = 0xA
+OP_WCAP = 0xD
+
+# Sub-opcodes of the 0xA group, program field bits 8:7
+SUB_DJZ = 0x1
+SUB_PWCNT = 0x3
+
+# Register select
+REG_A = 0x0
+REG_B = 0x1
+REG_T = 0x2
+REG_NONE = 0x3
+
+# Pin actions, control field bits 4:3
+ACTION_PULSELO = 0x2
+ACTION_PULSEHI = 0x3
+
+# PCNT measurement type, program field bits 8:7
+PCNT_FALL2RISE = 0x1
+PCNT_RISE2FALL = 0x2
+PCNT_RISE2RISE = 0x3
+
+# WCAP edge select, control field bits 6:5
+EDGE_RISING = 0x1
+
+# MOV32 move type, control field bits 6:5: immediate data to remote data field
+MOV32_IMTOREG_REM = 0x2
+
+
+def program(next_addr, opcode, extra=0, reqnum=None):
+    word = ((next_addr & 0x1FF) << 13) | ((opcode & 0xF) << 9) | (extra & 0x1FF)
+    if reqnum is not None:
+        # Request enable at bit 22, request number at bits 25:23
+        word |= (1 << 22) | ((reqnum & 0x7) << 23)
+    return word
+
+
+def control(cond_addr=0, pin=0, action=0, reg=REG_NONE, irq=False, extra=0):
+    return (((cond_addr & 0x1FF) << 13) | ((pin & 0x1F) << 8) | ((action & 0x3) << 3)
+            | ((reg & 0x3) << 1) | (1 if irq else 0) | extra)
+
+
+def data(lr=0, hr=0):
+    return ((lr & LR_DATA_MAX) << 7) | (hr & 0x7F)
+
+
+class Instruction:
+    def __init__(self, comment, prog=0, ctrl=0, dat=0):
+        self.comment = comment
+        self.prog = prog
+        self.ctrl = ctrl
+        self.dat = dat
+
+
+def build(node):
+    name = node.labels[0] if node.labels else node.name
+    pwm_pins = list(node.props["pwm-pins"].val) if "pwm-pins" in node.props else []
+    cap_pins = list(node.props["capture-pins"].val) if "capture-pins" in node.props else []
+
+    for pin in pwm_pins + cap_pins:
+        if not 0 <= pin < MAX_PINS:
+            sys.exit(f"{name}: N2HET pin {pin} out of range")
+    if len(set(pwm_pins + cap_pins)) != len(pwm_pins + cap_pins):
+        sys.exit(f"{name}: an N2HET pin is listed more than once")
+
+    main_len = 1 + 2 * len(pwm_pins) + 3 * len(cap_pins)
+    total = main_len + 2 * len(pwm_pins)
+    if total > MAX_INSTRUCTIONS:
+        sys.exit(f"{name}: N2HET program needs {total} instructions, only "
+                 f"{MAX_INSTRUCTIONS} fit")
+
+    hr_prescale = node.props["hr-prescale"].val
+    lr_prescale = node.props["lr-prescale"].val
+    # Worst case loop: every instruction plus one reload block, ~1 VCLK2 each
+    if main_len + 2 > hr_prescale * lr_prescale:
+        sys.exit(f"{name}: N2HET program does not fit in one loop, "
+                 f"increase hr-prescale or lr-prescale")
+
+    def nxt(addr):
+        # Branching to 0 ends the current loop
+        return addr if addr < main_len else 0
+
+    insns = [None] * total
+    pwm_chans = []
+    cap_chans = []
+    irq_lut = [0xFF] * 32
+
+    insns[0] = Instruction("CNT: LR timebase",
+                           program(nxt(1), OP_CNT, REG_T << 6),
+                           LR_DATA_MAX,
+                           data(0))
+
+    addr = 1
+    reload = main_len
+    for pin in pwm_pins:
+        duty, period = addr, addr + 1
+        insns[duty] = Instruction(f"PWCNT: PWM pin {pin} duty",
+                                  program(period, OP_CNT_GROUP,
+                                          (SUB_PWCNT << 7) | (1 << 6)),
+                                  control(period, pin, ACTION_PULSEHI),
+                                  data(0))
+        insns[period] = Instruction(f"DJZ: PWM pin {pin} period",
+                                    program(nxt(period + 1), OP_CNT_GROUP, SUB_DJZ << 7),
+                                    control(reload),
+                                    data(0))
+        insns[reload] = Instruction(f"MOV64: PWM pin {pin} duty reload",
+                                    program(reload + 1, OP_MOV64, duty),
+                                    control(0, pin, ACTION_PULSEHI),
+                                    data(0))
+        insns[reload + 1] = Instruction(f"MOV32: PWM pin {pin} period reload",
+                                        program(nxt(period + 1), OP_MOV32, period),
+                                        control(extra=MOV32_IMTOREG_REM << 5),
+                                        data(0))
+        pwm_chans.append((pin, duty, reload, reload + 1))
+        addr += 2
+        reload += 2
+
+    for idx, pin in enumerate(cap_pins):
+        pulse, period, stamp = addr, addr + 1, addr + 2
+        if irq_lut[period % 32] != 0xFF:
+            sys.exit(f"{name}: capture interrupts of pin {pin} and another pin collide")
+        irq_lut[period % 32] = idx
+        request = idx if idx < MAX_HTU_REQUESTS else None
+        insns[pulse] = Instruction(f"PCNT: capture pin {pin} pulse",
+                                   program(period, OP_PCNT, (PCNT_RISE2FALL << 7) | (1 << 6)
+                                           | pin),
+                                   control(),
+                                   data(0))
+        insns[period] = Instruction(f"PCNT: capture pin {pin} period",
+                                    program(stamp, OP_PCNT, (PCNT_RISE2RISE << 7) | (1 << 6)
+                                            | pin),
+                                    control(irq=True),
+                                    data(0))
+        insns[stamp] = Instruction(f"WCAP: capture pin {pin} timestamp",
+                                   program(nxt(stamp + 1), OP_WCAP, 1 << 6, request),
+                                   control(0, pin, 0, REG_T, extra=EDGE_RISING << 5),
+                                   data(0))
+        cap_chans.append((pin, pulse, period, stamp,
+                          0xFF if request is None else request))
+        addr += 3
+
+    pwm_lut = [0xFF] * MAX_PINS
+    for idx, (pin, *_) in enumerate(pwm_chans):
+        pwm_lut[pin] = idx
+    cap_lut = [0xFF] * MAX_PINS
+    for idx, (pin, *_) in enumerate(cap_chans):
+        cap_lut[pin] = idx
+
+    return {
+        "name": name,
+        "insns": insns,
+        "pwm": pwm_chans,
+        "cap": cap_chans,
+        "pwm_lut": pwm_lut,
+        "cap_lut": cap_lut,
+        "irq_lut": irq_lut,
+    }
+
+
+def lut(values):
+    return "{" + ", ".join(f"0x{v:02X}" for v in values) + "}"
+
+
+def emit(out, ord_, img):
+    out.write(f"/* {img['name']} */\n")
+    out.write(f"#define N2HET_PROGRAM_{ord_} \\\n\t{{ \\\n")
+    for i, insn in enumerate(img["insns"]):
+        out.write(f"\t\t/* {i:3d} {insn.comment} */ \\\n")
+        out.write(f"\t\t{{0x{insn.prog:08X}U, 0x{insn.ctrl:08X}U, 0x{insn.dat:08X}U, 0U}}, \\\n")
+    out.write("\t}\n")
+    out.write(f"#define N2HET_PROGRAM_LEN_{ord_} {len(img['insns'])}U\n")
+
+    out.write(f"#define N2HET_PWM_CHANNELS_{ord_} {{")
+    out.write(", ".join(f"{{{p}, {d}, {rd}, {rp}}}" for p, d, rd, rp in img["pwm"]))
+    out.write("}\n")
+    out.write(f"#define N2HET_PWM_COUNT_{ord_} {len(img['pwm'])}U\n")
+    out.write(f"#define N2HET_PWM_LUT_{ord_} {lut(img['pwm_lut'])}\n")
+
+    out.write(f"#define N2HET_CAPTURE_CHANNELS_{ord_} {{")
+    out.write(", ".join(f"{{{p}, {pu}, {pe}, {st}, 0x{rq:02X}}}"
+                        for p, pu, pe, st, rq in img["cap"]))
+    out.write("}\n")
+    out.write(f"#define N2HET_CAPTURE_COUNT_{ord_} {len(img['cap'])}U\n")
+    out.write(f"#define N2HET_CAPTURE_LUT_{ord_} {lut(img['cap_lut'])}\n")
+    out.write(f"#define N2HET_IRQ_LUT_{ord_} {lut(img['irq_lut'])}\n\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--edt-pickle", required=True, help="devicetree pickle (edt.pickle)")
+    parser.add_argument("--output", required=True, help="generated header")
+    args = parser.parse_args()
+
+    with open(args.edt_pickle, "rb") as f:
+        edt = pickle.load(f)
+
+    os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    with open(args.output, "w") as out:
+        out.write("/* Generated by gen_n2het_program.py, do not edit. */\n\n")
+        out.write("#ifndef N2HET_PROGRAM_H_\n#define N2HET_PROGRAM_H_\n\n")
+        for node in edt.compat2okay.get("ti,hercules-n2het", []):
+            emit(out, node.dep_ordinal, build(node))
+        out.write("#endif /* N2HET_PROGRAM_H_ */\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,138 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <soc_pmu.h>
+
+#include <zephyr/drivers/ti_hercules_boot_trace.h>
+#include <zephyr/init.h>
+#include <zephyr/linker/section_tags.h>
+#include <zephyr/sys/util.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(soc_boot_trace, CONFIG_SOC_LOG_LEVEL);
+
+#define BOOT_TRACE_MAGIC 0x42545243U /* "BTRC" */
+
+struct boot_trace_log {
+	uint32_t magic;
+	uint32_t boot_count;
+	bool previous_valid;
+	struct ti_hercules_boot_trace_record previous;
+	struct ti_hercules_boot_trace_record current;
+};
+
+/* Left alone by the C runtime init, and by the memory init after warm resets */
+static __noinit struct boot_trace_log trace_log;
+
+static const char *const stage_names __maybe_unused[TI_HERCULES_BOOT_STAGE_COUNT] = {
+	[TI_HERCULES_BOOT_STAGE_MEM_INIT] = "mem-init",
+	[TI_HERCULES_BOOT_STAGE_PLL_ERRATA] = "pll-errata",
+	[TI_HERCULES_BOOT_STAGE_PLL_DISABLE] = "pll-disable",
+	[TI_HERCULES_BOOT_STAGE_CLOCK_INIT] = "clock-init",
+	[TI_HERCULES_BOOT_STAGE_VIM_INIT] = "vim-init",
+	[TI_HERCULES_BOOT_STAGE_KERNEL_INIT] = "kernel-init",
+};
+
+void ti_hercules_boot_trace_start(uint32_t reset_cause, uint32_t start, uint32_t mem_init_end)
+{
+	if (trace_log.magic == BOOT_TRACE_MAGIC) {
+		trace_log.previous = trace_log.current;
+		trace_log.previous_valid = true;
+		trace_log.boot_count++;
+	} else {
+		trace_log.magic = BOOT_TRACE_MAGIC;
+		trace_log.previous_valid = false;
+		trace_log.boot_count = 1U;
+	}
+
+	(void)memset(&trace_log.current, 0, sizeof(trace_log.current));
+	trace_log.current.reset_cause = reset_cause;
+	trace_log.current.begin[TI_HERCULES_BOOT_STAGE_MEM_INIT] = start;
+	trace_log.current.end[TI_HERCULES_BOOT_STAGE_MEM_INIT] = mem_init_end;
+}
+
+void ti_hercules_boot_trace_stage(enum ti_hercules_boot_stage stage, uint32_t begin)
+{
+	if (stage >= TI_HERCULES_BOOT_STAGE_COUNT) {
+		return;
+	}
+	trace_log.current.begin[stage] = begin;
+	trace_log.current.end[stage] = soc_pmu_cycles();
+}
+
+void ti_hercules_boot_trace_pll(uint32_t attempts, uint32_t slips, uint32_t fail_code)
+{
+	trace_log.current.pll_attempts = attempts;
+	trace_log.current.pll_slips = slips;
+	trace_log.current.pll_fail_code = fail_code;
+}
+
+const struct ti_hercules_boot_trace_record *ti_hercules_boot_trace_get(bool previous)
+{
+	if (previous) {
+		return trace_log.previous_valid ? &trace_log.previous : NULL;
+	}
+	return &trace_log.current;
+}
+
+static int boot_trace_init_done(void)
+{
+	/* The kernel stage starts where the platform init (memory init) ended */
+	ti_hercules_boot_trace_stage(TI_HERCULES_BOOT_STAGE_KERNEL_INIT,
+				     trace_log.current.end[TI_HERCULES_BOOT_STAGE_MEM_INIT]);
+
+#ifdef CONFIG_TI_HERCULES_BOOT_TRACE_LOG
+	const struct ti_hercules_boot_trace_record *rec = &trace_log.current;
+
+	LOG_INF("boot %u, reset cause 0x%x, PLL attempts %u slips %u fail %u",
+		trace_log.boot_count, rec->reset_cause, rec->pll_attempts, rec->pll_slips,
+		rec->pll_fail_code);
+	for (int i = 0; i < TI_HERCULES_BOOT_STAGE_COUNT; i++) {
+		LOG_INF("%-12s %10u cycles (at %u)", stage_names[i], rec->end[i] - rec->begin[i],
+			rec->begin[i]);
+	}
+#endif
+	return 0;
+}
+
+SYS_INIT(boot_trace_init_done, APPLICATION, 0);
+
+#ifdef CONFIG_SHELL
+#include <zephyr/shell/shell.h>
+
+static int cmd_boot_trace(const struct shell *sh, size_t argc, char **argv)
+{
+	bool previous = argc > 1 && strcmp(argv[1], "prev") == 0;
+	const struct ti_hercules_boot_trace_record *rec = ti_hercules_boot_trace_get(previous);
+
+	if (rec == NULL) {
+		shell_error(sh, "No trace of the previous boot");
+		return -ENOENT;
+	}
+
+	shell_print(sh, "boot %u%s", previous ? trace_log.boot_count - 1U : trace_log.boot_count,
+		    previous ? " (previous)" : "");
+	shell_print(sh, "reset cause: 0x%08x", rec->reset_cause);
+	shell_print(sh, "PLL errata: %u attempts, %u slips, fail code %u", rec->pll_attempts,
+		    rec->pll_slips, rec->pll_fail_code);
+	shell_print(sh, "%-12s %10s %10s", "stage", "start", "cycles");
+	for (int i = 0; i < TI_HERCULES_BOOT_STAGE_COUNT; i++) {
+		if (rec->end[i] == 0U) {
+			shell_print(sh, "%-12s %10s %10s", stage_names[i], "-", "-");
+			continue;
+		}
+		shell_print(sh, "%-12s %10u %10u", stage_names[i], rec->begin[i],
+			    rec->end[i] - rec->begin[i]);
+	}
+	return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(boot_trace, NULL, "Show the boot stage trace [prev]", cmd_boot_trace, 1,
+		       1);
+#endif /* CONFIG_SHELL */
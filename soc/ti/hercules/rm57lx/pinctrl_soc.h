@@ -0,0 +1,30 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TI_HERCULES_RM57LX_PINCTRL_SOC_H_
+#define TI_HERCULES_RM57LX_PINCTRL_SOC_H_
+
+#include <zephyr/devicetree.h>
+#include <zephyr/dt-bindings/pinctrl/ti-hercules-iomm.h>
+#include <zephyr/types.h>
+
+/** A PINMMR field, encoded with TI_HERCULES_PINMUX_RAW() */
+typedef uint32_t pinctrl_soc_pin_t;
+
+#define TI_HERCULES_PINMUX_REG(pin)   (((pin) >> 16) & 0xFFU)
+#define TI_HERCULES_PINMUX_FIELD(pin) (((pin) >> 8) & 0x3U)
+#define TI_HERCULES_PINMUX_VAL(pin)   ((pin) & 0xFFU)
+#define TI_HERCULES_PINMUX_SHIFT(pin) (TI_HERCULES_PINMUX_FIELD(pin) * 8U)
+
+#define Z_PINCTRL_TI_HERCULES_PIN(node_id, prop, idx) DT_PROP_BY_IDX(node_id, prop, idx)
+
+#define Z_PINCTRL_STATE_PIN_INIT(node_id, prop, idx)                                               \
+	DT_FOREACH_PROP_ELEM_SEP(DT_PHANDLE_BY_IDX(node_id, prop, idx), pinmux,                    \
+				 Z_PINCTRL_TI_HERCULES_PIN, (,)),
+
+#define Z_PINCTRL_STATE_PINS_INIT(node_id, prop)                                                   \
+	{DT_FOREACH_PROP_ELEM(node_id, prop, Z_PINCTRL_STATE_PIN_INIT)}
+
+#endif /* TI_HERCULES_RM57LX_PINCTRL_SOC_H_ */
@@ -0,0 +1,267 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Low power modes of the RM57Lx, entered from the idle thread:
+ *
+ * - doze (runtime-idle): only the main oscillator and RTICLK1 keep running.
+ * - snooze (suspend-to-idle): the oscillator is stopped as well, RTICLK1 may
+ *   keep running from the low frequency LPO.
+ * - sleep (standby): every clock source and domain is stopped.
+ *
+ * The GCM gates the selected sources and domains once the CPU executes WFI.
+ * Any VIM channel enabled in the wake masks restarts GCLK1, HCLK and VCLK from
+ * the GHVWAKE source (set with a CLOCK_ON_WAKEUP clocks cell); the remaining
+ * sources and domains are restored in software on exit. Snooze and sleep also
+ * switch the pins to their "sleep" states.
+ *
+ * A state that gates RTICLK1 stops the system tick, so nothing but a wakeup
+ * source would end it. Such states are locked at boot, or with the custom PM
+ * policy only entered while no timeout is pending.
+ */
+
+#include <soc.h>
+#include <soc_pmu.h>
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/interrupt_controller/intc_ti_hercules_vim.h>
+#include <zephyr/drivers/pinctrl/pinctrl_ti_hercules.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/init.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/pm/pm.h>
+#include <zephyr/pm/policy.h>
+#include <zephyr/pm/state.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(soc_pm, CONFIG_SOC_LOG_LEVEL);
+
+#define GCM_NODE     DT_NODELABEL(gcm)
+#define CPU0_NODE    DT_PATH(cpus, cpu_0)
+#define PM_STATES    DT_NUM_CPU_POWER_STATES(CPU0_NODE)
+#define RTI_NODE     DT_NODELABEL(rti)
+#define RTI_IRQ      DT_IRQ_BY_IDX(RTI_NODE, 0, irq)
+#define VIM_CHANNELS 128U
+
+#define GHVSRC_GHVWAKE(reg)  (((reg) >> 24) & 0xFU)
+#define RCLKSRC_RTI1SRC(reg) ((reg) & 0xFU)
+
+/* Clock sources that can feed RTICLK1 while the VCLK domain is stopped */
+#define RTI_LP_SOURCES (BIT(CLOCK_SRC_OSCILLATOR) | BIT(CLOCK_SRC_LF_LPO) | BIT(CLOCK_SRC_HF_LPO))
+
+#define ALL_SOURCES (BIT_MASK(CLOCK_SRC_EXTCLKIN2 + 1) & ~BIT(CLOCK_SRC_RESERVED))
+#define ALL_DOMAINS (BIT_MASK(CLOCK_DOM_VCLKA4 + 1))
+
+struct soc_pm_context {
+	uint32_t csdis;
+	uint32_t cddis;
+	uint32_t ghvsrc;
+	uint32_t entry_cycles;
+	int state;
+};
+
+static struct soc_pm_context pm_ctx;
+/* Worst measured entry plus exit time of each CPU power state, in microseconds */
+static uint32_t pm_overhead_us[PM_STATES];
+/* States that gate RTICLK1 with the RTI clock source selected at boot */
+static bool pm_stops_tick[PM_STATES];
+static uint32_t gclk_mhz;
+static uint32_t wake_mhz;
+
+static int soc_pm_state_index(enum pm_state state, uint8_t substate_id)
+{
+	const struct pm_state_info *states;
+	uint8_t num_states = pm_state_cpu_get_all(0, &states);
+
+	for (uint8_t i = 0; i < num_states; i++) {
+		if (states[i].state == state && states[i].substate_id == substate_id) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/* RTICLK1 source if it can keep running with the VCLK domain stopped, else 0 */
+static uint32_t soc_pm_rti_source(volatile struct hercules_syscon_1_regs *sys_regs_1)
+{
+	return BIT(RCLKSRC_RTI1SRC(HERCULES_REG_READ(sys_regs_1, RCLKSRC))) & RTI_LP_SOURCES;
+}
+
+/* Clock sources and domains left running in a state */
+static int soc_pm_keep(enum pm_state state, uint32_t rti_src, uint32_t *sources,
+		       uint32_t *domains)
+{
+	switch (state) {
+	case PM_STATE_RUNTIME_IDLE:
+		*sources = BIT(CLOCK_SRC_OSCILLATOR) | rti_src;
+		*domains = rti_src != 0U ? BIT(CLOCK_DOM_RTICLK1) : 0U;
+		break;
+	case PM_STATE_SUSPEND_TO_IDLE:
+		*sources = rti_src & ~BIT(CLOCK_SRC_OSCILLATOR);
+		*domains = *sources != 0U ? BIT(CLOCK_DOM_RTICLK1) : 0U;
+		break;
+	case PM_STATE_STANDBY:
+		*sources = 0U;
+		*domains = 0U;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+	return 0;
+}
+
+void pm_state_set(enum pm_state state, uint8_t substate_id)
+{
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	uint32_t start = soc_pmu_cycles();
+	uint32_t keep_sources, keep_domains;
+
+	if (soc_pm_keep(state, soc_pm_rti_source(sys_regs_1), &keep_sources, &keep_domains) != 0) {
+		LOG_DBG("Unsupported power state %u", state);
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_PINCTRL_TI_HERCULES) && state != PM_STATE_RUNTIME_IDLE) {
+		ti_hercules_pinctrl_apply_image(TI_HERCULES_PINCTRL_IMAGE_SLEEP);
+	}
+
+	pm_ctx.state = soc_pm_state_index(state, substate_id);
+	pm_ctx.csdis = HERCULES_REG_READ(sys_regs_1, CSDIS);
+	pm_ctx.cddis = HERCULES_REG_READ(sys_regs_1, CDDIS);
+	pm_ctx.ghvsrc = HERCULES_REG_READ(sys_regs_1, GHVSRC);
+
+	HERCULES_REG_WRITE(sys_regs_1, CSDISSET, ALL_SOURCES & ~keep_sources);
+	HERCULES_REG_WRITE(sys_regs_1, CDDISSET, ALL_DOMAINS & ~keep_domains);
+	pm_ctx.entry_cycles = soc_pmu_cycles() - start;
+
+	/* Wakes on any VIM channel in the wake mask, even with interrupts locked */
+	__asm__ volatile("dsb\n\t"
+			 "wfi" ::: "memory");
+}
+
+void pm_state_exit_post_ops(enum pm_state state, uint8_t substate_id)
+{
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	uint32_t start = soc_pmu_cycles();
+	uint32_t sources = ~pm_ctx.csdis & ALL_SOURCES;
+	uint32_t overhead;
+
+	ARG_UNUSED(substate_id);
+
+	/* Still running from the GHVWAKE source here */
+	HERCULES_REG_WRITE(sys_regs_1, CSDISCLR, sources);
+	while ((HERCULES_REG_READ(sys_regs_1, CSVSTAT) & sources) != sources) {
+		/* Oscillator start up and PLL lock */
+	}
+	HERCULES_REG_WRITE(sys_regs_1, CDDISCLR, ~pm_ctx.cddis & ALL_DOMAINS);
+	HERCULES_REG_WRITE(sys_regs_1, GHVSRC, pm_ctx.ghvsrc);
+	if (IS_ENABLED(CONFIG_PINCTRL_TI_HERCULES) && state != PM_STATE_RUNTIME_IDLE) {
+		ti_hercules_pinctrl_apply_image(TI_HERCULES_PINCTRL_IMAGE_DEFAULT);
+	}
+
+	if (pm_ctx.state >= 0 && gclk_mhz != 0U && wake_mhz != 0U) {
+		overhead = pm_ctx.entry_cycles / gclk_mhz + (soc_pmu_cycles() - start) / wake_mhz;
+		pm_overhead_us[pm_ctx.state] = MAX(pm_overhead_us[pm_ctx.state], overhead);
+	}
+
+	irq_unlock(0);
+}
+
+#ifdef CONFIG_PM_POLICY_CUSTOM
+/*
+ * Same as the default residency policy, but the exit latency of each state is
+ * raised to the worst entry plus exit time measured so far, so restoring the
+ * PLLs never makes a wakeup late. States that stop the tick are only used
+ * when no timeout is pending.
+ */
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	const struct pm_state_info *states;
+	uint8_t num_states = pm_state_cpu_get_all(cpu, &states);
+	int64_t budget_us = -1;
+
+	if (ticks != K_TICKS_FOREVER) {
+		budget_us = k_ticks_to_us_floor64(ticks);
+	}
+
+	for (int i = (int)num_states - 1; i >= 0; i--) {
+		const struct pm_state_info *info = &states[i];
+		uint32_t exit_us = MAX(info->exit_latency_us, pm_overhead_us[i]);
+
+		if (pm_policy_state_lock_is_active(info->state, info->substate_id)) {
+			continue;
+		}
+		if (pm_stops_tick[i] && ticks != K_TICKS_FOREVER) {
+			continue;
+		}
+		if (budget_us < 0 || budget_us >= (int64_t)info->min_residency_us + exit_us) {
+			return info;
+		}
+	}
+	return NULL;
+}
+#endif /* CONFIG_PM_POLICY_CUSTOM */
+
+#define SOC_PM_WAKEUP_IRQ(idx, node_id)                                                            \
+	ti_hercules_vim_wakeup_set(DT_IRQ_BY_IDX(node_id, idx, irq), true);
+
+#define SOC_PM_WAKEUP_NODE(node_id)                                                                \
+	IF_ENABLED(DT_PROP_OR(node_id, wakeup_source, 0),                                          \
+		   (LISTIFY(DT_NUM_IRQS(node_id), SOC_PM_WAKEUP_IRQ, (), node_id)))
+
+static int soc_pm_init(void)
+{
+	const struct device *gcm = DEVICE_DT_GET(GCM_NODE);
+	volatile struct hercules_syscon_1_regs *sys_regs_1 = HERCULES_MMIO(DT_REG_ADDR(SYS1_NODE));
+	struct ti_herc_periph_clk gclk = {
+		.domain = CLOCK_DOM_GCLK1,
+		.source = CLOCK_SRC_NONE,
+	};
+	struct ti_herc_periph_clk wake = {
+		.source = GHVSRC_GHVWAKE(HERCULES_REG_READ(sys_regs_1, GHVSRC)),
+	};
+	const struct pm_state_info *states;
+	uint8_t num_states = pm_state_cpu_get_all(0, &states);
+	uint32_t rti_src = soc_pm_rti_source(sys_regs_1);
+	uint32_t sources, domains;
+	uint32_t rate;
+
+	/* With RTICLK1 on VCLK (the default) every state stops the tick */
+	for (uint8_t i = 0; i < num_states; i++) {
+		if (soc_pm_keep(states[i].state, rti_src, &sources, &domains) != 0 ||
+		    (domains & BIT(CLOCK_DOM_RTICLK1)) != 0U) {
+			continue;
+		}
+		pm_stops_tick[i] = true;
+		if (!IS_ENABLED(CONFIG_PM_POLICY_CUSTOM)) {
+			pm_policy_state_lock_get(states[i].state, states[i].substate_id);
+			LOG_WRN("%s stops RTICLK1, disabled", pm_state_to_str(states[i].state));
+		}
+	}
+
+	/* Only the system timer and devices marked as wakeup sources wake the device */
+	for (unsigned int irq = 0; irq < VIM_CHANNELS; irq++) {
+		ti_hercules_vim_wakeup_set(irq, false);
+	}
+	ti_hercules_vim_wakeup_set(RTI_IRQ, true);
+	DT_FOREACH_STATUS_OKAY_NODE(SOC_PM_WAKEUP_NODE)
+
+	soc_pmu_cycles_enable();
+	if (clock_control_get_rate(gcm, (clock_control_subsys_t)&gclk, &rate) == 0) {
+		gclk_mhz = rate / MHZ(1);
+	}
+	if (clock_control_get_rate(gcm, (clock_control_subsys_t)&wake, &rate) == 0) {
+		wake_mhz = rate / MHZ(1);
+	}
+	return 0;
+}
+
+SYS_INIT(soc_pm_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -0,0 +1,301 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Periodic STC and PBIST self-test, sliced so the diagnostics never take the
+ * system offline for long:
+ *
+ * - STC: the STC continues where the previous run stopped unless told to
+ *   restart, so each slice runs CONFIG_TI_HERCULES_SELFTEST_STC_SLICE
+ *   intervals. The CPU is reset at the end of every run and resumes in the
+ *   slice through ti_hercules_selftest_resume(), see stc.S.
+ * - PBIST: each slice runs one algorithm on one RAM group. The CPU is not
+ *   involved, the work queue only polls for the end of the slice.
+ */
+
+#include <soc.h>
+#include <soc_stc.h>
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/misc/ti_hercules_esm/ti_hercules_esm.h>
+#include <zephyr/drivers/ti_hercules_selftest.h>
+#include <zephyr/drivers/ti_hercules_sys_regs.h>
+#include <zephyr/init.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(soc_selftest, CONFIG_SOC_LOG_LEVEL);
+
+#define SYS1_REGS  ((volatile struct hercules_syscon_1_regs *)DT_REG_ADDR(SYS1_NODE))
+#define SYS2_REGS  ((volatile struct hercules_syscon_2_regs *)DT_REG_ADDR(SYS2_NODE))
+#define STC_REGS   ((volatile struct hercules_stc_regs *)DT_REG_ADDR(STC1_NODE))
+#define PBIST_REGS ((volatile struct hercules_pbist_regs *)DT_REG_ADDR(PBIST_NODE))
+
+#define POPCOUNT(x) __builtin_popcount(x)
+
+#define STC_INTERVALS    CONFIG_TI_HERCULES_SELFTEST_STC_INTERVALS
+#define STC_TIMEOUT      CONFIG_TI_HERCULES_SELFTEST_STC_TIMEOUT
+#define PBIST_ALGOS      CONFIG_TI_HERCULES_SELFTEST_PBIST_ALGORITHMS
+#define PBIST_RAMS       CONFIG_TI_HERCULES_SELFTEST_PBIST_RAM_GROUPS
+#define PBIST_MEM_INIT   CONFIG_TI_HERCULES_SELFTEST_PBIST_MEM_INIT
+#define PBIST_SLICES     (POPCOUNT(PBIST_ALGOS) * POPCOUNT(PBIST_RAMS))
+#define SLICE_INTERVAL   K_MSEC(CONFIG_TI_HERCULES_SELFTEST_INTERVAL)
+#define PBIST_POLL       K_MSEC(1)
+#define MEM_INIT_WAIT_US 1000U
+
+#define STCGCR0_INTCOUNT(n) ((uint32_t)(n) << 16)
+#define STCGCR0_RS_CNT      BIT(0)
+#define STCGCR1_STC_ENA     0xAU
+#define STCGCR1_STC_DIS     0x5U
+#define STCGSTAT_TEST_DONE  BIT(0)
+#define STCGSTAT_TEST_FAIL  BIT(1)
+#define STCFSTAT_TO_ERR     BIT(2)
+#define STCCLKDIV_CLKDIV(n) ((uint32_t)(n) << 24)
+#define SYSESR_CPURST       BIT(5)
+
+#define MSTGCR_MSTGENA_MASK 0xFU
+#define MSTGCR_MSTGENA_ON   0xAU
+#define MSTGCR_MSTGENA_OFF  0x5U
+#define MSTGCR_ROM_DIV_MASK (0x3U << 8)
+#define MSTGCR_ROM_DIV_2    (0x1U << 8)
+#define MINITGCR_ON         0xAU
+#define MINITGCR_OFF        0x5U
+#define MSINENA_PBIST       BIT(0)
+#define MSTCGSTAT_MSTDONE   BIT(0)
+#define MSTCGSTAT_MINIDONE  BIT(8)
+
+#define PBIST_PACT_ON      0x3U
+#define PBIST_ROM_ALGO_RAM 0x3U
+#define PBIST_DLR_ROM_MODE 0x14U
+
+BUILD_ASSERT(STC_INTERVALS <= UINT16_MAX && PBIST_SLICES <= UINT16_MAX);
+
+/* Survives the CPU reset at the end of an STC run, RAM is not initialized again */
+static __noinit uint32_t __aligned(8) stc_context[STC_CTX_SIZE / sizeof(uint32_t)];
+
+static K_THREAD_STACK_DEFINE(selftest_stack, CONFIG_TI_HERCULES_SELFTEST_STACK_SIZE);
+static struct k_work_q selftest_wq;
+static struct k_work_delayable selftest_work;
+
+static struct k_spinlock lock;
+static struct ti_hercules_selftest_status status;
+
+/* PBIST algorithms and RAM groups left in this pass */
+static uint32_t pbist_algos;
+static uint32_t pbist_rams;
+static bool pbist_running;
+
+void ti_hercules_selftest_resume(void)
+{
+	volatile struct hercules_stc_regs *stc = STC_REGS;
+
+	if (stc_context[STC_CTX_MAGIC / sizeof(uint32_t)] != STC_MAGIC_VALUE ||
+	    (stc->STCGSTAT & STCGSTAT_TEST_DONE) == 0U) {
+		return;
+	}
+	stc_context[STC_CTX_MAGIC / sizeof(uint32_t)] = 0U;
+
+	/* Not a reset of the application, keep it out of the reset cause */
+	SYS1_REGS->SYSESR = SYSESR_CPURST;
+	soc_stc_resume(stc_context);
+}
+
+static void selftest_report(const char *test)
+{
+	LOG_ERR("%s self-test failed", test);
+#ifdef CONFIG_TI_HERCULES_ESM
+	(void)ti_hercules_esm_report(DEVICE_DT_GET(ESM_NODE), TI_HERCULES_ESM_GROUP1,
+				     CONFIG_TI_HERCULES_SELFTEST_ESM_CHANNEL);
+#endif
+}
+
+static void selftest_stc_slice(void)
+{
+	volatile struct hercules_stc_regs *stc = STC_REGS;
+	uint32_t count = MIN(STC_INTERVALS - status.stc_intervals,
+			     CONFIG_TI_HERCULES_SELFTEST_STC_SLICE);
+	uint32_t start, offline_us, gstat, fstat;
+	k_spinlock_key_t key;
+	unsigned int irq_key;
+
+	stc->STCGCR0 = STCGCR0_INTCOUNT(count) |
+		       (status.stc_intervals == 0U ? STCGCR0_RS_CNT : 0U);
+	stc->STCTPR = (uint32_t)MIN((uint64_t)count * STC_TIMEOUT, UINT32_MAX);
+
+	irq_key = irq_lock();
+	start = k_cycle_get_32();
+	stc->STCGCR1 = STCGCR1_STC_ENA;
+	soc_stc_suspend(stc_context);
+	offline_us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+	irq_unlock(irq_key);
+
+	gstat = stc->STCGSTAT;
+	fstat = stc->STCFSTAT;
+	stc->STCGCR1 = STCGCR1_STC_DIS;
+	stc->STCGSTAT = STCGSTAT_TEST_DONE | STCGSTAT_TEST_FAIL;
+	stc->STCFSTAT = fstat;
+
+	key = k_spin_lock(&lock);
+	status.stc_slice_max_us = MAX(status.stc_slice_max_us, offline_us);
+	if ((gstat & STCGSTAT_TEST_FAIL) != 0U) {
+		/* Start the CPU self-test over from the first interval */
+		status.stc_failures++;
+		status.stc_intervals = 0U;
+	} else {
+		status.stc_intervals += count;
+	}
+	k_spin_unlock(&lock, key);
+
+	if ((gstat & STCGSTAT_TEST_FAIL) != 0U) {
+		LOG_ERR("STC interval %u %s, STCFSTAT 0x%x", stc->STCCICR,
+			(fstat & STCFSTAT_TO_ERR) != 0U ? "timed out" : "failed", fstat);
+		selftest_report("CPU");
+	}
+}
+
+static void selftest_pbist_start(void)
+{
+	volatile struct hercules_syscon_1_regs *sys1 = SYS1_REGS;
+	volatile struct hercules_pbist_regs *pbist = PBIST_REGS;
+
+	/* PBIST ROM clock is HCLK / 2 */
+	sys1->MSTGCR = (sys1->MSTGCR & ~MSTGCR_ROM_DIV_MASK) | MSTGCR_ROM_DIV_2;
+	sys1->MSINENA = MSINENA_PBIST;
+	sys1->MSTGCR = (sys1->MSTGCR & ~MSTGCR_MSTGENA_MASK) | MSTGCR_MSTGENA_ON;
+	/* At least 32 VCLK cycles for the controller to come out of reset */
+	k_busy_wait(1);
+
+	pbist->PACT = PBIST_PACT_ON;
+	pbist->ALGO = LSB_GET(pbist_algos);
+	pbist->RINFOL = LSB_GET(pbist_rams);
+	pbist->RINFOU = 0U;
+	pbist->OVER = 0U;
+	pbist->ROM = PBIST_ROM_ALGO_RAM;
+	pbist->DLR = PBIST_DLR_ROM_MODE;
+	pbist_running = true;
+}
+
+static void selftest_mem_init(void)
+{
+	volatile struct hercules_syscon_1_regs *sys1 = SYS1_REGS;
+
+	sys1->MINITGCR = MINITGCR_ON;
+	sys1->MSINENA = PBIST_MEM_INIT;
+	if (!WAIT_FOR((sys1->MSTCGSTAT & MSTCGSTAT_MINIDONE) != 0U, MEM_INIT_WAIT_US, NULL)) {
+		LOG_ERR("Memory initialization timed out");
+	}
+	sys1->MINITGCR = MINITGCR_OFF;
+	sys1->MSTCGSTAT = MSTCGSTAT_MINIDONE;
+}
+
+static void selftest_pbist_finish(void)
+{
+	volatile struct hercules_syscon_1_regs *sys1 = SYS1_REGS;
+	volatile struct hercules_pbist_regs *pbist = PBIST_REGS;
+	uint32_t algo = LSB_GET(pbist_algos);
+	uint32_t ram = LSB_GET(pbist_rams);
+	bool failed = (pbist->FSRF0 | pbist->FSRF1) != 0U;
+	k_spinlock_key_t key;
+
+	pbist->PACT = 0U;
+	sys1->MSTGCR = (sys1->MSTGCR & ~MSTGCR_MSTGENA_MASK) | MSTGCR_MSTGENA_OFF;
+	sys1->MSTCGSTAT = MSTCGSTAT_MSTDONE;
+	pbist_running = false;
+
+	/* The algorithms leave test patterns without valid ECC behind */
+	if (PBIST_MEM_INIT != 0U) {
+		selftest_mem_init();
+	}
+
+	pbist_rams &= ~ram;
+	if (pbist_rams == 0U) {
+		pbist_algos &= ~algo;
+		pbist_rams = PBIST_RAMS;
+	}
+
+	key = k_spin_lock(&lock);
+	status.pbist_slices++;
+	if (failed) {
+		status.pbist_failures++;
+	}
+	k_spin_unlock(&lock, key);
+
+	if (failed) {
+		LOG_ERR("PBIST algorithm 0x%x failed on RAM group 0x%x", algo, ram);
+		selftest_report("RAM");
+	}
+}
+
+static void selftest_slice(struct k_work *work)
+{
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(work);
+
+	if (pbist_running) {
+		if ((SYS1_REGS->MSTCGSTAT & MSTCGSTAT_MSTDONE) == 0U) {
+			k_work_reschedule_for_queue(&selftest_wq, &selftest_work, PBIST_POLL);
+			return;
+		}
+		selftest_pbist_finish();
+	} else if (status.stc_intervals < STC_INTERVALS) {
+		selftest_stc_slice();
+	} else if (status.pbist_slices < PBIST_SLICES) {
+		selftest_pbist_start();
+		k_work_reschedule_for_queue(&selftest_wq, &selftest_work, PBIST_POLL);
+		return;
+	}
+
+	if (status.stc_intervals >= STC_INTERVALS && status.pbist_slices >= PBIST_SLICES) {
+		key = k_spin_lock(&lock);
+		status.passes++;
+		status.stc_intervals = 0U;
+		status.pbist_slices = 0U;
+		k_spin_unlock(&lock, key);
+		pbist_algos = PBIST_ALGOS;
+		pbist_rams = PBIST_RAMS;
+		LOG_DBG("Self-test pass %u complete, longest STC slice %u us", status.passes,
+			status.stc_slice_max_us);
+	}
+
+	k_work_reschedule_for_queue(&selftest_wq, &selftest_work, SLICE_INTERVAL);
+}
+
+void ti_hercules_selftest_status_get(struct ti_hercules_selftest_status *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*out = status;
+	k_spin_unlock(&lock, key);
+}
+
+static int selftest_init(void)
+{
+	status.stc_intervals_total = STC_INTERVALS;
+	status.pbist_slices_total = PBIST_SLICES;
+	pbist_algos = PBIST_ALGOS;
+	pbist_rams = PBIST_RAMS;
+
+	if (STC_INTERVALS == 0U && PBIST_SLICES == 0U) {
+		return 0;
+	}
+
+	SYS2_REGS->STCCLKDIV = STCCLKDIV_CLKDIV(CONFIG_TI_HERCULES_SELFTEST_STC_CLKDIV);
+
+	k_work_queue_start(&selftest_wq, selftest_stack, K_THREAD_STACK_SIZEOF(selftest_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+	k_thread_name_set(&selftest_wq.thread, "selftest");
+	k_work_init_delayable(&selftest_work, selftest_slice);
+	k_work_reschedule_for_queue(&selftest_wq, &selftest_work, SLICE_INTERVAL);
+
+	return 0;
+}
+
+SYS_INIT(selftest_init, APPLICATION, 0);
@@ -3,14 +3,38 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <soc_pmu.h>
+
 #include <zephyr/init.h>
 #include <zephyr/drivers/hwinfo.h>
+#include <zephyr/drivers/ti_hercules_boot_trace.h>
+#include <zephyr/drivers/ti_hercules_selftest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(soc_rm57lx, CONFIG_SOC_LOG_LEVEL);
+
+/* MVFR0 fields */
+#define MVFR0_SIMD_REGS(reg)   ((reg) & 0xFU)
+#define MVFR0_DOUBLE_PREC(reg) (((reg) >> 8) & 0xFU)
+#define MVFR0_SIMD_REGS_D16    0x1U
 
 void z_arm_platform_init(void)
 {
 	uint32_t reset_cause = 0;
+	uint32_t start;
 	volatile struct hercules_syscon_1_regs *sys_regs_1 = (void *)DT_REG_ADDR(SYS1_NODE);
-	__ASSERT_NO_MSG(hwinfo_get_reset_cause(&reset_cause) == 0);
+
+	/* The end of an STC run resets the CPU, resume it before RAM is initialized */
+	ti_hercules_selftest_resume();
+
+	if (IS_ENABLED(CONFIG_TI_HERCULES_BOOT_TRACE)) {
+		soc_pmu_cycles_enable();
+		soc_pmu_cycles_reset();
+	}
+	start = ti_hercules_boot_trace_now();
+
+	(void)hwinfo_get_reset_cause(&reset_cause);
 	if ((reset_cause & RESET_POR) ^ (reset_cause & RESET_HARDWARE)) {
 		/* Initialize L2RAM to avoid ECC errors */
 		sys_regs_1->MINITGCR = 0xA; // Enable memory initialization
@@ -19,5 +43,30 @@ void z_arm_platform_init(void)
 			;                   // Await for initialization
 		sys_regs_1->MINITGCR = 0x5; // Disable memory initialization
 	}
+	ti_hercules_boot_trace_start(reset_cause, start, ti_hercules_boot_trace_now());
 	hwinfo_clear_reset_cause();
 }
+
+#ifdef CONFIG_FPU
+/*
+ * The saved FP context is sized for VFP_DP_D16 (D0-D15 and FPSCR). MVFR0 can be
+ * read with FPEXC.EN clear, so this does not mark the init thread as an FPU user
+ * when the context is switched lazily. Any other register file would be
+ * silently corrupted on context switches, so refuse to boot.
+ */
+static int soc_fpu_check(void)
+{
+	uint32_t mvfr0;
+
+	__asm__ volatile("vmrs %0, mvfr0" : "=r"(mvfr0));
+	if (MVFR0_SIMD_REGS(mvfr0) != MVFR0_SIMD_REGS_D16 || MVFR0_DOUBLE_PREC(mvfr0) == 0U) {
+		LOG_ERR("Unexpected VFP configuration (MVFR0 0x%08x)", mvfr0);
+		k_panic();
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+SYS_INIT(soc_fpu_check, PRE_KERNEL_1, 0);
+#endif /* CONFIG_FPU */
@@ -0,0 +1,48 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TI_HERCULES_RM57LX_SOC_PMU_H_
+#define TI_HERCULES_RM57LX_SOC_PMU_H_
+
+#include <zephyr/sys/util.h>
+#include <zephyr/types.h>
+
+/*
+ * Cortex-R5 performance monitor cycle counter. It counts GCLK1 cycles while
+ * the CPU is not halted, which makes it a cheap timestamp for short code
+ * paths. It stops in WFI.
+ */
+
+#define PMCR_E BIT(0) /* enable all counters */
+#define PMCR_C BIT(2) /* reset the cycle counter */
+
+#define PMCNTEN_C BIT(31)
+
+static inline void soc_pmu_cycles_enable(void)
+{
+	uint32_t pmcr;
+
+	__asm__ volatile("mrc p15, 0, %0, c9, c12, 0" : "=r"(pmcr));
+	__asm__ volatile("mcr p15, 0, %0, c9, c12, 0" ::"r"(pmcr | PMCR_E));
+	__asm__ volatile("mcr p15, 0, %0, c9, c12, 1" ::"r"(PMCNTEN_C));
+}
+
+static inline void soc_pmu_cycles_reset(void)
+{
+	uint32_t pmcr;
+
+	__asm__ volatile("mrc p15, 0, %0, c9, c12, 0" : "=r"(pmcr));
+	__asm__ volatile("mcr p15, 0, %0, c9, c12, 0" ::"r"(pmcr | PMCR_C));
+}
+
+static inline uint32_t soc_pmu_cycles(void)
+{
+	uint32_t cycles;
+
+	__asm__ volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(cycles));
+	return cycles;
+}
+
+#endif /* TI_HERCULES_RM57LX_SOC_PMU_H_ */
@@ -0,0 +1,50 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TI_HERCULES_RM57LX_SOC_STC_H_
+#define TI_HERCULES_RM57LX_SOC_STC_H_
+
+/*
+ * CPU context kept across the CPU reset that ends every STC run. The STC
+ * tests the whole core, so everything the kernel set up after reset is lost:
+ * the registers of every mode, the MPU regions, the system control and
+ * ECC settings, the PMU and the VFP registers. Byte offsets into the context.
+ */
+
+#define STC_CTX_CORE    0   /* r4-r11, sp, lr, cpsr of the calling mode */
+#define STC_CTX_BANKED  44  /* FIQ r8-r12, sp, lr, spsr; IRQ, SVC, ABT, UND sp, lr, spsr */
+#define STC_CTX_CP15    124 /* SCTLR, ACTLR, SACTLR, CPACR, TPIDRs, TCM regions, PMU */
+#define STC_CTX_MPU     176 /* RGNR, then DRBAR, DRSR, DRACR of every region */
+#define STC_CTX_VFP     372 /* FPEXC, FPSCR, D0-D15 */
+#define STC_CTX_MAGIC   508
+#define STC_CTX_SIZE    512
+
+#define STC_MPU_REGIONS 16
+#define STC_MAGIC_VALUE 0x5354432EU
+
+#ifndef _ASMLANGUAGE
+
+#include <zephyr/toolchain.h>
+#include <zephyr/types.h>
+
+/**
+ * @brief Save the context and idle the CPU until the enabled STC run resets it.
+ *
+ * Returns through soc_stc_resume() once the run is over. Interrupts must be
+ * locked and the STC enabled, it starts on the WFI executed here.
+ */
+void soc_stc_suspend(uint32_t *ctx);
+
+/**
+ * @brief Restore the context saved by soc_stc_suspend() and return from it.
+ *
+ * Called early in the reset path while the interrupt and exception stacks
+ * are not in use, which is the case as the STC only runs from a thread.
+ */
+FUNC_NORETURN void soc_stc_resume(const uint32_t *ctx);
+
+#endif /* _ASMLANGUAGE */
+
+#endif /* TI_HERCULES_RM57LX_SOC_STC_H_ */
@@ -0,0 +1,165 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/ti_hercules_tracing_ram.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <tracing_backend.h>
+
+#define RING_SIZE CONFIG_TI_HERCULES_TRACING_RAM_SIZE
+#define RING_MASK (RING_SIZE - 1U)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(RING_SIZE), "Tracing ring size must be a power of two");
+
+/*
+ * Single producer, single consumer: the tracing core serialises the calls to
+ * the backend output, and the readers (drain work and application) are
+ * serialised by read_lock. Each side only writes its own index and the data
+ * is published before the head, so the producer never takes a lock and an
+ * event costs a copy of its bytes.
+ */
+struct ti_hercules_tracing_ring ti_hercules_tracing_ring;
+
+static struct k_spinlock read_lock;
+
+static void tracing_ram_put(uint32_t off, const uint8_t *src, uint32_t len)
+{
+	uint32_t first = MIN(len, RING_SIZE - off);
+
+	(void)memcpy(&ti_hercules_tracing_ring.data[off], src, first);
+	(void)memcpy(ti_hercules_tracing_ring.data, src + first, len - first);
+}
+
+static void tracing_ram_get(uint32_t off, uint8_t *dst, uint32_t len)
+{
+	uint32_t first = MIN(len, RING_SIZE - off);
+
+	(void)memcpy(dst, &ti_hercules_tracing_ring.data[off], first);
+	(void)memcpy(dst + first, ti_hercules_tracing_ring.data, len - first);
+}
+
+static void tracing_ram_output(const struct tracing_backend *backend, uint8_t *data,
+			       uint32_t length)
+{
+	struct ti_hercules_tracing_ring *ring = &ti_hercules_tracing_ring;
+	uint32_t head = ring->head;
+
+	ARG_UNUSED(backend);
+
+	/* Drop whole events so that the stream stays decodable */
+	if (length > RING_SIZE - (head - ring->tail)) {
+		ring->dropped++;
+		return;
+	}
+
+	tracing_ram_put(head & RING_MASK, data, length);
+	compiler_barrier();
+	ring->head = head + length;
+}
+
+size_t ti_hercules_tracing_ram_read(uint8_t *buf, size_t len)
+{
+	struct ti_hercules_tracing_ring *ring = &ti_hercules_tracing_ring;
+	k_spinlock_key_t key = k_spin_lock(&read_lock);
+	uint32_t tail = ring->tail;
+	uint32_t count = MIN(len, ring->head - tail);
+
+	compiler_barrier();
+	tracing_ram_get(tail & RING_MASK, buf, count);
+	compiler_barrier();
+	ring->tail = tail + count;
+	k_spin_unlock(&read_lock, key);
+
+	return count;
+}
+
+uint32_t ti_hercules_tracing_ram_dropped(void)
+{
+	return ti_hercules_tracing_ring.dropped;
+}
+
+static void tracing_ram_init(void)
+{
+	ti_hercules_tracing_ring.head = 0U;
+	ti_hercules_tracing_ring.tail = 0U;
+	ti_hercules_tracing_ring.dropped = 0U;
+}
+
+static const struct tracing_backend_api tracing_backend_ti_hercules_ram_api = {
+	.init = tracing_ram_init,
+	.output = tracing_ram_output,
+};
+
+/*
+ * The tracing core looks its backend up by a name derived from the in-tree
+ * CONFIG_TRACING_BACKEND_* symbols and uses the empty name for any other
+ * choice entry, so TRACING_BACKEND_DEFINE() would register a name it never
+ * asks for. Register under the empty name, this backend being the choice
+ * rules out an in-tree one.
+ */
+static const STRUCT_SECTION_ITERABLE(tracing_backend, tracing_backend_ti_hercules_ram) = {
+	.name = "",
+	.api = &tracing_backend_ti_hercules_ram_api,
+};
+
+#if DT_HAS_CHOSEN(zephyr_tracing_uart) && CONFIG_TI_HERCULES_TRACING_RAM_DRAIN_INTERVAL > 0
+
+static const struct device *const drain_uart = DEVICE_DT_GET(DT_CHOSEN(zephyr_tracing_uart));
+
+static void tracing_ram_drain(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(drain_work, tracing_ram_drain);
+
+static void tracing_ram_drain(struct k_work *work)
+{
+	uint8_t chunk[64];
+	size_t drained = 0U;
+	size_t len;
+
+	ARG_UNUSED(work);
+
+	/*
+	 * Bounded to one ring worth of data, the interrupts taken while polling
+	 * out keep adding events.
+	 */
+	while (drained < RING_SIZE) {
+		len = ti_hercules_tracing_ram_read(chunk, sizeof(chunk));
+		if (len == 0U) {
+			break;
+		}
+		for (size_t i = 0U; i < len; i++) {
+			uart_poll_out(drain_uart, chunk[i]);
+		}
+		drained += len;
+	}
+
+	k_work_schedule(&drain_work, K_MSEC(CONFIG_TI_HERCULES_TRACING_RAM_DRAIN_INTERVAL));
+}
+
+static int tracing_ram_drain_start(void)
+{
+	if (!device_is_ready(drain_uart)) {
+		return -ENODEV;
+	}
+
+	k_work_schedule(&drain_work, K_MSEC(CONFIG_TI_HERCULES_TRACING_RAM_DRAIN_INTERVAL));
+	return 0;
+}
+
+/* The system work queue only runs from POST_KERNEL on */
+SYS_INIT(tracing_ram_drain_start, APPLICATION, 0);
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Context switch cost with lazy FPU sharing.
+ *
+ * Two cooperative threads yield to each other SWITCHES times. Integer only
+ * threads give the baseline, a thread that touches the VFP between yields
+ * adds the save and restore of its D0-D15 and FPSCR context.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define SWITCHES   1000U
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIORITY   K_PRIO_COOP(1)
+
+K_THREAD_STACK_DEFINE(ping_stack, STACK_SIZE);
+K_THREAD_STACK_DEFINE(pong_stack, STACK_SIZE);
+static struct k_thread ping_thread;
+static struct k_thread pong_thread;
+
+static K_SEM_DEFINE(done, 0, 1);
+static volatile bool stop;
+static uint32_t elapsed;
+
+static void use_fp(void)
+{
+	static volatile double acc = 1.0;
+
+	acc = acc * 1.000001 + 0.5;
+}
+
+static void ping(void *p1, void *p2, void *p3)
+{
+	bool fp = (bool)(uintptr_t)p1;
+	uint32_t start = k_cycle_get_32();
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < SWITCHES / 2U; i++) {
+		if (fp) {
+			use_fp();
+		}
+		k_yield();
+	}
+	elapsed = k_cycle_get_32() - start;
+	stop = true;
+	k_sem_give(&done);
+}
+
+static void pong(void *p1, void *p2, void *p3)
+{
+	bool fp = (bool)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!stop) {
+		if (fp) {
+			use_fp();
+		}
+		k_yield();
+	}
+}
+
+static void run(const char *name, bool ping_fp, bool pong_fp)
+{
+	uint64_t ns;
+
+	stop = false;
+	k_thread_create(&pong_thread, pong_stack, K_THREAD_STACK_SIZEOF(pong_stack), pong,
+			(void *)(uintptr_t)pong_fp, NULL, NULL, PRIORITY, pong_fp ? K_FP_REGS : 0,
+			K_NO_WAIT);
+	k_thread_create(&ping_thread, ping_stack, K_THREAD_STACK_SIZEOF(ping_stack), ping,
+			(void *)(uintptr_t)ping_fp, NULL, NULL, PRIORITY, ping_fp ? K_FP_REGS : 0,
+			K_NO_WAIT);
+
+	zassert_ok(k_sem_take(&done, K_SECONDS(10)));
+	zassert_ok(k_thread_join(&ping_thread, K_SECONDS(1)));
+	zassert_ok(k_thread_join(&pong_thread, K_SECONDS(1)));
+
+	ns = (uint64_t)elapsed * NSEC_PER_SEC / sys_clock_hw_cycles_per_sec();
+	TC_PRINT("BENCH %-16s %6u ns/switch\n", name, (uint32_t)(ns / SWITCHES));
+}
+
+ZTEST(fpu_context_switch, test_integer)
+{
+	run("integer", false, false);
+}
+
+ZTEST(fpu_context_switch, test_one_fp_thread)
+{
+	run("one fp thread", true, false);
+}
+
+ZTEST(fpu_context_switch, test_two_fp_threads)
+{
+	run("two fp threads", true, true);
+}
+
+ZTEST_SUITE(fpu_context_switch, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,212 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Cost of the VIM and RTI system timer hot paths.
+ *
+ * On native_sim every register access advances the register model by one
+ * cycle, so the model time a call takes is the number of register accesses it
+ * makes, and each path has to stay within its budget of accesses per call. On
+ * the RM57Lx the same paths are timed with the system timer and reported in
+ * nanoseconds.
+ *
+ * Each path is run ITERATIONS times and reported as the average per call.
+ */
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <zephyr/dt-bindings/clock/ti-hercules-clock.h>
+#include <zephyr/dt-bindings/interrupt-controller/ti-hercules-vim.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "hercules_model.h"
+
+#define ITERATIONS 1000U
+
+/* Not connected to a peripheral on the RM57Lx */
+#define BENCH_IRQ 127U
+
+#define MODEL IS_ENABLED(CONFIG_TI_HERCULES_MMIO_MODEL)
+
+#ifdef CONFIG_TI_HERCULES_MMIO_MODEL
+#define bench_now()            ((uint32_t)hercules_mmio_model_now())
+#define bench_cycle_get_32()   rti_sys_clock_cycle_get_32()
+#define bench_cycle_get_64()   rti_sys_clock_cycle_get_64()
+#define bench_clock_elapsed()  rti_sys_clock_elapsed()
+#else
+#define bench_now()            k_cycle_get_32()
+#define bench_cycle_get_32()   sys_clock_cycle_get_32()
+#define bench_cycle_get_64()   sys_clock_cycle_get_64()
+#define bench_clock_elapsed()  sys_clock_elapsed()
+#endif
+
+static uint32_t bench_start;
+
+static void bench_begin(void)
+{
+	bench_start = bench_now();
+}
+
+/* Report the average cost per call and check it against the budget, 0 for none */
+static void bench_end(const char *name, uint32_t budget)
+{
+	uint64_t total = bench_now() - bench_start;
+
+	if (!MODEL) {
+		total = total * NSEC_PER_SEC / sys_clock_hw_cycles_per_sec();
+		TC_PRINT("BENCH %-24s %6u ns/call\n", name, (uint32_t)(total / ITERATIONS));
+		return;
+	}
+
+	TC_PRINT("BENCH %-24s %3u.%02u accesses/call (budget %u)\n", name,
+		 (uint32_t)(total / ITERATIONS), (uint32_t)((total * 100U / ITERATIONS) % 100U),
+		 budget);
+	if (budget != 0U) {
+		zassert_true(total <= (uint64_t)budget * ITERATIONS, "%s over budget", name);
+	}
+}
+
+static void bench_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+#ifdef CONFIG_TI_HERCULES_MMIO_MODEL
+	hercules_mmio_model_reset();
+	z_soc_irq_init();
+	zassert_ok(rti_test_init());
+#endif
+}
+
+ZTEST(ti_hercules_system_bench, test_vim_enable_disable)
+{
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		z_soc_irq_enable(BENCH_IRQ);
+	}
+	bench_end("z_soc_irq_enable", 1U);
+
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		(void)z_soc_irq_is_enabled(BENCH_IRQ);
+	}
+	bench_end("z_soc_irq_is_enabled", 1U);
+
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		z_soc_irq_disable(BENCH_IRQ);
+	}
+	bench_end("z_soc_irq_disable", 1U);
+}
+
+ZTEST(ti_hercules_system_bench, test_vim_priority_set)
+{
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		z_soc_irq_priority_set(BENCH_IRQ, BENCH_IRQ, SYS_IRQ);
+	}
+	bench_end("z_soc_irq_priority_set", 4U);
+}
+
+ZTEST(ti_hercules_system_bench, test_rti_cycles)
+{
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		(void)bench_cycle_get_32();
+	}
+	bench_end("sys_clock_cycle_get_32", 1U);
+
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		(void)bench_cycle_get_64();
+	}
+	bench_end("sys_clock_cycle_get_64", 1U);
+
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		(void)bench_clock_elapsed();
+	}
+	bench_end("sys_clock_elapsed", 1U);
+}
+
+ZTEST(ti_hercules_system_bench, test_clock_get_rate)
+{
+	const struct device *gcm = DEVICE_DT_GET(DT_NODELABEL(gcm));
+	struct ti_herc_periph_clk vclk = {
+		.domain = CLOCK_DOM_VCLK,
+		.source = CLOCK_SRC_VCLK,
+	};
+	uint32_t rate;
+
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		zassert_ok(clock_control_get_rate(gcm, (clock_control_subsys_t)&vclk, &rate));
+	}
+	bench_end("clock_control_get_rate", 3U);
+}
+
+#ifdef CONFIG_TI_HERCULES_MMIO_MODEL
+/*
+ * Model only: on the RM57Lx these would reprogram the VIM and the RTI under the
+ * running kernel, or need a request to be injected.
+ */
+
+ZTEST(ti_hercules_system_bench, test_vim_init)
+{
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		z_soc_irq_init();
+	}
+	bench_end("z_soc_irq_init", 11U);
+}
+
+ZTEST(ti_hercules_system_bench, test_vim_dispatch)
+{
+	z_soc_irq_enable(BENCH_IRQ);
+
+	/* Interrupt entry and exit: active channel lookup and end of interrupt */
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		hercules_mmio_model_vim_raise(BENCH_IRQ);
+		zassert_equal(z_soc_irq_get_active(), BENCH_IRQ);
+		z_soc_irq_eoi(BENCH_IRQ);
+	}
+	bench_end("dispatch", 3U);
+}
+
+ZTEST(ti_hercules_system_bench, test_rti_isr)
+{
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		rti_test_isr();
+	}
+	bench_end("rti_compare0_isr", 2U);
+}
+
+ZTEST(ti_hercules_system_bench, test_rti_set_timeout)
+{
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		rti_sys_clock_set_timeout(1 + (int32_t)(i % 100U), false);
+	}
+	bench_end("sys_clock_set_timeout", 2U);
+}
+
+ZTEST(ti_hercules_system_bench, test_rti_init)
+{
+	/* Boot only, reported without a budget */
+	hercules_mmio_model_reset();
+	bench_begin();
+	for (uint32_t i = 0; i < ITERATIONS; i++) {
+		zassert_ok(rti_test_init());
+	}
+	bench_end("sys_clock_driver_init", 0U);
+}
+#endif /* CONFIG_TI_HERCULES_MMIO_MODEL */
+
+ZTEST_SUITE(ti_hercules_system_bench, NULL, NULL, bench_before, NULL, NULL);
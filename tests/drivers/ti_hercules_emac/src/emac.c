@@ -0,0 +1,218 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <limits.h>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include "emac_test.h"
+
+#define EMAC_NODE   DT_NODELABEL(emac)
+#define EMAC_IRQ_TX DT_IRQ_BY_NAME(EMAC_NODE, tx, irq)
+#define EMAC_IRQ_RX DT_IRQ_BY_NAME(EMAC_NODE, rx, irq)
+
+#define MIN_FRAME 60U
+#define BUF_SIZE  CONFIG_NET_BUF_DATA_SIZE
+/* A frame spanning three receive buffers */
+#define SPAN_LEN  (2U * BUF_SIZE + 88U)
+
+static const struct device *emac;
+static uint8_t frame[1536];
+static uint8_t pattern[1536];
+
+/* Take the pending EMAC request the way the ARM interrupt entry does */
+static bool emac_dispatch(void)
+{
+	unsigned int irq = z_soc_irq_get_active();
+
+	if (irq != EMAC_IRQ_TX && irq != EMAC_IRQ_RX) {
+		return false;
+	}
+	/* The request is a pulse, acknowledge it first so one raised by the ISR stays pending */
+	z_soc_irq_eoi(irq);
+	if (irq == EMAC_IRQ_TX) {
+		emac_test_tx_isr();
+	} else {
+		emac_test_rx();
+	}
+	return true;
+}
+
+static int emac_send(struct net_pkt *pkt)
+{
+	const struct ethernet_api *api = emac->api;
+
+	return api->send(emac, pkt);
+}
+
+/* Build a packet from fragments of the given lengths, filled from pattern[] */
+static struct net_pkt *tx_pkt(const size_t *lens, size_t n, size_t *total)
+{
+	struct net_pkt *pkt = net_pkt_alloc_on_iface(net_if_lookup_by_dev(emac), K_NO_WAIT);
+
+	zassert_not_null(pkt);
+	*total = 0U;
+	for (size_t i = 0; i < n; i++) {
+		struct net_buf *buf = net_pkt_get_frag(pkt, lens[i], K_NO_WAIT);
+
+		zassert_not_null(buf);
+		net_buf_add_mem(buf, &pattern[*total], lens[i]);
+		net_pkt_frag_add(pkt, buf);
+		*total += lens[i];
+	}
+	return pkt;
+}
+
+static void check_rx(size_t len, size_t frags)
+{
+	struct net_pkt *pkt = emac_test_received();
+	size_t n = 0U;
+
+	zassert_not_null(pkt, "no packet passed up");
+	zassert_equal(net_pkt_get_len(pkt), len);
+	for (struct net_buf *buf = pkt->buffer; buf != NULL; buf = buf->frags) {
+		n++;
+	}
+	zassert_equal(n, frags, "one fragment per receive descriptor");
+	zassert_equal(net_buf_linearize(frame, sizeof(frame), pkt->buffer, 0, len), len);
+	zassert_mem_equal(frame, pattern, len);
+	net_pkt_unref(pkt);
+}
+
+static void *emac_setup(void)
+{
+	for (size_t i = 0; i < sizeof(pattern); i++) {
+		pattern[i] = (uint8_t)(i * 7U + 1U);
+	}
+	return NULL;
+}
+
+static void emac_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	hercules_mmio_model_reset();
+	z_soc_irq_init();
+	emac = emac_test_init();
+}
+
+ZTEST(ti_hercules_emac, test_tx_scatter_gather)
+{
+	/* Empty fragments take no descriptor */
+	static const size_t lens[] = {14, 0, 200, 37};
+	size_t len;
+	struct net_pkt *pkt = tx_pkt(lens, ARRAY_SIZE(lens), &len);
+
+	zassert_ok(emac_send(pkt));
+	zassert_equal(hercules_mmio_model_emac_sent(frame, sizeof(frame)), len);
+	zassert_mem_equal(frame, pattern, len);
+	zassert_equal(hercules_mmio_model_emac_sent(frame, sizeof(frame)), 0U);
+
+	zassert_equal(z_soc_irq_get_active(), EMAC_IRQ_TX);
+	zassert_true(emac_dispatch());
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX, "completion acknowledged");
+	net_pkt_unref(pkt);
+}
+
+ZTEST(ti_hercules_emac, test_tx_padding)
+{
+	static const size_t lens[] = {14, 6};
+	size_t len;
+	struct net_pkt *pkt = tx_pkt(lens, ARRAY_SIZE(lens), &len);
+
+	zassert_ok(emac_send(pkt));
+	/* The runt frame is padded with zeroes from an extra descriptor */
+	zassert_equal(hercules_mmio_model_emac_sent(frame, sizeof(frame)), MIN_FRAME);
+	zassert_mem_equal(frame, pattern, len);
+	for (size_t i = len; i < MIN_FRAME; i++) {
+		zassert_equal(frame[i], 0U, "pad byte %u", (unsigned int)i);
+	}
+	zassert_true(emac_dispatch());
+	net_pkt_unref(pkt);
+}
+
+ZTEST(ti_hercules_emac, test_tx_eoq_restart)
+{
+	static const size_t lens_a[] = {14, 100};
+	static const size_t lens_b[] = {14, 50, 50};
+	size_t len_a, len_b;
+	struct net_pkt *a = tx_pkt(lens_a, ARRAY_SIZE(lens_a), &len_a);
+	struct net_pkt *b = tx_pkt(lens_b, ARRAY_SIZE(lens_b), &len_b);
+
+	/* A is sent at once and the queue ends on it, B is linked behind the stopped queue */
+	zassert_ok(emac_send(a));
+	zassert_ok(emac_send(b));
+	zassert_equal(hercules_mmio_model_emac_sent(frame, sizeof(frame)), len_a);
+	zassert_equal(hercules_mmio_model_emac_sent(frame, sizeof(frame)), 0U, "B not sent yet");
+
+	/* Completing A finds EOQ with a successor and restarts the queue on B */
+	zassert_true(emac_dispatch());
+	zassert_equal(hercules_mmio_model_emac_sent(frame, sizeof(frame)), len_b);
+	zassert_mem_equal(frame, pattern, len_b);
+
+	zassert_true(emac_dispatch());
+	zassert_false(emac_dispatch(), "both frames completed");
+	net_pkt_unref(a);
+	net_pkt_unref(b);
+}
+
+ZTEST(ti_hercules_emac, test_tx_ring_wraps)
+{
+	static const size_t lens[] = {14, 30, 40};
+
+	/* Descriptors that were not reclaimed would make send() time out */
+	for (int i = 0; i < 3 * EMAC_TEST_TX_DESCS; i++) {
+		size_t len;
+		struct net_pkt *pkt = tx_pkt(lens, ARRAY_SIZE(lens), &len);
+
+		zassert_ok(emac_send(pkt), "frame %d", i);
+		zassert_equal(hercules_mmio_model_emac_sent(frame, sizeof(frame)), len);
+		zassert_true(emac_dispatch());
+		net_pkt_unref(pkt);
+	}
+}
+
+ZTEST(ti_hercules_emac, test_rx_spanning_buffers)
+{
+	BUILD_ASSERT(EMAC_TEST_RX_DESCS == 4, "the frames below fill the queue");
+
+	zassert_ok(hercules_mmio_model_emac_receive(pattern, MIN_FRAME));
+	zassert_ok(hercules_mmio_model_emac_receive(pattern, SPAN_LEN));
+	/* Every descriptor is in use, the next frame is dropped */
+	zassert_equal(hercules_mmio_model_emac_receive(pattern, MIN_FRAME), -ENOBUFS);
+
+	zassert_equal(z_soc_irq_get_active(), EMAC_IRQ_RX);
+	zassert_true(emac_dispatch());
+	check_rx(MIN_FRAME, 1);
+	check_rx(SPAN_LEN, 3);
+	zassert_is_null(emac_test_received());
+
+	/* The queue ended with EOQ, the driver restarted it on the refilled descriptors */
+	zassert_ok(hercules_mmio_model_emac_receive(pattern, 100));
+	zassert_true(emac_dispatch());
+	check_rx(100, 1);
+}
+
+ZTEST(ti_hercules_emac, test_rx_refill)
+{
+	/* Every frame takes a descriptor, each is handed back with a fresh buffer */
+	for (size_t i = 0; i < 3 * EMAC_TEST_RX_DESCS; i++) {
+		size_t len = MIN_FRAME + i * 40U;
+
+		zassert_ok(hercules_mmio_model_emac_receive(pattern, len), "frame %u",
+			   (unsigned int)i);
+		zassert_true(emac_dispatch());
+		check_rx(len, DIV_ROUND_UP(len, BUF_SIZE));
+	}
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX);
+}
+
+ZTEST_SUITE(ti_hercules_emac, NULL, emac_setup, emac_before, NULL, NULL);
@@ -0,0 +1,118 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * native_sim interrupt numbers are not VIM channels, so the EMAC driver is
+ * built here with its interrupts routed through the VIM driver. Its receive
+ * thread is not started, the tests run the receive pass themselves, and the
+ * packets it passes up are kept for the tests instead of entering the stack.
+ */
+
+#include <zephyr/cache.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/phy.h>
+#include <zephyr/spinlock.h>
+
+#include "emac_test.h"
+
+#define CONFIG_ETH_TI_HERCULES_TX_DESCS             EMAC_TEST_TX_DESCS
+#define CONFIG_ETH_TI_HERCULES_RX_DESCS             EMAC_TEST_RX_DESCS
+#define CONFIG_ETH_TI_HERCULES_RX_IRQ_PER_MS        0
+#define CONFIG_ETH_TI_HERCULES_TX_IRQ_PER_MS        0
+#define CONFIG_ETH_TI_HERCULES_RX_THREAD_STACK_SIZE 1024
+#define CONFIG_ETH_TI_HERCULES_RX_THREAD_PRIO       2
+
+#undef IRQ_CONNECT
+#define IRQ_CONNECT(irq, prio, isr, arg, flags) z_soc_irq_priority_set(irq, prio, flags)
+
+#undef irq_enable
+#define irq_enable(irq) z_soc_irq_enable(irq)
+
+#define k_thread_create(thread, ...)      ((void)(thread))
+#define k_thread_name_set(thread, name)   ((void)(name))
+#define net_recv_data                     emac_test_recv_data
+#define ethernet_init                     emac_test_ethernet_init
+
+static int emac_test_recv_data(struct net_if *iface, struct net_pkt *pkt);
+static void emac_test_ethernet_init(struct net_if *iface);
+
+#include "eth_ti_hercules_emac.c"
+
+#undef ethernet_init
+
+#define EMAC_DEV DEVICE_DT_GET(DT_NODELABEL(emac))
+
+static struct net_pkt *received[2 * EMAC_TEST_RX_DESCS];
+static size_t received_head;
+static size_t received_tail;
+
+static int emac_test_recv_data(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+
+	if (received_head - received_tail == ARRAY_SIZE(received)) {
+		return -ENOBUFS;
+	}
+	received[received_head++ % ARRAY_SIZE(received)] = pkt;
+	return 0;
+}
+
+/* The stack sets the L2 up once, the tests rerun the interface init after each model reset */
+static void emac_test_ethernet_init(struct net_if *iface)
+{
+	static bool done;
+
+	if (!done) {
+		ethernet_init(iface);
+		done = true;
+	}
+}
+
+const struct device *emac_test_init(void)
+{
+	const struct device *dev = EMAC_DEV;
+	struct net_pkt *pkt;
+	int ret;
+
+	while ((pkt = emac_test_received()) != NULL) {
+		net_pkt_unref(pkt);
+	}
+	ret = eth_ti_hercules_emac_init(dev);
+	__ASSERT(ret == 0, "EMAC init failed (%d)", ret);
+	eth_ti_hercules_emac_iface_init(DEV_DATA(dev)->iface);
+
+	return dev;
+}
+
+void emac_test_tx_isr(void)
+{
+	eth_ti_hercules_emac_tx_isr(EMAC_DEV);
+}
+
+void emac_test_rx(void)
+{
+	const struct device *dev = EMAC_DEV;
+
+	eth_ti_hercules_emac_rx_isr(dev);
+	(void)k_sem_take(&DEV_DATA(dev)->rx_sem, K_NO_WAIT);
+
+	/* One iteration of eth_ti_hercules_emac_rx_thread() */
+	eth_ti_hercules_emac_rx(dev);
+	HERCULES_REG_WRITE(DEV_REGS(dev), MACEOIVECTOR, EMAC_EOI_RX);
+	HERCULES_REG_WRITE(DEV_CTRL(dev), C0RXEN, BIT(0));
+}
+
+struct net_pkt *emac_test_received(void)
+{
+	if (received_tail == received_head) {
+		return NULL;
+	}
+	return received[received_tail++ % ARRAY_SIZE(received)];
+}
@@ -0,0 +1,36 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TESTS_DRIVERS_TI_HERCULES_EMAC_EMAC_TEST_H_
+#define TESTS_DRIVERS_TI_HERCULES_EMAC_EMAC_TEST_H_
+
+#include <zephyr/device.h>
+#include <zephyr/net/net_pkt.h>
+
+#define EMAC_TEST_TX_DESCS 8
+#define EMAC_TEST_RX_DESCS 4
+
+/* VIM driver, the SoC interrupt controller hooks of the ARM architecture */
+void z_soc_irq_init(void);
+void z_soc_irq_enable(unsigned int irq);
+void z_soc_irq_priority_set(unsigned int irq, unsigned int prio, unsigned int flags);
+unsigned int z_soc_irq_get_active(void);
+void z_soc_irq_eoi(unsigned int irq);
+
+/*
+ * EMAC driver, built by emac_shim.c with its interrupts routed through the VIM
+ * driver and without its receive thread.
+ */
+
+/** Run the driver and interface init against the current model state */
+const struct device *emac_test_init(void);
+/** Run the transmit completion ISR */
+void emac_test_tx_isr(void);
+/** Run the receive ISR and one pass of the receive thread */
+void emac_test_rx(void);
+/** Take the oldest packet passed up by the driver, NULL if none */
+struct net_pkt *emac_test_received(void);
+
+#endif /* TESTS_DRIVERS_TI_HERCULES_EMAC_EMAC_TEST_H_ */
@@ -0,0 +1,144 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/dt-bindings/clock/ti-hercules-clock.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include "hercules_model.h"
+
+#define GCM_NODE  DT_NODELABEL(gcm)
+#define SYS1_NODE DT_NODELABEL(sys1)
+#define SYS2_NODE DT_NODELABEL(sys2)
+#define PLL1_NODE DT_NODELABEL(pll1)
+#define PLL2_NODE DT_NODELABEL(pll2)
+
+#define SYS1_CSDIS   0x30U
+#define SYS1_CSVSTAT 0x54U
+#define SYS1_PLLCTL1 0x70U
+#define SYS1_PLLCTL2 0x74U
+#define SYS2_PLLCTL3 0x00U
+
+#define PLLCTL_R   GENMASK(28, 24)
+#define PLLCTL_NR  GENMASK(21, 16)
+#define PLLCTL_NF  GENMASK(15, 8)
+#define PLLCTL2_OD GENMASK(11, 9)
+#define PLLCTL3_OD GENMASK(31, 29)
+
+/* Reference cycles a PLL takes to lock, 127 + 1024 * NR */
+#define PLL_LOCK_CYCLES(node) (127U + 1024U * DT_PROP(node, nr))
+
+/* The errata workaround locks both PLLs at OSCIN/1 five times */
+#define ERRATA_LOCK_CYCLES (5U * (127U + 1024U))
+
+/* Model cycles taken by the register accesses after the PLLs are enabled */
+#define INIT_TAIL_CYCLES 16U
+
+static uint32_t reg(uintptr_t base, uint32_t off)
+{
+	uint8_t *regs = HERCULES_MMIO(base);
+
+	return hercules_mmio_model_read((volatile uint32_t *)(regs + off));
+}
+
+static uint32_t csvstat(void)
+{
+	return reg(DT_REG_ADDR(SYS1_NODE), SYS1_CSVSTAT);
+}
+
+static void gcm_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	hercules_mmio_model_reset();
+}
+
+ZTEST(ti_hercules_gcm, test_pll_programming)
+{
+	uint32_t pllctl1, pllctl2, pllctl3;
+
+	zassert_ok(gcm_test_init());
+
+	pllctl1 = reg(DT_REG_ADDR(SYS1_NODE), SYS1_PLLCTL1);
+	pllctl2 = reg(DT_REG_ADDR(SYS1_NODE), SYS1_PLLCTL2);
+	pllctl3 = reg(DT_REG_ADDR(SYS2_NODE), SYS2_PLLCTL3);
+
+	zassert_equal(FIELD_GET(PLLCTL_R, pllctl1), DT_PROP(PLL1_NODE, r) - 1);
+	zassert_equal(FIELD_GET(PLLCTL_NR, pllctl1), DT_PROP(PLL1_NODE, nr) - 1);
+	zassert_equal(FIELD_GET(PLLCTL_NF, pllctl1), DT_PROP(PLL1_NODE, nf) - 1);
+	zassert_equal(FIELD_GET(PLLCTL2_OD, pllctl2), DT_PROP(PLL1_NODE, od) - 1);
+
+	zassert_equal(FIELD_GET(PLLCTL_R, pllctl3), DT_PROP(PLL2_NODE, r) - 1);
+	zassert_equal(FIELD_GET(PLLCTL_NR, pllctl3), DT_PROP(PLL2_NODE, nr) - 1);
+	zassert_equal(FIELD_GET(PLLCTL_NF, pllctl3), DT_PROP(PLL2_NODE, nf) - 1);
+	zassert_equal(FIELD_GET(PLLCTL3_OD, pllctl3), DT_PROP(PLL2_NODE, od) - 1);
+
+	/* Only the sources missing from the devicetree stay disabled */
+	zassert_equal(reg(DT_REG_ADDR(SYS1_NODE), SYS1_CSDIS),
+		      BIT(CLOCK_SRC_RESERVED) | BIT(CLOCK_SRC_EXTCLKIN) |
+			      BIT(CLOCK_SRC_EXTCLKIN2));
+}
+
+ZTEST(ti_hercules_gcm, test_errata_waits_for_lock)
+{
+	uint64_t start = hercules_mmio_model_now();
+
+	zassert_ok(gcm_test_init());
+
+	/* Each errata attempt waits for both PLLs to lock before disabling them */
+	zassert_true(hercules_mmio_model_now() - start >= ERRATA_LOCK_CYCLES);
+}
+
+ZTEST(ti_hercules_gcm, test_pll_lock_time)
+{
+	const uint32_t plls = BIT(CLOCK_SRC_PLL1) | BIT(CLOCK_SRC_PLL2);
+
+	BUILD_ASSERT(PLL_LOCK_CYCLES(PLL1_NODE) == PLL_LOCK_CYCLES(PLL2_NODE),
+		     "the test expects both PLLs to lock at the same time");
+
+	zassert_ok(gcm_test_init());
+	zassert_equal(csvstat() & plls, 0U, "PLLs valid right after being enabled");
+	zassert_true((csvstat() & BIT(CLOCK_SRC_OSCILLATOR)) != 0U);
+
+	hercules_mmio_model_advance(PLL_LOCK_CYCLES(PLL1_NODE) - INIT_TAIL_CYCLES);
+	zassert_equal(csvstat() & plls, 0U, "PLLs locked early");
+
+	hercules_mmio_model_advance(INIT_TAIL_CYCLES);
+	zassert_equal(csvstat() & plls, plls);
+}
+
+ZTEST(ti_hercules_gcm, test_source_status)
+{
+	const struct device *gcm = DEVICE_DT_GET(GCM_NODE);
+	struct ti_herc_periph_clk pll1 = {
+		.domain = CLOCK_DOM_NONE,
+		.source = CLOCK_SRC_PLL1,
+	};
+
+	zassert_ok(gcm_test_init());
+	zassert_equal(clock_control_get_status(gcm, (clock_control_subsys_t)&pll1),
+		      CLOCK_CONTROL_STATUS_UNKNOWN, "PLL1 reported on before lock");
+
+	hercules_mmio_model_advance(PLL_LOCK_CYCLES(PLL1_NODE));
+	zassert_equal(clock_control_get_status(gcm, (clock_control_subsys_t)&pll1),
+		      CLOCK_CONTROL_STATUS_ON);
+
+	zassert_ok(clock_control_off(gcm, (clock_control_subsys_t)&pll1));
+	zassert_equal(clock_control_get_status(gcm, (clock_control_subsys_t)&pll1),
+		      CLOCK_CONTROL_STATUS_OFF);
+	zassert_true((csvstat() & BIT(CLOCK_SRC_PLL1)) == 0U);
+
+	/* Enabling it again starts a new lock */
+	zassert_ok(clock_control_on(gcm, (clock_control_subsys_t)&pll1));
+	zassert_true((csvstat() & BIT(CLOCK_SRC_PLL1)) == 0U);
+	hercules_mmio_model_advance(PLL_LOCK_CYCLES(PLL1_NODE));
+	zassert_true((csvstat() & BIT(CLOCK_SRC_PLL1)) != 0U);
+}
+
+ZTEST_SUITE(ti_hercules_gcm, NULL, NULL, gcm_before, NULL, NULL);
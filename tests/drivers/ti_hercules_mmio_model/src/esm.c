@@ -0,0 +1,175 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <limits.h>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/misc/ti_hercules_esm/ti_hercules_esm.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include "hercules_model.h"
+
+#define ESM_NODE     DT_NODELABEL(esm)
+#define ESM_IRQ_HIGH DT_IRQ_BY_NAME(ESM_NODE, high, irq)
+#define ESM_IRQ_LOW  DT_IRQ_BY_NAME(ESM_NODE, low, irq)
+
+#define ESM_IESR1  0x08U
+#define ESM_ILSR1  0x10U
+#define ESM_SR1(g) (0x18U + ((g) - 1U) * 4U)
+#define ESM_LTCPR  0x34U
+#define ESM_IESR4  0x48U
+#define ESM_IESR7  0x88U
+
+#define ESM_LTC_PRELOAD DT_PROP(ESM_NODE, ltc_preload)
+
+struct esm_event {
+	uint8_t group;
+	uint8_t channel;
+};
+
+static const struct device *esm;
+static struct esm_event events[8];
+static size_t nevents;
+
+static uint32_t esm_reg(uint32_t off)
+{
+	uint8_t *regs = HERCULES_MMIO(DT_REG_ADDR(ESM_NODE));
+
+	return hercules_mmio_model_read((volatile uint32_t *)(regs + off));
+}
+
+static void record(const struct device *dev, uint8_t group, uint8_t channel, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	zassert_equal_ptr(dev, esm);
+	zassert_true(nevents < ARRAY_SIZE(events));
+	events[nevents].group = group;
+	events[nevents].channel = channel;
+	nevents++;
+}
+
+static void esm_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	hercules_mmio_model_reset();
+	z_soc_irq_init();
+	esm = esm_test_init();
+	nevents = 0;
+}
+
+ZTEST(ti_hercules_esm, test_init_state)
+{
+	/* high-channels = <10 92>, low-channels = <17 30 35> */
+	zassert_equal(esm_reg(ESM_IESR1), BIT(10) | BIT(17) | BIT(30));
+	zassert_equal(esm_reg(ESM_IESR4), BIT(3));
+	zassert_equal(esm_reg(ESM_IESR7), BIT(28));
+	zassert_equal(esm_reg(ESM_ILSR1), BIT(10));
+	zassert_equal(esm_reg(ESM_LTCPR), ESM_LTC_PRELOAD);
+	zassert_true(z_soc_irq_is_enabled(ESM_IRQ_HIGH));
+	zassert_true(z_soc_irq_is_enabled(ESM_IRQ_LOW));
+	zassert_false(ti_hercules_esm_error_pin_active(esm));
+}
+
+ZTEST(ti_hercules_esm, test_high_level_dispatch)
+{
+	zassert_ok(ti_hercules_esm_callback_set(esm, TI_HERCULES_ESM_GROUP1, 10, record, NULL));
+	zassert_ok(ti_hercules_esm_callback_set(esm, TI_HERCULES_ESM_GROUP1, 92, record, NULL));
+
+	hercules_mmio_model_esm_raise(1, 92);
+	hercules_mmio_model_esm_raise(1, 10);
+
+	/* The FIQ is taken first and drains every pending high level source */
+	zassert_equal(z_soc_irq_get_active(), ESM_IRQ_HIGH);
+	zassert_true(esm_test_dispatch());
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX, "no request left");
+
+	zassert_equal(nevents, 2U);
+	zassert_equal(events[0].group, TI_HERCULES_ESM_GROUP1);
+	zassert_equal(events[0].channel, 10U);
+	zassert_equal(events[1].channel, 92U);
+	zassert_equal(ti_hercules_esm_error_count(esm, TI_HERCULES_ESM_GROUP1, 10), 1U);
+	zassert_equal(ti_hercules_esm_error_count(esm, TI_HERCULES_ESM_GROUP1, 92), 1U);
+	zassert_equal(esm_reg(ESM_SR1(1)), 0U, "status cleared by the dispatch");
+}
+
+ZTEST(ti_hercules_esm, test_low_level_dispatch)
+{
+	zassert_ok(ti_hercules_esm_callback_set(esm, TI_HERCULES_ESM_GROUP1, 35, record, NULL));
+	zassert_ok(ti_hercules_esm_callback_set(esm, TI_HERCULES_ESM_GROUP1, 17, record, NULL));
+
+	hercules_mmio_model_esm_raise(1, 35);
+	hercules_mmio_model_esm_raise(1, 17);
+	hercules_mmio_model_esm_raise(1, 30);
+
+	zassert_equal(z_soc_irq_get_active(), ESM_IRQ_LOW);
+	zassert_true(esm_test_dispatch());
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX);
+
+	/* Lowest offset first, channel 30 is counted without a callback */
+	zassert_equal(nevents, 2U);
+	zassert_equal(events[0].channel, 17U);
+	zassert_equal(events[1].channel, 35U);
+	zassert_equal(ti_hercules_esm_error_count(esm, TI_HERCULES_ESM_GROUP1, 30), 1U);
+	zassert_false(ti_hercules_esm_error_pin_active(esm), "not an error pin channel");
+}
+
+ZTEST(ti_hercules_esm, test_group2_is_high_level)
+{
+	zassert_ok(ti_hercules_esm_callback_set(esm, TI_HERCULES_ESM_GROUP2, 24, record, NULL));
+
+	hercules_mmio_model_esm_raise(2, 24);
+
+	zassert_equal(z_soc_irq_get_active(), ESM_IRQ_HIGH);
+	zassert_true(esm_test_dispatch());
+	zassert_equal(nevents, 1U);
+	zassert_equal(events[0].group, TI_HERCULES_ESM_GROUP2);
+	zassert_equal(events[0].channel, 24U);
+	zassert_equal(esm_reg(ESM_SR1(2)), 0U);
+	zassert_true(ti_hercules_esm_error_pin_active(esm), "group 2 drives the pin");
+}
+
+ZTEST(ti_hercules_esm, test_disabled_channel_not_dispatched)
+{
+	hercules_mmio_model_esm_raise(1, 5);
+
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX);
+	zassert_equal(ti_hercules_esm_error_count(esm, TI_HERCULES_ESM_GROUP1, 5), 0U);
+	zassert_equal(esm_reg(ESM_SR1(1)), BIT(5), "status stays latched");
+}
+
+ZTEST(ti_hercules_esm, test_report)
+{
+	zassert_ok(ti_hercules_esm_callback_set(esm, TI_HERCULES_ESM_GROUP1, 40, record, NULL));
+
+	zassert_ok(ti_hercules_esm_report(esm, TI_HERCULES_ESM_GROUP1, 40));
+	zassert_ok(ti_hercules_esm_report(esm, TI_HERCULES_ESM_GROUP1, 40));
+	zassert_equal(nevents, 2U);
+	zassert_equal(ti_hercules_esm_error_count(esm, TI_HERCULES_ESM_GROUP1, 40), 2U);
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX, "software reports raise no interrupt");
+
+	zassert_equal(ti_hercules_esm_report(esm, TI_HERCULES_ESM_GROUP2, 64), -EINVAL);
+	zassert_equal(ti_hercules_esm_callback_set(esm, 3, 0, record, NULL), -EINVAL);
+}
+
+ZTEST(ti_hercules_esm, test_error_pin_low_time)
+{
+	hercules_mmio_model_esm_raise(1, 10);
+	zassert_true(esm_test_dispatch());
+	zassert_true(ti_hercules_esm_error_pin_active(esm));
+
+	/* Held low for the low time counter preload */
+	zassert_equal(ti_hercules_esm_error_pin_reset(esm), -EBUSY);
+	zassert_true(ti_hercules_esm_error_pin_active(esm));
+
+	hercules_mmio_model_advance(ESM_LTC_PRELOAD + 1U);
+	zassert_ok(ti_hercules_esm_error_pin_reset(esm));
+	zassert_false(ti_hercules_esm_error_pin_active(esm));
+}
+
+ZTEST_SUITE(ti_hercules_esm, NULL, NULL, esm_before, NULL, NULL);
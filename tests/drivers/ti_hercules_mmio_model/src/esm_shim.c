@@ -0,0 +1,66 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * native_sim interrupt numbers are not VIM channels, so the ESM driver is
+ * built here with its interrupts routed through the VIM driver. The tests take
+ * the VIM requests themselves and run the recorded handler, the way the FIQ
+ * (NMI) and IRQ entries do on the target.
+ */
+
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+
+#include <string.h>
+
+#include "hercules_model.h"
+
+static void (*esm_test_isr[2])(const struct device *dev);
+static unsigned int esm_test_irq[2];
+static size_t esm_test_isrs;
+
+static void esm_test_connect(unsigned int irq, unsigned int prio, unsigned int flags,
+			     void (*isr)(const struct device *dev))
+{
+	z_soc_irq_priority_set(irq, prio, flags);
+	__ASSERT_NO_MSG(esm_test_isrs < ARRAY_SIZE(esm_test_isr));
+	esm_test_irq[esm_test_isrs] = irq;
+	esm_test_isr[esm_test_isrs] = isr;
+	esm_test_isrs++;
+}
+
+#undef IRQ_CONNECT
+#define IRQ_CONNECT(irq, prio, isr, arg, flags) esm_test_connect(irq, prio, flags, isr)
+
+#undef irq_enable
+#define irq_enable(irq) z_soc_irq_enable(irq)
+
+#include "ti_hercules_esm.c"
+
+#define ESM_NODE DT_NODELABEL(esm)
+
+const struct device *esm_test_init(void)
+{
+	const struct device *dev = DEVICE_DT_GET(ESM_NODE);
+
+	memset(&ti_hercules_esm_data_0, 0, sizeof(ti_hercules_esm_data_0));
+	esm_test_isrs = 0;
+	(void)ti_hercules_esm_init(dev);
+	return dev;
+}
+
+bool esm_test_dispatch(void)
+{
+	unsigned int irq = z_soc_irq_get_active();
+
+	for (size_t i = 0; i < esm_test_isrs; i++) {
+		if (esm_test_irq[i] == irq) {
+			esm_test_isr[i](DEVICE_DT_GET(ESM_NODE));
+			z_soc_irq_eoi(irq);
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,62 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TESTS_DRIVERS_TI_HERCULES_MMIO_MODEL_HERCULES_MODEL_H_
+#define TESTS_DRIVERS_TI_HERCULES_MMIO_MODEL_HERCULES_MODEL_H_
+
+#include <stdbool.h>
+#include <zephyr/device.h>
+#include <zephyr/types.h>
+
+/* VIM driver, the SoC interrupt controller hooks of the ARM architecture */
+void z_soc_irq_init(void);
+void z_soc_irq_enable(unsigned int irq);
+void z_soc_irq_disable(unsigned int irq);
+int z_soc_irq_is_enabled(unsigned int irq);
+void z_soc_irq_priority_set(unsigned int irq, unsigned int prio, unsigned int flags);
+unsigned int z_soc_irq_get_active(void);
+void z_soc_irq_eoi(unsigned int irq);
+
+/*
+ * RTI system timer, built by rti_timer_shim.c with its kernel hooks renamed so
+ * it runs next to the native_sim system timer.
+ */
+
+/** Ticks announced by the RTI timer since rti_test_init() */
+extern int32_t rti_test_announced;
+
+/** Run the driver init function against the current model state */
+int rti_test_init(void);
+/** Run the compare 0 ISR */
+void rti_test_isr(void);
+uint32_t rti_test_cyc_per_tick(void);
+uint32_t rti_test_max_ticks(void);
+int rti_test_hw_cycles_per_sec(void);
+
+uint32_t rti_sys_clock_elapsed(void);
+void rti_sys_clock_disable(void);
+uint32_t rti_sys_clock_cycle_get_32(void);
+uint64_t rti_sys_clock_cycle_get_64(void);
+void rti_sys_clock_set_timeout(int32_t ticks, bool idle);
+
+/*
+ * ESM driver, built by esm_shim.c with its interrupts routed through the VIM
+ * driver.
+ */
+
+/** Run the driver init function against the current model state */
+const struct device *esm_test_init(void);
+/** Take the active VIM request and run its ESM handler, false if it is not an ESM one */
+bool esm_test_dispatch(void);
+
+/*
+ * GCM driver, built by gcm_shim.c without its device so the PLL start up can
+ * run again after a model reset.
+ */
+
+/** Run the driver init function against the current model state */
+int gcm_test_init(void);
+
+#endif /* TESTS_DRIVERS_TI_HERCULES_MMIO_MODEL_HERCULES_MODEL_H_ */
@@ -0,0 +1,93 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/hwinfo.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include "hercules_model.h"
+
+#define SYS1_NODE DT_NODELABEL(sys1)
+#define RTI_NODE  DT_NODELABEL(rti)
+
+#define SYS1_SYSESR 0xE4U
+#define SYS1_DEVID  0xF0U
+
+#define RTI_DWDCTRL    0x90U
+#define RTI_DWDPRLD    0x94U
+#define RTI_WWDRXNCTRL 0xA4U
+
+#define DWD_ENABLE    0xA98559DAU
+#define DWD_RXN_RESET 0x5U
+
+/* Expiry time of the watchdog with the smallest preload */
+#define DWD_MIN_RELOAD_CYCLES BIT(13)
+
+static volatile uint32_t *reg(uintptr_t base, uint32_t off)
+{
+	uint8_t *regs = HERCULES_MMIO(base);
+
+	return (volatile uint32_t *)(regs + off);
+}
+
+static uint32_t reset_cause(void)
+{
+	uint32_t cause;
+
+	zassert_ok(hwinfo_get_reset_cause(&cause));
+	return cause;
+}
+
+static void hwinfo_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	hercules_mmio_model_reset();
+}
+
+ZTEST(ti_hercules_hwinfo, test_device_id)
+{
+	uint8_t id[8];
+
+	zassert_equal(hwinfo_get_device_id(id, sizeof(id)), sizeof(uint32_t));
+	zassert_equal(sys_get_le32(id),
+		      hercules_mmio_model_read(reg(DT_REG_ADDR(SYS1_NODE), SYS1_DEVID)));
+}
+
+ZTEST(ti_hercules_hwinfo, test_power_on_reset)
+{
+	uint32_t supported;
+
+	BUILD_ASSERT(CONFIG_TI_HERCULES_MMIO_MODEL_RESET_CAUSE == 0x8000,
+		     "the test expects the model to come out of a power-on reset");
+
+	zassert_ok(hwinfo_get_supported_reset_cause(&supported));
+	zassert_equal(reset_cause(), RESET_POR);
+	zassert_equal(reset_cause() & ~supported, 0U);
+}
+
+ZTEST(ti_hercules_hwinfo, test_clear_reset_cause)
+{
+	zassert_ok(hwinfo_clear_reset_cause());
+	zassert_equal(hercules_mmio_model_read(reg(DT_REG_ADDR(SYS1_NODE), SYS1_SYSESR)), 0U);
+	zassert_equal(reset_cause(), 0U);
+}
+
+ZTEST(ti_hercules_hwinfo, test_watchdog_reset)
+{
+	zassert_ok(hwinfo_clear_reset_cause());
+
+	/* Let the windowed watchdog expire with a reset reaction */
+	hercules_mmio_model_write(reg(DT_REG_ADDR(RTI_NODE), RTI_DWDPRLD), 0U);
+	hercules_mmio_model_write(reg(DT_REG_ADDR(RTI_NODE), RTI_WWDRXNCTRL), DWD_RXN_RESET);
+	hercules_mmio_model_write(reg(DT_REG_ADDR(RTI_NODE), RTI_DWDCTRL), DWD_ENABLE);
+	hercules_mmio_model_advance(DWD_MIN_RELOAD_CYCLES);
+
+	zassert_equal(reset_cause(), RESET_WATCHDOG);
+}
+
+ZTEST_SUITE(ti_hercules_hwinfo, NULL, NULL, hwinfo_before, NULL, NULL);
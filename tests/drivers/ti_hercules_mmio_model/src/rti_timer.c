@@ -0,0 +1,172 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/clock_control.h>
+#include <zephyr/drivers/clock_control/ti_hercules_clock_control.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/sys_clock.h>
+#include <zephyr/ztest.h>
+
+#include "hercules_model.h"
+
+#define RTI_NODE DT_NODELABEL(rti)
+#define RTI_IRQ  DT_IRQ_BY_NAME(RTI_NODE, rti_compare0, irq)
+
+#define TICKLESS IS_ENABLED(CONFIG_TICKLESS_KERNEL)
+
+/* Model (VCLK) cycles per counter increment */
+static uint32_t vclk_per_count;
+
+/* Advance the model by a number of counter increments */
+static void advance_counts(uint64_t counts)
+{
+	uint64_t cycles = counts * vclk_per_count;
+
+	while (cycles > 0U) {
+		uint32_t step = (uint32_t)MIN(cycles, (uint64_t)BIT(30));
+
+		hercules_mmio_model_advance(step);
+		cycles -= step;
+	}
+}
+
+static void advance_ticks(uint32_t ticks)
+{
+	advance_counts((uint64_t)ticks * rti_test_cyc_per_tick());
+}
+
+/* Take the pending RTI request the way the ARM interrupt entry does */
+static bool rti_dispatch(void)
+{
+	unsigned int irq = z_soc_irq_get_active();
+
+	if (irq != RTI_IRQ) {
+		return false;
+	}
+	rti_test_isr();
+	z_soc_irq_eoi(irq);
+	return true;
+}
+
+static void rti_before(void *fixture)
+{
+	struct ti_herc_periph_clk clk = TI_HERC_PERIPH_CLK_DT_GET(RTI_NODE);
+	uint32_t vclk;
+
+	ARG_UNUSED(fixture);
+
+	hercules_mmio_model_reset();
+	z_soc_irq_init();
+	zassert_ok(rti_test_init());
+	zassert_true(z_soc_irq_is_enabled(RTI_IRQ), "init enables the compare 0 interrupt");
+
+	zassert_ok(clock_control_get_rate(DEVICE_DT_GET(DT_CLOCKS_CTLR(RTI_NODE)),
+					  (clock_control_subsys_t)&clk, &vclk));
+	vclk_per_count = vclk / (uint32_t)rti_test_hw_cycles_per_sec();
+}
+
+ZTEST(ti_hercules_rti_timer, test_rate)
+{
+	struct ti_herc_periph_clk clk = TI_HERC_PERIPH_CLK_DT_GET(RTI_NODE);
+	uint32_t rticlk;
+
+	zassert_ok(clock_control_get_rate(DEVICE_DT_GET(DT_CLOCKS_CTLR(RTI_NODE)),
+					  (clock_control_subsys_t)&clk, &rticlk));
+	rticlk >>= clk.clock_mode;
+
+	/* Counter 0 is prescaled to half of RTICLK */
+	zassert_equal(rti_test_hw_cycles_per_sec(), (int)(rticlk / 2U));
+	zassert_equal(rti_test_cyc_per_tick(),
+		      (uint32_t)rti_test_hw_cycles_per_sec() / CONFIG_SYS_CLOCK_TICKS_PER_SEC);
+	zassert_true((uint64_t)rti_test_max_ticks() * rti_test_cyc_per_tick() <= INT32_MAX,
+		     "a timeout must stay within half a counter wrap");
+}
+
+ZTEST(ti_hercules_rti_timer, test_counter_follows_model_time)
+{
+	uint32_t before = rti_sys_clock_cycle_get_32();
+	uint32_t delta;
+
+	hercules_mmio_model_advance(1000U * vclk_per_count);
+	delta = rti_sys_clock_cycle_get_32() - before;
+
+	/* The reads take a model cycle each */
+	zassert_between_inclusive(delta, 1000U, 1001U);
+}
+
+ZTEST(ti_hercules_rti_timer, test_ticked_announce)
+{
+	if (TICKLESS) {
+		ztest_test_skip();
+	}
+
+	advance_counts(rti_test_cyc_per_tick() + rti_test_cyc_per_tick() / 2U);
+	zassert_true(rti_dispatch());
+	zassert_equal(rti_test_announced, 1);
+
+	advance_ticks(1U);
+	zassert_true(rti_dispatch());
+	zassert_equal(rti_test_announced, 2);
+
+	/* A late interrupt announces every tick that passed, once */
+	advance_ticks(3U);
+	zassert_true(rti_dispatch());
+	zassert_equal(rti_test_announced, 5);
+	zassert_false(rti_dispatch());
+	zassert_equal(rti_sys_clock_elapsed(), 0U, "ticked mode does not report elapsed ticks");
+}
+
+ZTEST(ti_hercules_rti_timer, test_tickless_timeout)
+{
+	if (!TICKLESS) {
+		ztest_test_skip();
+	}
+
+	rti_sys_clock_set_timeout(5, false);
+	advance_counts(4U * rti_test_cyc_per_tick() + rti_test_cyc_per_tick() / 2U);
+	zassert_false(rti_dispatch(), "fired early");
+	zassert_equal(rti_sys_clock_elapsed(), 4U);
+
+	advance_ticks(1U);
+	zassert_true(rti_dispatch());
+	zassert_equal(rti_test_announced, 5);
+	zassert_equal(rti_sys_clock_elapsed(), 0U);
+
+	/* The compare is one shot in tickless mode */
+	advance_ticks(2U);
+	zassert_false(rti_dispatch());
+	zassert_equal(rti_sys_clock_elapsed(), 2U);
+}
+
+ZTEST(ti_hercules_rti_timer, test_tickless_forever_extends_counter)
+{
+	if (!TICKLESS) {
+		ztest_test_skip();
+	}
+
+	/* Three maximum timeouts wrap the 32 bit counter */
+	for (int i = 1; i <= 3; i++) {
+		rti_sys_clock_set_timeout(K_TICKS_FOREVER, true);
+		advance_ticks(rti_test_max_ticks());
+		zassert_true(rti_dispatch(), "timeout %d", i);
+		zassert_equal(rti_test_announced, i * (int32_t)rti_test_max_ticks());
+	}
+	zassert_true(rti_sys_clock_cycle_get_64() > UINT32_MAX);
+	zassert_equal((uint32_t)rti_sys_clock_cycle_get_64(), rti_sys_clock_cycle_get_32());
+}
+
+ZTEST(ti_hercules_rti_timer, test_disable_stops_counter)
+{
+	uint32_t before;
+
+	rti_sys_clock_disable();
+	before = rti_sys_clock_cycle_get_32();
+	advance_ticks(2U);
+	zassert_equal(rti_sys_clock_cycle_get_32(), before);
+	zassert_false(rti_dispatch());
+}
+
+ZTEST_SUITE(ti_hercules_rti_timer, NULL, NULL, rti_before, NULL, NULL);
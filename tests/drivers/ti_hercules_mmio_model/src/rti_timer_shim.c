@@ -0,0 +1,72 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * native_sim keeps its own system timer, so the RTI driver is built here with
+ * its kernel hooks renamed. Its interrupt is routed through the VIM driver and
+ * its init function is run by the tests instead of by SYS_INIT.
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/irq.h>
+#include <zephyr/kernel.h>
+
+#include "hercules_model.h"
+
+#define sys_clock_announce        rti_test_announce
+#define sys_clock_elapsed         rti_sys_clock_elapsed
+#define sys_clock_disable         rti_sys_clock_disable
+#define sys_clock_cycle_get_32    rti_sys_clock_cycle_get_32
+#define sys_clock_cycle_get_64    rti_sys_clock_cycle_get_64
+#define sys_clock_idle_exit       rti_sys_clock_idle_exit
+#define sys_clock_set_timeout     rti_sys_clock_set_timeout
+#define z_clock_hw_cycles_per_sec rti_hw_cycles_per_sec
+
+#undef SYS_INIT
+#define SYS_INIT(init_fn, level, prio) static int (*const rti_driver_init)(void) = init_fn
+
+#undef IRQ_CONNECT
+#define IRQ_CONNECT(irq, prio, isr, arg, flags) z_soc_irq_priority_set(irq, prio, flags)
+
+#undef irq_enable
+#define irq_enable(irq) z_soc_irq_enable(irq)
+
+int z_clock_hw_cycles_per_sec;
+
+#include "ti_hercules_rti_timer.c"
+
+int32_t rti_test_announced;
+
+void sys_clock_announce(int32_t ticks)
+{
+	rti_test_announced += ticks;
+}
+
+int rti_test_init(void)
+{
+	announced = 0;
+	rti_test_announced = 0;
+	return rti_driver_init();
+}
+
+void rti_test_isr(void)
+{
+	rti_compare0_isr(NULL);
+}
+
+uint32_t rti_test_cyc_per_tick(void)
+{
+	return cyc_per_tick;
+}
+
+uint32_t rti_test_max_ticks(void)
+{
+	return max_ticks;
+}
+
+int rti_test_hw_cycles_per_sec(void)
+{
+	return z_clock_hw_cycles_per_sec;
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyrights (c) 2024 Rahul Arasikere <arasikere.rahul@gmail.com>
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <limits.h>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/interrupt_controller/intc_ti_hercules_vim.h>
+#include <zephyr/drivers/ti_hercules_mmio.h>
+#include <zephyr/dt-bindings/interrupt-controller/ti-hercules-vim.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include "hercules_model.h"
+
+#define VIM_FIRQPR(n)      (0x110U + (n) * 4U)
+#define VIM_REQMASKSET(n)  (0x130U + (n) * 4U)
+#define VIM_WAKEMASKSET(n) (0x150U + (n) * 4U)
+#define VIM_CHANCTRL(n)    (0x180U + (n) * 4U)
+
+static uint32_t vim_reg(uint32_t off)
+{
+	uint8_t *vim = HERCULES_MMIO(DT_REG_ADDR(DT_NODELABEL(vim)));
+
+	return hercules_mmio_model_read((volatile uint32_t *)(vim + off));
+}
+
+static void vim_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	hercules_mmio_model_reset();
+	z_soc_irq_init();
+}
+
+ZTEST(ti_hercules_vim, test_init_state)
+{
+	/* Channels 0 and 1 are FIQ only and enabled, everything else is a masked IRQ */
+	zassert_equal(vim_reg(VIM_FIRQPR(0)), 0x3U);
+	zassert_equal(vim_reg(VIM_REQMASKSET(0)), 0x3U);
+	for (uint32_t w = 1; w < 4U; w++) {
+		zassert_equal(vim_reg(VIM_FIRQPR(w)), 0U);
+		zassert_equal(vim_reg(VIM_REQMASKSET(w)), 0U);
+	}
+	zassert_true(z_soc_irq_is_enabled(1));
+	zassert_false(z_soc_irq_is_enabled(2));
+}
+
+ZTEST(ti_hercules_vim, test_enable_disable)
+{
+	static const unsigned int irqs[] = {2, 31, 32, 63, 64, 100, 127};
+
+	ARRAY_FOR_EACH(irqs, i) {
+		unsigned int irq = irqs[i];
+
+		z_soc_irq_enable(irq);
+		zassert_true(z_soc_irq_is_enabled(irq), "irq %u", irq);
+		zassert_equal(vim_reg(VIM_REQMASKSET(irq / 32U)) & BIT(irq % 32U), BIT(irq % 32U));
+		z_soc_irq_disable(irq);
+		zassert_false(z_soc_irq_is_enabled(irq), "irq %u", irq);
+	}
+	/* Set/clear pairs only touch the addressed channel */
+	zassert_equal(vim_reg(VIM_REQMASKSET(0)), 0x3U);
+}
+
+ZTEST(ti_hercules_vim, test_lowest_pending_channel_first)
+{
+	z_soc_irq_enable(33);
+	z_soc_irq_enable(70);
+	hercules_mmio_model_vim_raise(70);
+	hercules_mmio_model_vim_raise(33);
+
+	zassert_equal(z_soc_irq_get_active(), 33U);
+	z_soc_irq_eoi(33);
+	zassert_equal(z_soc_irq_get_active(), 70U);
+	z_soc_irq_eoi(70);
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX, "no request left");
+}
+
+ZTEST(ti_hercules_vim, test_masked_request_not_active)
+{
+	hercules_mmio_model_vim_raise(7);
+	zassert_equal(z_soc_irq_get_active(), UINT_MAX);
+
+	z_soc_irq_enable(9);
+	hercules_mmio_model_vim_raise(9);
+	zassert_equal(z_soc_irq_get_active(), 9U);
+	z_soc_irq_eoi(9);
+
+	/* The request stays pending and is taken once enabled */
+	z_soc_irq_enable(7);
+	zassert_equal(z_soc_irq_get_active(), 7U);
+	z_soc_irq_eoi(7);
+}
+
+ZTEST(ti_hercules_vim, test_fiq_before_irq)
+{
+	z_soc_irq_priority_set(40, 40, SYS_FIQ);
+	zassert_equal(vim_reg(VIM_FIRQPR(1)), BIT(8));
+	z_soc_irq_enable(5);
+	z_soc_irq_enable(40);
+	hercules_mmio_model_vim_raise(5);
+	hercules_mmio_model_vim_raise(40);
+
+	/* The higher numbered FIQ is taken before the pending IRQ */
+	zassert_equal(z_soc_irq_get_active(), 40U);
+	z_soc_irq_eoi(40);
+	zassert_equal(z_soc_irq_get_active(), 5U);
+	z_soc_irq_eoi(5);
+
+	z_soc_irq_priority_set(40, 40, SYS_IRQ);
+	zassert_equal(vim_reg(VIM_FIRQPR(1)), 0U);
+}
+
+ZTEST(ti_hercules_vim, test_channel_mapping)
+{
+	/* CHANCTRL[n] holds channels 4n..4n+3, channel 4n in the top byte */
+	z_soc_irq_priority_set(45, 10, SYS_IRQ);
+	zassert_equal(vim_reg(VIM_CHANCTRL(2)) & 0xFF00U, 45U << 8);
+	z_soc_irq_priority_set(46, 11, SYS_IRQ);
+	zassert_equal(vim_reg(VIM_CHANCTRL(2)) & 0xFFFFU, (45U << 8) | 46U);
+	/* Remapping a channel replaces its request */
+	z_soc_irq_priority_set(47, 10, SYS_IRQ);
+	zassert_equal(vim_reg(VIM_CHANCTRL(2)) & 0xFFFFU, (47U << 8) | 46U);
+}
+
+ZTEST(ti_hercules_vim, test_wakeup_mask)
+{
+	zassert_equal(vim_reg(VIM_WAKEMASKSET(0)), UINT32_MAX, "all channels wake after reset");
+	ti_hercules_vim_wakeup_set(12, false);
+	ti_hercules_vim_wakeup_set(98, false);
+	zassert_equal(vim_reg(VIM_WAKEMASKSET(0)), ~BIT(12));
+	zassert_equal(vim_reg(VIM_WAKEMASKSET(3)), ~BIT(2));
+	ti_hercules_vim_wakeup_set(12, true);
+	zassert_equal(vim_reg(VIM_WAKEMASKSET(0)), UINT32_MAX);
+}
+
+ZTEST_SUITE(ti_hercules_vim, NULL, NULL, vim_before, NULL, NULL);